@@ -47,6 +47,8 @@
 // Include Magic Lantern header files.
 #include "mle/MleActor.h"
 #include "mle/MleRole.h"
+#include "mle/MleSet.h"
+#include "mle/MleArena.h"
 #include "mle/mlMalloc.h"
 
 void MleActor::getProperty(MleObject * /*object*/, const char * /*name*/, unsigned char **value)
@@ -65,6 +67,10 @@ MleActor::MleActor(void)
 {
     // variable initialization
     m_role = NULL;
+    m_dirtyMask = 0;
+    m_dirtySet = NULL;
+    m_dirtyPrev = NULL;
+    m_dirtyNext = NULL;
 
 #ifdef MLE_DIGITAL_WORKPRINT
     m_name = NULL;
@@ -91,12 +97,48 @@ MleActor::~MleActor()
         delete curRole;
     }
 
+    // Don't leave a dangling entry in the set's dirty actor list.
+    if (m_dirtySet)
+        m_dirtySet->removeDirtyActor(this);
+
 #ifdef MLE_DIGITAL_WORKPRINT
     this->unregisterInstance();
     if (m_name) mlFree(m_name);
 #endif /* MLE_DIGITAL_WORKPRINT */
 }
 
+MleActor::MleActor(const MleActor &actor)
+  : MleObject()
+{
+    m_role = NULL;
+
+    // Every property of the copy is new to its role, which pulls
+    //   them once the copy is initialized.
+    m_dirtyMask = MLE_DIRTY_ALL;
+    m_dirtySet = NULL;
+    m_dirtyPrev = NULL;
+    m_dirtyNext = NULL;
+
+#ifdef MLE_DIGITAL_WORKPRINT
+    m_name = NULL;
+    m_actorClass = actor.m_actorClass;
+#else
+    (void) actor;
+#endif /* MLE_DIGITAL_WORKPRINT */
+}
+
+size_t
+MleActor::getCloneSize(void) const
+{
+    return sizeof(MleActor);
+}
+
+MleActor *
+MleActor::clone(void *storage) const
+{
+    return new (storage) MleActor(*this);
+}
+
 // This is the virtual init function that is called after property values
 // are poked into actor memory.  This does nothing in the base class;
 // subclasses should override to make the state consistent.
@@ -116,13 +158,19 @@ MleActor::operator new(size_t tSize)
 void
 MleActor::operator delete(void *p)
 {
-    mlFree(p);
+    // Cloned actors live in an arena.
+    if (! MleArena::free(p))
+        mlFree(p);
 }
 
 void MleActor::attachRole(MleRole* newRole)
 {     
     MLE_ASSERT(!m_role);
     m_role = newRole;
+
+    // Properties may have been set before the role existed.
+    if (m_dirtyMask)
+        enlistDirty();
 }
 
 
@@ -133,6 +181,100 @@ void MleActor::removeRole()
 }
 
 
+// Every class's dirty bit record, most recently created first.
+static MleDirtyClass *g_dirtyClasses = NULL;
+
+MleDirtyClass::MleDirtyClass(const MleDirtyClass *superclass)
+  : m_superclass(superclass),
+    m_used(0)
+{
+    memset(m_names, 0, sizeof(m_names));
+    m_next = g_dirtyClasses;
+    g_dirtyClasses = this;
+}
+
+
+MleDirtyClass *
+MleActor::dirtyClass(void)
+{
+    static MleDirtyClass record(NULL);
+    return &record;
+}
+
+
+// Test whether record is dirtyClass or one of its subclasses.
+static MlBoolean
+_mlIsDirtySubclass(const MleDirtyClass *record, const MleDirtyClass *dirtyClass)
+{
+    for (; record; record = record->m_superclass)
+        if (record == dirtyClass)
+            return TRUE;
+    return FALSE;
+}
+
+
+MleDirtyMask
+MleActor::getPropertyDirtyMask(MleDirtyClass *dirtyClass, const char *property)
+{
+    const MleDirtyClass *record;
+    MleDirtyMask taken = 0;
+    unsigned int bit;
+
+    // This runs once per property per class, so a linear search
+    // is good enough.  A name already owned by the class or a
+    // superclass keeps its bit.
+    for (record = dirtyClass; record; record = record->m_superclass)
+    {
+        for (bit = 0; bit < MLE_DIRTY_BITS; bit++)
+            if (record->m_names[bit] && (strcmp(record->m_names[bit], property) == 0))
+                return ((MleDirtyMask)1) << bit;
+        taken |= record->m_used;
+    }
+
+    // The bits of the subclasses are taken too, since their actors
+    // have this class's properties as well.
+    for (record = g_dirtyClasses; record; record = record->m_next)
+        if (_mlIsDirtySubclass(record, dirtyClass))
+            taken |= record->m_used;
+
+    for (bit = 0; bit < MLE_DIRTY_BITS; bit++)
+        if (! (taken & (((MleDirtyMask)1) << bit)))
+            break;
+
+    // Out of bits; say so rather than share one with another property.
+    MLE_ASSERT(bit < MLE_DIRTY_BITS);
+    if (bit == MLE_DIRTY_BITS)
+        return MLE_DIRTY_ALL;
+
+    dirtyClass->m_names[bit] = property;
+    dirtyClass->m_used |= ((MleDirtyMask)1) << bit;
+    return ((MleDirtyMask)1) << bit;
+}
+
+
+MleDirtyMask
+MleActor::clearDirty(MleDirtyMask mask)
+{
+    MleDirtyMask cleared = m_dirtyMask & mask;
+    m_dirtyMask &= ~mask;
+
+    if (! m_dirtyMask && m_dirtySet)
+        m_dirtySet->removeDirtyActor(this);
+
+    return cleared;
+}
+
+
+void
+MleActor::enlistDirty(void)
+{
+    if (m_dirtySet || ! m_role || ! m_role->m_set)
+        return;
+
+    m_role->m_set->addDirtyActor(this);
+}
+
+
 MleActor *_mleCreateMleActor(void)
 {
     return new MleActor;
@@ -145,15 +287,35 @@ MleActor::getTypeName(void) const
     return "MleActor";
 }
 
+// The actor classes form a tree of interned type symbols rooted
+// here; subclasses add themselves through MLE_ACTOR_SOURCE().
+MleTypeId
+MleActor::classTypeId(void)
+{
+    static MleTypeId type = MleTypeSymbol::intern("MleActor",MLE_TYPE_NONE);
+    return type;
+}
+
+MleTypeId
+MleActor::getTypeId(void) const
+{
+    return classTypeId();
+}
+
+// The string form of isa() is kept for compatibility.  An unknown
+// name cannot be one of our superclasses, since interning our own
+// class interned all of them.
 int
 MleActor::isa(const char *type) const
 {
-    return !strcmp(type,"MleActor");
+    MleTypeId self = getTypeId();
+    return MleTypeSymbol::isa(self,MleTypeSymbol::find(type,self));
 }
 
 void
 MleActor::initClass(void)
 {
+    classTypeId();
     new MleActorClass("MleActor",_mleCreateMleActor,"");
 }
 #endif /* MLE_DIGITAL_WORKPRINT */
@@ -204,18 +366,11 @@ void
 MleActor::unregisterInstance()
 {
     // Eliminate from instance registry.
-
-    // XXX - must iterate through dict.  We could have registered this twice,
-    // or we could put a removeValue in the dict class.
-
-    for (MleDwpDictIter iter(g_instanceRegistry); iter.getValue(); iter.next())
-    {
-        if ((MleActor*) iter.getValue() == this)
-        {
-            g_instanceRegistry.remove(iter.getKey());
-            break;
-        }
-    }
+    //   The registry is keyed by our name, so look it up directly.
+    //   Only remove the entry if it still refers to us; another
+    //   instance may have since been registered under the same name.
+    if ( m_name && (MleActor *) g_instanceRegistry.find(m_name) == this )
+        g_instanceRegistry.remove(m_name);
 }
 
 // Change an actor's name, which also causes re-registration under
@@ -271,9 +426,7 @@ MleActor::poke(const char *property,MleDwpDataUnion *value)
     // Transfer the value.
     MLE_ASSERT(value->m_datatype);
 
-    //if (value->m_datatype != member->getType())
-    int cmp = strcmp(value->m_datatype->getName(),member->getType()->getName());
-    if (cmp != 0)
+    if ( ! member->matches(value->m_datatype) )
     {
         printf("MleActor: type mismatch in setting property %s on %s (%s and %s).\n",
                property, getTypeName(),
@@ -282,98 +435,15 @@ MleActor::poke(const char *property,MleDwpDataUnion *value)
         return 1;
     }
 
-    //value->m_datatype->get(value,(char *)this + member->getOffset());
+    // Convert the value into a temporary on the stack, set value from
+    // DWP into Actor property, and destroy the temporary again.
+    // Note: other data types may need to be translated in addition to
+    // arrays.
+    MleActorMemberValue buffer;
     MlePropertyEntry *entry = member->getEntry();
-    unsigned char *pvalue;
-    //if (member->getType()->isa(MleDwpFloatArray::typeId)) {
-    if (! strcmp(member->getType()->getName(), "FloatArray")) {
-        const MleDwpFloatArray *dwpFloatArray = (MleDwpFloatArray *)member->getType();
-        MleArray<float> *array = new MleArray<float>;
-        dwpFloatArray->get(value, array);
-        pvalue = (unsigned char *)array;
-    //} else if (member->getType()->isa(MleDwpIntArray::typeId)) {
-    } else if (! strcmp(member->getType()->getName(), "IntArray")) {
-        const MleDwpIntArray *dwpIntArray = (MleDwpIntArray *)member->getType();
-        MleArray<int> *array = new MleArray<int>;
-        dwpIntArray->get(value, array);
-        pvalue = (unsigned char *)array;
-    //} else if (member->getType()->isa(MleDwpScalarArray::typeId)) {
-    } else if (! strcmp(member->getType()->getName(), "ScalarArray")) {
-        const MleDwpScalarArray *dwpScalarArray = (MleDwpScalarArray *)member->getType();
-        MleArray<MlScalar> *array = new MleArray<MlScalar>;
-        dwpScalarArray->get(value, array);
-        pvalue = (unsigned char *)array;
-    //} else if (member->getType()->isa(MleDwpVector3Array::typeId)) {
-    } else if (! strcmp(member->getType()->getName(), "Vector3Array")) {
-        const MleDwpVector3Array *dwpVec3Array = (MleDwpVector3Array *)member->getType();
-        MleArray<MlVector3> *array = new MleArray<MlVector3>;
-        dwpVec3Array->get(value, array);
-        pvalue = (unsigned char *)array;
-    //} else if (member->getType()->isa(MleDwpVector2::typeId)) {
-    } else if (! strcmp(member->getType()->getName(), "MlVector2")) {
-        const MleDwpVector2 *dwpVec2 = (MleDwpVector2 *)member->getType();
-        MlVector2 *vector = new MlVector2();
-        dwpVec2->get(value, vector);
-        pvalue = (unsigned char *)vector;
-    //} else if (member->getType()->isa(MleDwpVector3::typeId)) {
-    } else if (! strcmp(member->getType()->getName(), "MlVector3")) {
-        const MleDwpVector3 *dwpVec3 = (MleDwpVector3 *)member->getType();
-        MlVector3 *vector = new MlVector3();
-        dwpVec3->get(value, vector);
-        pvalue = (unsigned char *)vector;
-    //} else if (member->getType()->isa(MleDwpVector4::typeId)) {
-    } else if (! strcmp(member->getType()->getName(), "MlVector4")) {
-        const MleDwpVector4 *dwpVec4 = (MleDwpVector4 *)member->getType();
-        MlVector4 *vector = new MlVector4();
-        dwpVec4->get(value, vector);
-        pvalue = (unsigned char *)vector;
-    //} else if (member->getType()->isa(MleDwpTransform::typeId)) {
-    } else if (! strcmp(member->getType()->getName(), "MlTransform")) {
-        const MleDwpTransform *dwpTran = (MleDwpTransform *)member->getType();
-        MlTransform *transfrm = new MlTransform();
-        dwpTran->get(value, transfrm);
-        pvalue = (unsigned char *)transfrm;
-    //} else if (member->getType()->isa(MleDwpRotation::typeId)) {
-    } else if (! strcmp(member->getType()->getName(), "MlRotation")) {
-        const MleDwpRotation *dwpRot = (MleDwpRotation *)member->getType();
-        MlRotation *rotation = new MlRotation();
-        dwpRot->get(value, rotation);
-        pvalue = (unsigned char *)rotation;
-    } else if (! strcmp(member->getType()->getName(), "string")) {
-        const MleDwpString *dwpStr = (MleDwpString *)member->getType();
-        //char *str = (char *) mlMalloc(dwpStr->getSize() + 1);
-        char *str;
-        // Memory is allocated for the string by the following get() query.
-        dwpStr->get(value, &str);
-        pvalue = (unsigned char *)str;
-    } else {
-        // This should work for anonymous data types (i.e. int, float, etc.)
-        pvalue = (unsigned char *)value;
-    }
-
-    // Set value from DWP into Actor property. Note: other data types may need to be
-    // translated in addition to arrays.
+    unsigned char *pvalue = (unsigned char *)member->convert(value,&buffer);
     entry->setProperty(this, entry->name, pvalue);
-
-    // Clean up
-    /*
-    if (member->getType()->isa(MleDwpVector2::typeId)) { delete ((MlVector2 *)pvalue); }
-    else if (member->getType()->isa(MleDwpVector3::typeId)) { delete ((MlVector3 *)pvalue); }
-    else if (member->getType()->isa(MleDwpVector4::typeId)) { delete ((MlVector4 *)pvalue); }
-    else if (member->getType()->isa(MleDwpTransform::typeId)) { delete ((MlTransform *)pvalue); }
-    else if (member->getType()->isa(MleDwpRotation::typeId)) { delete ((MlRotation*)pvalue); }
-    */
-
-    if (! strcmp(member->getType()->getName(), "MlVector2")) { delete ((MlVector2 *)pvalue); }
-    else if (! strcmp(member->getType()->getName(), "MlVector3")) { delete ((MlVector3 *)pvalue); }
-    else if (! strcmp(member->getType()->getName(), "MlVector4")) { delete ((MlVector4 *)pvalue); }
-    else if  (! strcmp(member->getType()->getName(), "MlTransform")) { delete ((MlTransform *)pvalue); }
-    else if (! strcmp(member->getType()->getName(), "MlRotation")) { delete ((MlRotation *)pvalue); }
-    else if (! strcmp(member->getType()->getName(), "FloatArray")) { delete ((MleArray<float> *)pvalue); }
-    else if (! strcmp(member->getType()->getName(), "IntArray")) { delete ((MleArray<int> *)pvalue); }
-    else if (! strcmp(member->getType()->getName(), "ScalarArray")) { delete ((MleArray<MlScalar> *)pvalue); }
-    else if (! strcmp(member->getType()->getName(), "Vector3Array")) { delete ((MleArray<MlVector3> *)pvalue); }
-    else if (! strcmp(member->getType()->getName(), "string")) { mlFree((char *)pvalue); }
+    member->release(pvalue);
 
     return 0;
 }
@@ -450,33 +520,8 @@ MleActor::hasTransform(void)
     if ( getClass() == NULL )
         return 0;
     
-    // Look for some well-known representations.
-    int rval = 0;
-    const MleActorMember *member;
-
-    member = m_actorClass->findMember("position");
-    if ( member && (member->getType()->isa(MleDwpVector3::typeId) ||
-         member->getType()->isa(MleDwpVector2::typeId)) )
-        rval |= MLE_ACTOR_TRANSLATION;
-
-    member = m_actorClass->findMember("translation");
-    if ( member && (member->getType()->isa(MleDwpVector3::typeId) ||
-         member->getType()->isa(MleDwpVector2::typeId)) )
-        rval |= MLE_ACTOR_TRANSLATION;
-    
-    member = m_actorClass->findMember("orientation");
-    if ( member && member->getType()->isa(MleDwpRotation::typeId) )
-        rval |= MLE_ACTOR_ROTATION;
-
-    member = m_actorClass->findMember("rotation");
-    if ( member && member->getType()->isa(MleDwpVector3::typeId) )
-        rval |= MLE_ACTOR_ROTATION;
-    
-    member = m_actorClass->findMember("transform");
-    if ( member && member->getType()->isa(MleDwpTransform::typeId) )
-        rval |= MLE_ACTOR_AFFINE;
-    
-    return rval;
+    // The class resolves the well-known representations once.
+    return m_actorClass->getTransformMembers()->m_capabilities;
 }
 
 int
@@ -488,10 +533,11 @@ MleActor::setTransform(MlTransform& t)
     
     // Look for some well-known representations.
     int rval = 0;
+    const MleActorTransformMembers *tm = m_actorClass->getTransformMembers();
     const MleActorMember *member;
 
-    member = m_actorClass->findMember("transform");
-    if ( member && member->getType()->isa(MleDwpTransform::typeId) )
+    member = tm->m_transform;
+    if ( member )
     {
         //MlTransform *p = (MlTransform *) ((char *)this + member->getOffset());
         MlTransform *p;
@@ -502,10 +548,10 @@ MleActor::setTransform(MlTransform& t)
         *p = t;
     }
 
-    member = m_actorClass->findMember("position");
+    member = tm->m_position3 ? tm->m_position3 : tm->m_position2;
     if (member)
     {
-        if (member->getType()->isa(MleDwpVector3::typeId)) {
+        if (member == tm->m_position3) {
             //MlScalar *p = (MlScalar *) ((char *) this +    member->getOffset());
             MlScalar *p;
             MlePropertyEntry *entry = member->getEntry();
@@ -516,7 +562,7 @@ MleActor::setTransform(MlTransform& t)
             p[1] = t[3][1];
             p[2] = t[3][2];
         }
-        else if (member->getType()->isa(MleDwpVector2::typeId))
+        else if (member == tm->m_position2)
         {
             //MlScalar *p = (MlScalar *) ((char *) this + member->getOffset());
             MlScalar *p;
@@ -529,10 +575,10 @@ MleActor::setTransform(MlTransform& t)
         }
     }
 
-    member = m_actorClass->findMember("translation");
+    member = tm->m_translation3 ? tm->m_translation3 : tm->m_translation2;
     if (member)
     {
-        if (member->getType()->isa(MleDwpVector3::typeId))
+        if (member == tm->m_translation3)
         {
             //MlScalar *p = (MlScalar *) ((char *) this + member->getOffset());
             MlScalar *p;
@@ -544,7 +590,7 @@ MleActor::setTransform(MlTransform& t)
             p[1] = t[3][1];
             p[2] = t[3][2];
         }
-        else if (member->getType()->isa(MleDwpVector2::typeId))
+        else if (member == tm->m_translation2)
         {
             //MlScalar *p = (MlScalar *) ((char *) this + member->getOffset());
             MlScalar *p;
@@ -557,8 +603,8 @@ MleActor::setTransform(MlTransform& t)
         }
     }
 
-    member = m_actorClass->findMember("scale");
-    if ( member && member->getType()->isa(MleDwpVector3::typeId) )
+    member = tm->m_scale3;
+    if ( member )
     {
         //MlScalar *s = (MlScalar *)((char *)this + member->getOffset());
         MlScalar *s;
@@ -594,8 +640,8 @@ MleActor::setTransform(MlTransform& t)
         t[2][2] = mlMul(t[2][2],tmp);
     }
 
-    member = m_actorClass->findMember("scale");
-    if ( member && member->getType()->isa(MleDwpScalar::typeId) )
+    member = tm->m_scale1;
+    if ( member )
     {
         //MlScalar *s = (MlScalar *)((char *)this + member->getOffset());
         MlScalar *s;
@@ -621,8 +667,8 @@ MleActor::setTransform(MlTransform& t)
         t[2][2] = mlMul(t[2][2],tmp);
     }
 
-    member = m_actorClass->findMember("orientation");
-    if ( member && member->getType()->isa(MleDwpRotation::typeId) )
+    member = tm->m_orientation;
+    if ( member )
     {
         MlScalar quat[4];
         //MlRotation *rot = (MlRotation *) ((char *)this + member->getOffset());
@@ -680,8 +726,8 @@ MleActor::setTransform(MlTransform& t)
         rot->setValue(quat);
     }
 
-    member = m_actorClass->findMember("rotation");
-    if ( member && member->getType()->isa(MleDwpVector3::typeId) )
+    member = tm->m_rotation;
+    if ( member )
     {
         //MlScalar *rot = (MlScalar *)((char *)this + member->getOffset());
         MlScalar *rot;
@@ -710,10 +756,11 @@ MleActor::getTransform(MlTransform& t)
         return;
     
     // Look for some well-known representations.
+    const MleActorTransformMembers *tm = m_actorClass->getTransformMembers();
     const MleActorMember *member;
 
-    member = m_actorClass->findMember("transform");
-    if ( member && member->getType()->isa(MleDwpTransform::typeId) )
+    member = tm->m_transform;
+    if ( member )
     {
         //MlTransform *p = (MlTransform *) ((char *)this + member->getOffset());
         MlTransform *p;
@@ -724,10 +771,10 @@ MleActor::getTransform(MlTransform& t)
         t = *p;
     }
 
-    member = m_actorClass->findMember("position");
+    member = tm->m_position3 ? tm->m_position3 : tm->m_position2;
     if (member)
     {
-        if(member->getType()->isa(MleDwpVector3::typeId))
+        if(member == tm->m_position3)
         {
             //MlScalar *p = (MlScalar *) ((char *) this + member->getOffset());
             MlScalar *p;
@@ -739,7 +786,7 @@ MleActor::getTransform(MlTransform& t)
             t[3][1] = p[1];
             t[3][2] = p[2];
         }
-        else if (member->getType()->isa(MleDwpVector2::typeId))
+        else if (member == tm->m_position2)
         {
             //MlScalar *p = (MlScalar *) ((char *) this + member->getOffset());
             MlScalar *p;
@@ -752,9 +799,9 @@ MleActor::getTransform(MlTransform& t)
         }
     }
 
-    member = m_actorClass->findMember("translation");
+    member = tm->m_translation3 ? tm->m_translation3 : tm->m_translation2;
     if(member) {
-        if(member->getType()->isa(MleDwpVector3::typeId))
+        if(member == tm->m_translation3)
         {
             //MlScalar *p = (MlScalar *) ((char *) this + member->getOffset());
             MlScalar *p;
@@ -766,7 +813,7 @@ MleActor::getTransform(MlTransform& t)
             t[3][1] = p[1];
             t[3][2] = p[2];
         }
-        else if(member->getType()->isa(MleDwpVector2::typeId))
+        else if(member == tm->m_translation2)
         {
             //MlScalar *p = (MlScalar *) ((char *) this + member->getOffset());
             MlScalar *p;
@@ -779,8 +826,8 @@ MleActor::getTransform(MlTransform& t)
         }
     }
 
-    member = m_actorClass->findMember("orientation");
-    if ( member && member->getType()->isa(MleDwpRotation::typeId) )
+    member = tm->m_orientation;
+    if ( member )
     {
         //MlRotation *rot = (MlRotation *) ((char *)this + member->getOffset());
         MlRotation *rot;
@@ -799,8 +846,8 @@ MleActor::getTransform(MlTransform& t)
     }
 
 
-    member = m_actorClass->findMember("rotation");
-    if ( member && member->getType()->isa(MleDwpVector3::typeId) )
+    member = tm->m_rotation;
+    if ( member )
     {
         //MlScalar *rot = (MlScalar *)((char *)this + member->getOffset());
         MlScalar *rot;
@@ -817,8 +864,8 @@ MleActor::getTransform(MlTransform& t)
     }
 
 
-    member = m_actorClass->findMember("scale");
-    if ( member && member->getType()->isa(MleDwpVector3::typeId) )
+    member = tm->m_scale3;
+    if ( member )
     {
         //MlScalar *s = (MlScalar *)((char *)this + member->getOffset());
         MlScalar *s;
@@ -837,8 +884,8 @@ MleActor::getTransform(MlTransform& t)
         t[2][2] = mlMul(t[2][2],s[2]);
     }
 
-    member = m_actorClass->findMember("scale");
-    if ( member && member->getType()->isa(MleDwpScalar::typeId) )
+    member = tm->m_scale1;
+    if ( member )
     {
         //MlScalar *s = (MlScalar *)((char *)this + member->getOffset());
         MlScalar *s;
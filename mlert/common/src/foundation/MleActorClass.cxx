@@ -41,6 +41,7 @@
 // Include system header files.
 #include <stdio.h>
 #include <string.h>
+#include <new>
 
 // Include Magic Lantern header files.
 #include "mle/mlMalloc.h"
@@ -48,9 +49,26 @@
 
 // Include Runtime Engine header files.
 #include "mle/MleActorClass.h"
+#include "mle/MleActor.h"
 
 // Include Digital Workprint header files.
+#include "mle/DwpDataUnion.h"
 #include "mle/DwpDatatype.h"
+#include "mle/DwpFloatArray.h"
+#include "mle/DwpIntArray.h"
+#include "mle/DwpScalar.h"
+#include "mle/DwpScalarArray.h"
+#include "mle/DwpVector3Array.h"
+#include "mle/DwpVector2.h"
+#include "mle/DwpVector3.h"
+#include "mle/DwpVector4.h"
+#include "mle/DwpTransform.h"
+#include "mle/DwpRotation.h"
+#include "mle/DwpString.h"
+#include "math/scalar.h"
+#include "math/vector.h"
+#include "math/transfrm.h"
+#include "math/rotation.h"
 
 // Initialize dictionaries to work off a pool of 256 entries
 // (classes + members) and a hash table of 20 for both
@@ -71,6 +89,10 @@ MleActorClassDict MleActorClass::g_registry(20);
 // Declare the DSO loader for actor classes.
 MleDSOLoader MleActorClass::g_loader;
 
+unsigned int MleActorClass::g_memberGeneration = 1;
+unsigned int MleActorClass::g_memberRemovals = 0;
+unsigned int MleActorClass::g_templateGeneration = 1;
+
 MleActorClass::MleActorClass(const char *name,
     MleActor *(*c)(void),const char *superclass)
 : MleDwpStrKeyDict(20), m_propDatasetDict(3)
@@ -89,21 +111,13 @@ MleActorClass::MleActorClass(const char *name,
     /* Remember the creation func. */
     create = c;
 
-    /* Look up the superclass info. */
-    MleActorClass *super = (MleActorClass *)g_registry.find(superclass);
-
-    /* Copy the superclass members into the local space. */
-    if ( super )
-    {
-        /* Use the dictionary iterator. */
-        MleActorMemberIter iter(super);
-        const MleActorMember *member;
-        while ( (member = iter.getMember()) )
-        {
-            set(iter.getName(),new MleActorMember(*member));
-            iter.next();
-        }
-    }
+    /* Look up the superclass info; its members are inherited through it. */
+    m_superclass = (MleActorClass *)g_registry.find(superclass);
+    m_localGeneration = 0;
+    m_flatTable = NULL;
+    m_flatGeneration = 0;
+    m_plans = NULL;
+    m_transformGeneration = 0;
 
     /* Put self into the global Actor class registry ... */
     MleActorClass *tmp = (MleActorClass *)g_registry.find(name);
@@ -131,21 +145,13 @@ MleActorClass::MleActorClass(const char *name,
     /* Remember the creation func. */
     create = c;
 
-    /* Look up the superclass info. */
-    MleActorClass *super = (MleActorClass *)g_registry.find(superclass);
-
-    /* Copy the superclass members into the local space. */
-    if ( super )
-    {
-        /* Use the dictionary iterator. */
-        MleActorMemberIter iter(super);
-        const MleActorMember *member;
-        while ( (member = iter.getMember()) )
-        {
-            set(iter.getName(),new MleActorMember(*member));
-            iter.next();
-        }
-    }
+    /* Look up the superclass info; its members are inherited through it. */
+    m_superclass = (MleActorClass *)g_registry.find(superclass);
+    m_localGeneration = 0;
+    m_flatTable = NULL;
+    m_flatGeneration = 0;
+    m_plans = NULL;
+    m_transformGeneration = 0;
 
     /* Put self into the global Actor class registry ... */
     MleActorClass *tmp = (MleActorClass *)g_registry.find(name);
@@ -164,10 +170,14 @@ MleActorClass::~MleActorClass()
     if (m_editorName != NULL) free(m_editorName);         // allocated using strdup()
     if (m_contentEditorName != NULL) free(m_editorName);  // allocated using strdup()
 
+    delete m_flatTable;
+    deletePlans();
+    delete m_plans;
+
     // Remove property members.
-    MleActorMemberIter iter(this);
+    MleDwpDictIter iter(*this);
     const MleActorMember *member;
-    while ( (member = iter.getMember()) )
+    while ( (member = (const MleActorMember *)iter.getValue()) )
     {
         // Note that the dictionary remove method below does NOT delete the
         // value of the dictionary entry. Therefore, we return it for the
@@ -175,11 +185,10 @@ MleActorClass::~MleActorClass()
         // MlePropertyEntry *entry = member->getEntry();
         // ToDo - delete entry here?
 
-        // Remove the property type from the dictionary.
-        remove(iter.getName());
-
-        // Get the next member.
+        // Step past the entry before removing it from the dictionary.
+        const char *name = (const char *)iter.getKey();
         iter.next();
+        remove(name);
     }
 }
 
@@ -216,6 +225,7 @@ MleActorClass::addMember(const char *name,const char *type,MlePropertyEntry *ent
 
     /* Put the new property into the dictionary. */
     set(name,member);
+    g_memberGeneration++;
 }
 
 /*
@@ -239,6 +249,8 @@ MleActorClass::removeMember(const char *name)
 
         // Remove the property type from the dictionary.
         remove(name);
+        g_memberGeneration++;
+        g_memberRemovals++;
     }
 
     return entry;
@@ -246,12 +258,110 @@ MleActorClass::removeMember(const char *name)
 
 /*
  * This function looks up a property.
+ *   Our own members shadow inherited ones, so the local table is
+ *   probed first and the superclass's flattened table second.
 */
 const MleActorMember *
 MleActorClass::findMember(const char *name) const
 {
-    /* Get the pointer from the registry. */
-    return (const MleActorMember *)MleDwpStrKeyDict::find(name);
+    /* The tables are caches, so building them doesn't change the class. */
+    MleActorClass *self = (MleActorClass *)this;
+
+    const MleActorMember *member = self->getLocalTable()->find(name);
+    if ( (member == NULL) && m_superclass )
+        member = m_superclass->getFlatTable()->find(name);
+    return member;
+}
+
+const MleActorMemberTable *
+MleActorClass::getLocalTable(void)
+{
+    if ( m_localGeneration != g_memberGeneration )
+    {
+        MleDwpDictIter count(*this);
+        int num = 0;
+        while ( count.getValue() )
+        {
+            num++;
+            count.next();
+        }
+        const char **names = (const char **)mlMalloc((num + 1)*sizeof(const char *));
+        const MleActorMember **members =
+            (const MleActorMember **)mlMalloc((num + 1)*sizeof(const MleActorMember *));
+
+        MleDwpDictIter iter(*this);
+        int n = 0;
+        while ( iter.getValue() )
+        {
+            names[n] = (const char *)iter.getKey();
+            members[n] = (const MleActorMember *)iter.getValue();
+            n++;
+            iter.next();
+        }
+
+        m_localTable.build(n,names,members);
+        m_localGeneration = g_memberGeneration;
+
+        mlFree(names);
+        mlFree(members);
+    }
+
+    return &m_localTable;
+}
+
+/*
+ * The flattened table holds our own members followed by every
+ * inherited member that we don't override.
+*/
+const MleActorMemberTable *
+MleActorClass::getFlatTable(void)
+{
+    if ( m_flatTable == NULL )
+        m_flatTable = new MleActorMemberTable;
+
+    if ( m_flatGeneration != g_memberGeneration )
+    {
+        const MleActorMemberTable *local = getLocalTable();
+        const MleActorMemberTable *inherited =
+            m_superclass ? m_superclass->getFlatTable() : NULL;
+
+        int num = local->getNumMembers();
+        if ( inherited )
+            num += inherited->getNumMembers();
+        const char **names = (const char **)mlMalloc((num + 1)*sizeof(const char *));
+        const MleActorMember **members =
+            (const MleActorMember **)mlMalloc((num + 1)*sizeof(const MleActorMember *));
+
+        int i, n = 0;
+        for ( i = 0; i < local->getNumSlots(); i++ )
+        {
+            const MleActorMemberSlot *slot = local->getSlot(i);
+            if ( slot->m_name )
+            {
+                names[n] = slot->m_name;
+                members[n] = slot->m_member;
+                n++;
+            }
+        }
+        for ( i = 0; inherited && (i < inherited->getNumSlots()); i++ )
+        {
+            const MleActorMemberSlot *slot = inherited->getSlot(i);
+            if ( slot->m_name && (local->find(slot->m_name) == NULL) )
+            {
+                names[n] = slot->m_name;
+                members[n] = slot->m_member;
+                n++;
+            }
+        }
+
+        m_flatTable->build(n,names,members);
+        m_flatGeneration = g_memberGeneration;
+
+        mlFree(names);
+        mlFree(members);
+    }
+
+    return m_flatTable;
 }
 
 void
@@ -425,6 +535,92 @@ MleActorClassDictEntry::operator delete(void *p)
     mlFree(p);
 }
 
+// Property conversions, indexed by MleActorMemberKind.
+//   Each converter builds the property value in caller-supplied storage
+//   and each releaser tears it down again, so converting a value does not
+//   allocate the temporary.  Strings are still allocated by
+//   MleDwpString::get().
+
+// The converted values; MleActorMemberValue must be at least this big.
+union MleActorMemberValues
+{
+    char m_vector2[sizeof(MlVector2)];
+    char m_vector3[sizeof(MlVector3)];
+    char m_vector4[sizeof(MlVector4)];
+    char m_transform[sizeof(MlTransform)];
+    char m_rotation[sizeof(MlRotation)];
+    char m_floatArray[sizeof(MleArray<float>)];
+    char m_intArray[sizeof(MleArray<int>)];
+    char m_scalarArray[sizeof(MleArray<MlScalar>)];
+    char m_vector3Array[sizeof(MleArray<MlVector3>)];
+    char m_generic[sizeof(MleDwpDataUnion)];
+    double m_alignDouble;
+    void *m_alignPointer;
+};
+
+typedef char _mleActorMemberValueFits
+    [(sizeof(MleActorMemberValues) <= sizeof(MleActorMemberValue)) ? 1 : -1];
+
+struct MleActorMemberConversion
+{
+    void *(*m_convert)(const MleDwpDatatype *type,MleDwpDataUnion *value,MleActorMemberValue *buffer);
+    void (*m_release)(void *pvalue);
+};
+
+template <class DATA,class DWPTYPE>
+static void *
+_mleMemberConvert(const MleDwpDatatype *type,MleDwpDataUnion *value,MleActorMemberValue *buffer)
+{
+    DATA *data = new ((void *)buffer) DATA();
+    ((const DWPTYPE *)type)->get(value,data);
+    return data;
+}
+
+template <class DATA>
+static void
+_mleMemberRelease(void *pvalue)
+{
+    ((DATA *)pvalue)->~DATA();
+}
+
+// Anonymous data types (i.e. int, float, etc.) are passed as a copy of
+//   the data union, so a converted value never refers to the workprint.
+static void *
+_mleMemberGeneric(const MleDwpDatatype *,MleDwpDataUnion *value,MleActorMemberValue *buffer)
+{
+    return new ((void *)buffer) MleDwpDataUnion(*value);
+}
+
+// Memory is allocated for the string by MleDwpString::get().
+static void *
+_mleMemberString(const MleDwpDatatype *type,MleDwpDataUnion *value,MleActorMemberValue *)
+{
+    char *str;
+    ((const MleDwpString *)type)->get(value,&str);
+    return str;
+}
+
+static void
+_mleMemberFree(void *pvalue)
+{
+    mlFree(pvalue);
+}
+
+static const MleActorMemberConversion g_memberConversions[MLE_MEMBER_NUM_KINDS] =
+{
+    { _mleMemberGeneric, _mleMemberRelease<MleDwpDataUnion> },
+    { _mleMemberConvert<MleArray<float>,MleDwpFloatArray>, _mleMemberRelease<MleArray<float> > },
+    { _mleMemberConvert<MleArray<int>,MleDwpIntArray>, _mleMemberRelease<MleArray<int> > },
+    { _mleMemberConvert<MleArray<MlScalar>,MleDwpScalarArray>, _mleMemberRelease<MleArray<MlScalar> > },
+    { _mleMemberConvert<MleArray<MlVector3>,MleDwpVector3Array>, _mleMemberRelease<MleArray<MlVector3> > },
+    { _mleMemberConvert<MlVector2,MleDwpVector2>, _mleMemberRelease<MlVector2> },
+    { _mleMemberConvert<MlVector3,MleDwpVector3>, _mleMemberRelease<MlVector3> },
+    { _mleMemberConvert<MlVector4,MleDwpVector4>, _mleMemberRelease<MlVector4> },
+    { _mleMemberConvert<MlTransform,MleDwpTransform>, _mleMemberRelease<MlTransform> },
+    { _mleMemberConvert<MlRotation,MleDwpRotation>, _mleMemberRelease<MlRotation> },
+    { _mleMemberString, _mleMemberFree }
+};
+
 MleActorMember::MleActorMember(const char *t,MlePropertyEntry *e)
 {
     m_type = MleDwpDatatype::findType(t);
@@ -436,6 +632,58 @@ MleActorMember::MleActorMember(const char *t,MlePropertyEntry *e)
     }
     
     m_entry = e;
+
+    /* Resolve the conversion kind once, by datatype name. */
+    static const struct { const char *name; MleActorMemberKind kind; } kinds[] =
+    {
+        { "FloatArray", MLE_MEMBER_FLOATARRAY },
+        { "IntArray", MLE_MEMBER_INTARRAY },
+        { "ScalarArray", MLE_MEMBER_SCALARARRAY },
+        { "Vector3Array", MLE_MEMBER_VECTOR3ARRAY },
+        { "MlVector2", MLE_MEMBER_VECTOR2 },
+        { "MlVector3", MLE_MEMBER_VECTOR3 },
+        { "MlVector4", MLE_MEMBER_VECTOR4 },
+        { "MlTransform", MLE_MEMBER_TRANSFORM },
+        { "MlRotation", MLE_MEMBER_ROTATION },
+        { "string", MLE_MEMBER_STRING }
+    };
+    m_kind = MLE_MEMBER_GENERIC;
+    if ( m_type )
+    {
+        for ( unsigned int i = 0; i < sizeof(kinds)/sizeof(kinds[0]); i++ )
+        {
+            if ( !strcmp(m_type->getName(),kinds[i].name) )
+            {
+                m_kind = kinds[i].kind;
+                break;
+            }
+        }
+    }
+}
+
+/*
+ * The datatypes are normally the same registered object; only fall
+ * back to comparing names when they are not.
+ */
+MlBoolean
+MleActorMember::matches(const MleDwpDatatype *type) const
+{
+    if ( type == m_type )
+        return TRUE;
+    return !strcmp(type->getName(),m_type->getName());
+}
+
+void *
+MleActorMember::convert(MleDwpDataUnion *value,MleActorMemberValue *buffer) const
+{
+    return (*g_memberConversions[m_kind].m_convert)(m_type,value,buffer);
+}
+
+void
+MleActorMember::release(void *pvalue) const
+{
+    if ( g_memberConversions[m_kind].m_release )
+        (*g_memberConversions[m_kind].m_release)(pvalue);
 }
 
 void *
@@ -451,6 +699,29 @@ MleActorMember::operator delete(void *p)
     mlFree(p);
 }
 
+MleActorMemberIter::MleActorMemberIter(MleActorClass *ac)
+{
+    m_table = ac->getFlatTable();
+    m_index = -1;
+    next();
+}
+
+int
+MleActorMemberIter::next(void)
+{
+    m_slot = NULL;
+    while ( ++m_index < m_table->getNumSlots() )
+    {
+        const MleActorMemberSlot *slot = m_table->getSlot(m_index);
+        if ( slot->m_name )
+        {
+            m_slot = slot;
+            return 1;
+        }
+    }
+    return 0;
+}
+
 void *
 MleActorMemberIter::operator new(size_t tSize)
 {
@@ -463,3 +734,378 @@ MleActorMemberIter::operator delete(void *p)
 {
     mlFree(p);
 }
+
+// Perfect hashing for MleActorMemberTable.
+//   A name's bucket is chosen by its hash alone; its slot by the hash
+//   mixed with the bucket's seed.  build() searches for seeds bucket
+//   by bucket, largest buckets first, until every name has a slot.
+
+/* The average number of names per bucket. */
+#define MLE_MEMBERTABLE_BUCKET_SIZE 4
+/* The number of seeds to try for a bucket before growing the table. */
+#define MLE_MEMBERTABLE_MAX_SEEDS 1024
+
+static unsigned int
+_mleMemberNameHash(const char *name)
+{
+    /* FNV-1a. */
+    unsigned int h = 2166136261u;
+    for ( const unsigned char *s = (const unsigned char *)name; *s; s++ )
+        h = (h ^ *s) * 16777619u;
+    return h;
+}
+
+static inline unsigned int
+_mleMemberSlotHash(unsigned int h,unsigned int seed)
+{
+    h ^= seed * 0x9e3779b9u;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+MleActorMemberTable::MleActorMemberTable(void)
+{
+    m_numMembers = 0;
+    m_numSlots = 0;
+    m_slots = NULL;
+    m_numBuckets = 0;
+    m_seeds = NULL;
+}
+
+MleActorMemberTable::~MleActorMemberTable()
+{
+    clear();
+}
+
+void
+MleActorMemberTable::clear(void)
+{
+    mlFree(m_slots);
+    mlFree(m_seeds);
+    m_numMembers = 0;
+    m_numSlots = 0;
+    m_slots = NULL;
+    m_numBuckets = 0;
+    m_seeds = NULL;
+}
+
+void
+MleActorMemberTable::build(int num,const char **names,const MleActorMember **members)
+{
+    clear();
+    if ( num <= 0 )
+        return;
+
+    /* Bucket chains and per-name hashes. */
+    unsigned int *hashes = (unsigned int *)mlMalloc(num*sizeof(unsigned int));
+    int *nextName = (int *)mlMalloc(num*sizeof(int));
+    int i;
+    for ( i = 0; i < num; i++ )
+        hashes[i] = _mleMemberNameHash(names[i]);
+
+    m_numBuckets = 1;
+    while ( m_numBuckets*MLE_MEMBERTABLE_BUCKET_SIZE < (unsigned int)num )
+        m_numBuckets <<= 1;
+    unsigned int bucketMask = m_numBuckets - 1;
+    int *firstName = (int *)mlMalloc(m_numBuckets*sizeof(int));
+    int *bucketSize = (int *)mlMalloc(m_numBuckets*sizeof(int));
+    int maxBucketSize = 0;
+    unsigned int b;
+    for ( b = 0; b < m_numBuckets; b++ )
+    {
+        firstName[b] = -1;
+        bucketSize[b] = 0;
+    }
+    for ( i = 0; i < num; i++ )
+    {
+        b = hashes[i] & bucketMask;
+        nextName[i] = firstName[b];
+        firstName[b] = i;
+        if ( ++bucketSize[b] > maxBucketSize )
+            maxBucketSize = bucketSize[b];
+    }
+
+    /* Start at a load of at most 4/5 and double until the seeds fit. */
+    m_numSlots = 4;
+    while ( m_numSlots*4 < (unsigned int)num*5 )
+        m_numSlots <<= 1;
+    m_seeds = (unsigned int *)mlMalloc(m_numBuckets*sizeof(unsigned int));
+
+    MlBoolean placed = FALSE;
+    while ( ! placed )
+    {
+        unsigned int slotMask = m_numSlots - 1;
+        m_slots = (MleActorMemberSlot *)mlMalloc(m_numSlots*sizeof(MleActorMemberSlot));
+        memset(m_slots,0,m_numSlots*sizeof(MleActorMemberSlot));
+        memset(m_seeds,0,m_numBuckets*sizeof(unsigned int));
+
+        placed = TRUE;
+        for ( int size = maxBucketSize; placed && (size > 0); size-- )
+        {
+            for ( b = 0; placed && (b < m_numBuckets); b++ )
+            {
+                if ( bucketSize[b] != size )
+                    continue;
+
+                /* Find a seed that sends the whole bucket to empty slots. */
+                unsigned int seed;
+                for ( seed = 1; seed <= MLE_MEMBERTABLE_MAX_SEEDS; seed++ )
+                {
+                    int n;
+                    for ( n = firstName[b]; n >= 0; n = nextName[n] )
+                    {
+                        MleActorMemberSlot *slot =
+                            &m_slots[_mleMemberSlotHash(hashes[n],seed) & slotMask];
+                        if ( slot->m_name )
+                            break;
+                        slot->m_name = names[n];
+                        slot->m_member = members[n];
+                        slot->m_hash = hashes[n];
+                    }
+                    if ( n < 0 )
+                        break;
+
+                    /* Collision; take back this bucket's names. */
+                    for ( int m = firstName[b]; m != n; m = nextName[m] )
+                        m_slots[_mleMemberSlotHash(hashes[m],seed) & slotMask].m_name = NULL;
+                }
+
+                if ( seed <= MLE_MEMBERTABLE_MAX_SEEDS )
+                    m_seeds[b] = seed;
+                else
+                    placed = FALSE;
+            }
+        }
+
+        if ( ! placed )
+        {
+            mlFree(m_slots);
+            m_numSlots <<= 1;
+        }
+    }
+    m_numMembers = (unsigned int)num;
+
+    mlFree(hashes);
+    mlFree(nextName);
+    mlFree(firstName);
+    mlFree(bucketSize);
+}
+
+const MleActorMember *
+MleActorMemberTable::find(const char *name) const
+{
+    if ( (m_numMembers == 0) || (name == NULL) )
+        return NULL;
+
+    unsigned int h = _mleMemberNameHash(name);
+    unsigned int seed = m_seeds[h & (m_numBuckets - 1)];
+    const MleActorMemberSlot *slot = &m_slots[_mleMemberSlotHash(h,seed) & (m_numSlots - 1)];
+    if ( slot->m_name && (slot->m_hash == h) && !strcmp(slot->m_name,name) )
+        return slot->m_member;
+    return NULL;
+}
+
+void *
+MleActorMemberTable::operator new(size_t tSize)
+{
+    void *p = mlMalloc(tSize);
+    return p;
+}
+
+void
+MleActorMemberTable::operator delete(void *p)
+{
+    mlFree(p);
+}
+
+MleActorPlan::MleActorPlan(const MleActorClass *ac,int maxSteps)
+{
+    m_class = ac;
+    m_numSteps = 0;
+    m_maxSteps = (maxSteps > 0) ? maxSteps : 0;
+    m_steps = (MleActorPlanStep *)mlMalloc((m_maxSteps + 1)*sizeof(MleActorPlanStep));
+    m_values = (MleActorMemberValue *)mlMalloc((m_maxSteps + 1)*sizeof(MleActorMemberValue));
+    m_generation = MleActorClass::g_memberGeneration;
+    m_removals = MleActorClass::g_memberRemovals;
+    m_templateGeneration = MleActorClass::g_templateGeneration;
+}
+
+MleActorPlan::~MleActorPlan()
+{
+    // The members are only safe to use if none have been removed since.
+    if ( m_removals == MleActorClass::g_memberRemovals )
+    {
+        for ( int i = 0; i < m_numSteps; i++ )
+            m_steps[i].m_member->release(m_steps[i].m_value);
+    }
+
+    mlFree(m_steps);
+    mlFree(m_values);
+}
+
+int
+MleActorPlan::addProperty(const char *name,MleDwpDataUnion *value)
+{
+    MLE_ASSERT(m_numSteps < m_maxSteps);
+    MLE_ASSERT(value && value->m_datatype);
+
+    const MleActorMember *member = m_class->findMember(name);
+    if ( member == NULL )
+    {
+        printf("MleActorPlan: property %s not present on %s.\n",
+            name,((MleActorClass *)m_class)->getName());
+        return 1;
+    }
+
+    if ( ! member->matches(value->m_datatype) )
+    {
+        printf("MleActorPlan: type mismatch in setting property %s on %s (%s and %s).\n",
+            name,((MleActorClass *)m_class)->getName(),
+            value->m_datatype->getName(),
+            member->getType()->getName());
+        return 1;
+    }
+
+    MleActorPlanStep *step = &m_steps[m_numSteps];
+    step->m_member = member;
+    step->m_value = member->convert(value,&m_values[m_numSteps]);
+    m_numSteps++;
+
+    return 0;
+}
+
+void
+MleActorPlan::apply(MleActor *actor) const
+{
+    MLE_ASSERT(m_generation == MleActorClass::g_memberGeneration);
+
+    for ( int i = 0; i < m_numSteps; i++ )
+    {
+        MlePropertyEntry *entry = m_steps[i].m_member->getEntry();
+        entry->setProperty(actor,entry->name,(unsigned char *)m_steps[i].m_value);
+    }
+}
+
+void *
+MleActorPlan::operator new(size_t tSize)
+{
+    void *p = mlMalloc(tSize);
+    return p;
+}
+
+void
+MleActorPlan::operator delete(void *p)
+{
+    mlFree(p);
+}
+
+const MleActorPlan *
+MleActorClass::findPlan(const void *tmpl)
+{
+    if ( m_plans == NULL )
+        return NULL;
+
+    MleActorPlan *plan = (MleActorPlan *)m_plans->find(tmpl);
+    if ( plan &&
+         ((plan->getGeneration() != g_memberGeneration) ||
+          (plan->getTemplateGeneration() != g_templateGeneration)) )
+    {
+        // Built against members that may no longer exist, or from
+        // a template that may have changed or been freed since.
+        m_plans->remove(tmpl);
+        delete plan;
+        plan = NULL;
+    }
+    return plan;
+}
+
+void
+MleActorClass::addPlan(const void *tmpl,MleActorPlan *plan)
+{
+    if ( m_plans == NULL )
+        m_plans = new MleFlatPtrDict;
+
+    delete (MleActorPlan *)m_plans->find(tmpl);
+    m_plans->set(tmpl,plan);
+}
+
+void
+MleActorClass::deletePlans(void)
+{
+    if ( m_plans == NULL )
+        return;
+
+    for ( int i = m_plans->next(-1); i >= 0; i = m_plans->next(i) )
+        delete (MleActorPlan *)m_plans->getValue(i);
+    m_plans->clear();
+}
+
+void
+MleActorClass::flushPlans(void)
+{
+    MleDwpDictIter iter(g_registry);
+    MleActorClass *ac;
+    while ( (ac = (MleActorClass *)iter.getValue()) )
+    {
+        ac->deletePlans();
+        iter.next();
+    }
+}
+
+const MleActorTransformMembers *
+MleActorClass::getTransformMembers(void) const
+{
+    if ( m_transformGeneration == g_memberGeneration )
+        return &m_transformMembers;
+
+    // Resolve the well-known representations MleActor supports,
+    // caching them behind the const interface.
+    MleActorClass *self = (MleActorClass *)this;
+    MleActorTransformMembers *tm = &self->m_transformMembers;
+    const MleActorMember *member;
+    const MleDwpDatatype *type;
+
+    member = findMember("transform");
+    type = member ? member->getType() : NULL;
+    tm->m_transform = (type && type->isa(MleDwpTransform::typeId)) ? member : NULL;
+
+    member = findMember("position");
+    type = member ? member->getType() : NULL;
+    tm->m_position3 = (type && type->isa(MleDwpVector3::typeId)) ? member : NULL;
+    tm->m_position2 = (type && ! tm->m_position3 &&
+        type->isa(MleDwpVector2::typeId)) ? member : NULL;
+
+    member = findMember("translation");
+    type = member ? member->getType() : NULL;
+    tm->m_translation3 = (type && type->isa(MleDwpVector3::typeId)) ? member : NULL;
+    tm->m_translation2 = (type && ! tm->m_translation3 &&
+        type->isa(MleDwpVector2::typeId)) ? member : NULL;
+
+    member = findMember("scale");
+    type = member ? member->getType() : NULL;
+    tm->m_scale3 = (type && type->isa(MleDwpVector3::typeId)) ? member : NULL;
+    tm->m_scale1 = (type && type->isa(MleDwpScalar::typeId)) ? member : NULL;
+
+    member = findMember("orientation");
+    type = member ? member->getType() : NULL;
+    tm->m_orientation = (type && type->isa(MleDwpRotation::typeId)) ? member : NULL;
+
+    member = findMember("rotation");
+    type = member ? member->getType() : NULL;
+    tm->m_rotation = (type && type->isa(MleDwpVector3::typeId)) ? member : NULL;
+
+    tm->m_capabilities = 0;
+    if ( tm->m_position3 || tm->m_position2 || tm->m_translation3 || tm->m_translation2 )
+        tm->m_capabilities |= MLE_ACTOR_TRANSLATION;
+    if ( tm->m_orientation || tm->m_rotation )
+        tm->m_capabilities |= MLE_ACTOR_ROTATION;
+    if ( tm->m_transform )
+        tm->m_capabilities |= MLE_ACTOR_AFFINE;
+
+    self->m_transformGeneration = g_memberGeneration;
+    return tm;
+}
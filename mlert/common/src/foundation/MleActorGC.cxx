@@ -49,6 +49,7 @@
 // Include standard header files.
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 #ifdef __MWERKS__
 #include <SIOUX.h>
 #endif
@@ -60,6 +61,7 @@
 
 #include "mle/MleActor.h"
 #include "mle/MleActorGC.h"
+#include "mle/MleChunkTrace.h"
 #include "mle/MleOpcode.h"
 #include "mle/MleRole.h"
 #include "mle/MleSet.h"
@@ -71,52 +73,28 @@
 #include "mle/ppinput.h"
 
 
-/* Dynamically allocated array of actors. */
-struct MleGCRegistry *g_actorRegistry;
+// Trace points for the chunk parser.  They cost a flag test unless
+//   MleChunkTrace has been enabled; offsets are relative to the chunk.
+#define traceOpcode(a) \
+    do { if (MleChunkTrace::g_enabled) MleChunkTrace::record(MLE_TRACE_OPCODE, \
+        a, 0, (int) (streamPtrRef - streamStart) - 1); } while (0)
+#define traceIndex(a) \
+    do { if (MleChunkTrace::g_enabled) MleChunkTrace::record(MLE_TRACE_INDEX, \
+        0, a, (int) (streamPtrRef - streamStart)); } while (0)
+#define traceData(a) \
+    do { if (MleChunkTrace::g_enabled) MleChunkTrace::record(MLE_TRACE_DATA, \
+        0, a, (int) (streamPtrRef - streamStart)); } while (0)
 
-// This is an array of set pointers that correspond to the actors loaded
-//   in a group.  It is kept so that mlLoadGroup can set MleSet::currentSet
-//   before calling the actor init() function.  It is allocated for each
-//   group load in chunkInitialization() and deallocated in mlLoadGroup().
-MleSet **_mleSetArray;
 
-// This is an array of ints that flags whether an actor's role has
-//   been attached.  Zero means that it has not.  This array is used
-//   to attach roles not specifically given a parent to their set.
-static int *g_attachmentArray;
-
-#if defined(MLE_DEBUG)
-/* end of registry */
-struct MleGCRegistry* g_actorRegistryEnd;
-#endif
-
-struct MleGCRegistry* g_actorRegistryPtr;
-
-#define DEBUG_PRINT
-#ifdef DEBUG_PRINT
-    #include <stdio.h>
-
-    #define stdOutOpcode(a) printf("\n"#a" "); fflush(stdout)
-    //#define stdOutIndex(a) printf("index=%ld ", a); fflush(stdout)
-    #define stdOutIndex(a) printf("index=%d ", a); fflush(stdout)
-    #define stdOutRawByte(a) printf("raw=x%02x ", a); fflush(stdout)
-#else
-    #define stdOutOpcode(a)
-    #define stdOutIndex(a)
-    #define stdOutRawByte(a)
-#endif
-
-
-void chunkInitialization(int sizeofRegistry)
+void chunkInitialization(MleLoadContext *context, int sizeofRegistry)
 {
-    g_actorRegistry = new MleGCRegistry[sizeofRegistry];
-    g_actorRegistryPtr = &g_actorRegistry[0];
+    context->m_registry = new MleGCRegistry[sizeofRegistry];
+    context->m_size = sizeofRegistry;
+    context->m_numActors = 0;
 
-    _mleSetArray = new MleSet*[sizeofRegistry];
-    g_attachmentArray = new int[sizeofRegistry];
-#if defined(MLE_DEBUG)
-    g_actorRegistryEnd = &g_actorRegistry[sizeofRegistry];
-#endif
+    context->m_sets = new MleSet*[sizeofRegistry];
+    context->m_attached = new int[sizeofRegistry];
+    context->m_currentSet = NULL;
 }
 
 
@@ -130,6 +108,24 @@ nextStreamByte(unsigned char *&streamPtrRef,
 }
 
 
+// Fixed size property values that are misaligned in the stream are
+//   staged in a local buffer of this size and alignment, or in an
+//   mlMalloc()ed one if they are larger.
+#define MLE_STAGED_PROPERTY_SIZE 64
+#define MLE_STAGED_PROPERTY_ALIGNMENT 16
+
+// Return the alignment a property value of the given length needs.  A
+//   type's size is a multiple of its alignment, so the lowest set bit of
+//   the length bounds it.
+static INLINE int propertyAlignment(int length)
+{
+    int align = length & -length;
+    if (align == 0 || align > MLE_STAGED_PROPERTY_ALIGNMENT)
+        align = MLE_STAGED_PROPERTY_ALIGNMENT;
+    return align;
+}
+
+
 int readInt(unsigned char *&streamPtrRef,
             unsigned char *streamStart,
             unsigned char *streamEnd)
@@ -155,11 +151,11 @@ readIndex(unsigned char *&streamPtrRef,
     
     while ((byte = nextStreamByte(streamPtrRef, streamStart, streamEnd)) >= 0)
     {
-		//MLE_ASSERT((value & (signed int) 0x80000000 >> valueBits - 1) == 0);
-        MLE_ASSERT((value & (signed int)(0x80000000 >> valueBits) - 1) == 0);
+        // Another group of bits must not overflow the value.
+        MLE_ASSERT((value >> (31 - valueBits)) == 0);
         value = (value << valueBits) | byte;
     }
-    stdOutIndex(value);
+    traceIndex(value);
     MLE_ASSERT(value >= 0);
     streamPtrRef--; /* Back up one, since while loop always over-advances by one. */
     //fprintf(stdout, "MleActorGC: backing up stream 1 byte.\n");
@@ -169,68 +165,158 @@ readIndex(unsigned char *&streamPtrRef,
 }
 
 
-static void registerActor(MleActor* actor, int index)
+void registerActor(MleLoadContext *context, MleActor* actor, int index)
 {
-#if defined(MLE_DEBUG)
-    MLE_ASSERT(g_actorRegistryPtr < g_actorRegistryEnd);
-#endif
-    g_actorRegistryPtr->m_actor = actor;
-    g_actorRegistryPtr->m_index = index;
-    g_actorRegistryPtr++;
+    MLE_ASSERT(context->m_numActors < context->m_size);
+    int actorIndex = context->m_numActors++;
+    MleGCRegistry *entry = &context->m_registry[actorIndex];
+    entry->m_actor = actor;
+    entry->m_role = NULL;
+    entry->m_index = index;
+
+    // Initialize state that the actor may use.
+    context->m_sets[actorIndex] = NULL;
+    context->m_attached[actorIndex] = 0;
 }
 
 
-static INLINE MleActor* createActor(int index)
+static INLINE MleActor* createActor(MleLoadContext *context, int index)
 {
     MleActor* newActor;
     
     MLE_ASSERT(index >= 0 && index < mlRTActorClassLength);
     newActor = (*mlRTActorClass[index].constructor)();
-    registerActor(newActor, index); /* use the index of the actor for future reference */
+    registerActor(context, newActor, index); /* use the index of the actor for future reference */
     return newActor;
 }
 
 
 #if defined(MLE_DEBUG)
-static INLINE int getCurrentActorSize(void)
+static INLINE int getCurrentActorSize(MleLoadContext *context)
 {
-    return mlRTActorClass[g_actorRegistryPtr[-1].m_index].size;
+    return mlRTActorClass[context->m_registry[context->m_numActors - 1].m_index].size;
 }
 #endif /* MLE_DEBUG */
 
 
-static INLINE MleRole* createRole(MleActor* currentActor, int index)
+MleRole* createRole(MleLoadContext *context, MleActor* currentActor,
+                    MleRole *(*constructor)(MleActor *a))
 {
     MleRole* newRole;
-    
-    MLE_ASSERT(index >= 0 && index < mlRTRoleClassLength);
-    newRole = (*mlRTRoleClass[index].constructor)(currentActor);
-    g_actorRegistryPtr[-1].m_role = newRole;
+
+    // Role constructors find their set through MleSet::g_currentSet;
+    //   it is only borrowed for as long as the constructor runs.
+    MleSet *previousSet = MleSet::g_currentSet;
+    MleSet::g_currentSet = context->m_currentSet;
+    newRole = (*constructor)(currentActor);
+    MleSet::g_currentSet = previousSet;
+
+    context->m_registry[context->m_numActors - 1].m_role = newRole;
     return newRole;
 }
 
 
-void parseStream(unsigned char *&streamPtrRef,
-                 unsigned char *streamStart,
-                 unsigned char *streamEnd,
-                 MleChunkType chunkType)
+void loadProperty(MleObject *object, MleRTPropertyEntry *propertyEntry,
+                  unsigned char *value, int length)
+{
+    // The setters copy the value out of the buffer they are given, so
+    // it is handed to them in place.  Only a value left misaligned for
+    // its type is staged first.
+    alignas(MLE_STAGED_PROPERTY_ALIGNMENT)
+        unsigned char staged[MLE_STAGED_PROPERTY_SIZE];
+    unsigned char *propertyValue = value;
+    unsigned char *allocated = NULL;
+    if (((size_t) value & (propertyAlignment(length) - 1)) != 0)
+    {
+        if (length <= MLE_STAGED_PROPERTY_SIZE)
+            propertyValue = staged;
+        else
+            propertyValue = allocated = (unsigned char *)mlMalloc(length);
+        memcpy(propertyValue, value, length);
+    }
+
+    // Adopting a fixed size value calls its setter directly,
+    // skipping the lookup by name in setProperty.
+    if (propertyEntry->adoptProperty)
+        propertyEntry->adoptProperty(object, propertyValue, 1);
+    else
+        propertyEntry->setProperty(object, propertyEntry->name, propertyValue);
+
+    if (allocated)
+        mlFree(allocated);
+}
+
+
+void loadDynamicProperty(MleObject *object, MleRTPropertyEntry *propertyEntry,
+                         unsigned char *value, int length)
+{
+    if (propertyEntry->adoptProperty)
+    {
+        // The property takes ownership of a copy of the data.
+        unsigned char *propertyValue = (unsigned char *)mlMalloc(length);
+        memcpy(propertyValue, value, length);
+        propertyEntry->adoptProperty(object, propertyValue, length);
+    }
+    else
+    {
+        // The setter makes its own copy, straight from the value.
+        propertyEntry->setProperty(object, propertyEntry->name, value);
+    }
+}
+
+
+void loadArrayProperty(MleObject *object, MleRTPropertyEntry *propertyEntry,
+                       unsigned char *elements, int numElements, int elementLength)
+{
+    if (propertyEntry->adoptProperty)
+    {
+        // The property copies the elements into an array of its
+        // own element type and swaps it in.
+        propertyEntry->adoptProperty(object, elements, numElements);
+    }
+    else
+    {
+        int bytesToCopy = numElements * elementLength;
+        char * buf = new char[bytesToCopy];
+        memcpy(buf, elements, bytesToCopy);
+
+        // The array wraps buf; the property element type has
+        // the same layout, as the setters have always assumed.
+        // The setter copies the elements.
+        MleArray<char> propertyValue(numElements,buf);
+        propertyEntry->setProperty(object, propertyEntry->name, (unsigned char *)&propertyValue);
+    }
+}
+
+
+void MleChunkVisitor::createSet(int /*setIndex*/)
+{
+    // Group chunks have no sets.
+    MLE_ASSERT(0);
+}
+
+
+void decodeStream(MleChunkVisitor *visitor,
+                  unsigned char *&streamPtrRef,
+                  unsigned char *streamStart,
+                  unsigned char *streamEnd,
+                  MleChunkType chunkType)
 {
-    //int propertyOffset = -1;
-	MleRTPropertyEntry *propertyEntry;
+    MleRTPropertyEntry *propertyEntry = NULL;
     int propertyLength = 0;
-    MleActor* currentActor = NULL;
-    MleRole* currentRole = NULL;
-    MleSet* currentSet = NULL;
     int index;
-    
-    int actorIndex = -1;    // index of actor within the group
+
+    int numActors = 0;      // actors of the group begun so far
 
     // opcode arguments.
     int setIndex = -1;
     int parentActorIndex = -1;
     int childActorIndex = -1;
 
-    do {
+    // A chunk may end without an end opcode, so the end is checked
+    //   before each opcode is read.
+    while (streamPtrRef < streamEnd)
+    {
         switch (nextStreamByte(streamPtrRef, streamStart, streamEnd))
         {
 // The ActorSet functionality has been superceded.  Sets are now
@@ -240,261 +326,320 @@ void parseStream(unsigned char *&streamPtrRef,
 //            currentActor = NULL;
 //            currentRole = NULL;
 //        }
-//        stdOutOpcode(beginActorSetOpcode);
+//        traceOpcode(beginActorSetOpcode);
 //        index = readIndex(streamPtrRef, streamStart, streamEnd);
 //        currentSet = mlLoadSet(index);
 //        MleSet::currentSet = currentSet;
 //        break;
 
           case createActorOpcode:
-            // Increment the actor count.
-            actorIndex++;
-
-            stdOutOpcode(createActorOpcode);
+            traceOpcode(createActorOpcode);
             index = readIndex(streamPtrRef, streamStart, streamEnd);
-            currentActor = createActor(index);
+            MLE_ASSERT(index >= 0 && index < mlRTActorClassLength);
+            visitor->createActor(index);
 
-            // Initialize state that the actor may use.
-            _mleSetArray[actorIndex] = NULL;
-            g_attachmentArray[actorIndex] = 0;
-            currentRole = NULL;
+            numActors++;
             setIndex = -1;
             parentActorIndex = -1;
             break;
 
           case setSetOpcode:
-            stdOutOpcode(setSetOpcode);
+            traceOpcode(setSetOpcode);
             index = readIndex(streamPtrRef, streamStart, streamEnd);
 
             setIndex = index;
             break;
 
           case bindRoleOpcode:
-            stdOutOpcode(bindRoleOpcode);
+            traceOpcode(bindRoleOpcode);
 
-            MLE_ASSERT(currentActor != NULL);
+            MLE_ASSERT(numActors > 0);
             MLE_ASSERT(setIndex >= 0);
 
-            // Read the arguments, role class index and set index.
+            // Read the role class index; the set index came before.
             index = readIndex(streamPtrRef, streamStart, streamEnd);
-
-            // Set the current set, creating it if necessary
-            //   mlLoadSet() just returns the pointer if it has already
-            //   been created.  We also remember the set as being used
-            //   for this actor.
-            MleSet::g_currentSet =
-                _mleSetArray[actorIndex] =
-            mlLoadSet(setIndex);
-
-            // Now create the role.
-            currentRole = createRole(currentActor, index);
+            MLE_ASSERT(index >= 0 && index < mlRTRoleClassLength);
+            visitor->bindRole(setIndex, index);
             break;
 
           case parentRoleOpcode:
-            stdOutOpcode(parentRoleOpcode);
+            traceOpcode(parentRoleOpcode);
             index = readIndex(streamPtrRef, streamStart, streamEnd);
 
             parentActorIndex = index;
             break;
 
           case childRoleOpcode:
-            stdOutOpcode(parentRoleOpcode);
-            MLE_ASSERT(currentSet != NULL);
+            traceOpcode(childRoleOpcode);
+            MLE_ASSERT(parentActorIndex >= 0 && parentActorIndex < numActors);
 
             // Read child actor index.
             childActorIndex = readIndex(streamPtrRef, streamStart, streamEnd);
+            MLE_ASSERT(childActorIndex >= 0 && childActorIndex < numActors);
 
-            // Verify that the role has not already been attached.
-            MLE_ASSERT(g_attachmentArray[childActorIndex] != 0);
-
-            // Verify that the sets for these actors match.
-            MLE_ASSERT(_mleSetArray[parentActorIndex] == _mleSetArray[childActorIndex]);
-
-            // And do the attachment.
-            _mleSetArray[parentActorIndex]->attach(
-            g_actorRegistry[parentActorIndex].m_actor->getRole(),
-            g_actorRegistry[childActorIndex].m_actor->getRole());
-
-            // Mark the actor/role as having been attached.
-            g_attachmentArray[childActorIndex] = 1;
+            visitor->attachRole(parentActorIndex, childActorIndex);
             parentActorIndex = -1;
             childActorIndex = -1;
             break;
 
           case setPropertyOffsetOpcode:
-            stdOutOpcode(setPropertyOffsetOpcode);
+            traceOpcode(setPropertyOffsetOpcode);
             index = readIndex(streamPtrRef, streamStart, streamEnd);
             if (chunkType == MLE_CHUNK_GROUP)
             {
                 MLE_ASSERT(index >= 0 && index < mlRTActorPropertyLength);
-                //propertyOffset = mlRTActorProperties[index].offset;
                 propertyEntry = &mlRTActorProperties[index];
             }
             else if (chunkType == MLE_CHUNK_SET)
             {
                 MLE_ASSERT(index >= 0 && index < mlRTSetPropertyLength);
-                //propertyOffset = mlRTSetProperties[index].offset;
                 propertyEntry = &mlRTSetProperties[index];
             }
             break;
 
           case setPropertyLengthOpcode:
-            stdOutOpcode(setPropertyLengthOpcode);
+            traceOpcode(setPropertyLengthOpcode);
             propertyLength = readIndex(streamPtrRef, streamStart, streamEnd);
             break;
 
           case copyPropertyOpcode:
-            stdOutOpcode(copyPropertyOpcode);
-            {
-                int bytesToCopy = propertyLength;
-            	unsigned char *propertyValue = (unsigned char *)mlMalloc(bytesToCopy);
-
-#if defined(MLE_DEBUG)
-            	// TBD - fix this now that offsetof is no longer being used.
-                if (chunkType == MLE_CHUNK_GROUP)
-                {
-                    MLE_ASSERT(currentActor != NULL && getCurrentActorSize() > 0);
-                    MLE_ASSERT(propertyEntry != NULL);
-                    MLE_ASSERT(propertyLength > 0 && propertyLength <= getCurrentActorSize());
-                }
-#endif
-                unsigned char *propertyPtr = propertyValue;
-                while (--bytesToCopy >= 0)
-                {
-                    stdOutRawByte(*streamPtrRef);
-                    *propertyPtr++ = nextStreamByte(streamPtrRef, streamStart,
-                                                    streamEnd);
-                }
-
-                if(chunkType == MLE_CHUNK_GROUP)
-                    //propertyPtr = &((unsigned char*) currentActor)[propertyOffset];
-                	propertyEntry->setProperty(currentActor, propertyEntry->name, propertyValue);
-                else if(chunkType == MLE_CHUNK_SET)
-                    //propertyPtr = &((unsigned char*) currentSet)[propertyOffset];
-                    propertyEntry->setProperty(currentSet, propertyEntry->name, propertyValue);
-
-                // Free temporary storage space.
-                mlFree(propertyValue);
-            }
+            traceOpcode(copyPropertyOpcode);
+            MLE_ASSERT(propertyEntry != NULL);
+            traceData(propertyLength);
+            MLE_ASSERT(propertyLength >= 0 && streamEnd - streamPtrRef >= propertyLength);
+
+            // The value is handed over in place in the chunk.
+            visitor->setProperty(propertyEntry, streamPtrRef, propertyLength);
+            streamPtrRef += propertyLength;
             break;
 
           case copyDynamicPropertyOpcode:
+            traceOpcode(copyDynamicPropertyOpcode);
             {
                 int bytesToCopy = readInt(streamPtrRef, streamStart, streamEnd);
-                unsigned char *propertyValue = (unsigned char *)mlMalloc(bytesToCopy);
+                MLE_ASSERT(propertyEntry != NULL);
+                traceData(bytesToCopy);
+                MLE_ASSERT(bytesToCopy >= 0 && streamEnd - streamPtrRef >= bytesToCopy);
 
-#if defined(MLE_DEBUG)
-                if (chunkType == MLE_CHUNK_GROUP)
-                {
-                    MLE_ASSERT((currentActor != NULL) &&  (getCurrentActorSize() > 0));
-                    MLE_ASSERT(propertyEntry != NULL);
-                }
-#endif
-                unsigned char *propertyPtr = propertyValue;
-                while (--bytesToCopy >= 0)
-                {
-                    stdOutRawByte(*streamPtrRef);
-                    *propertyPtr++ = nextStreamByte(streamPtrRef, streamStart,
-                                                    streamEnd);
-                }
-
-                if(chunkType == MLE_CHUNK_GROUP)
-                    //propertyPtr = &((unsigned char**) currentActor)[propertyOffset];
-        	        propertyEntry->setProperty(currentActor, propertyEntry->name, propertyValue);
-                else if(chunkType == MLE_CHUNK_SET)
-                    //propertyPtr = &((unsigned char**) currentSet)[propertyOffset];
-                    propertyEntry->setProperty(currentSet, propertyEntry->name, propertyValue);
-
-                // Do NOT free temporary storage space, since it is not temporary!
-                //mlFree(propertyValue);
+                visitor->setDynamicProperty(propertyEntry, streamPtrRef, bytesToCopy);
+                streamPtrRef += bytesToCopy;
             }
             break;
 
           case copyArrayPropertyOpcode:
+            traceOpcode(copyArrayPropertyOpcode);
             {
-                //MleArray<char> * propertyPtr = (MleArray<char> *)&((char *) currentActor)[propertyOffset];
-                MleArray<char> propertyValue;
-
-#if defined(MLE_DEBUG)
-                MLE_ASSERT(currentActor != NULL &&  getCurrentActorSize() > 0);
-                MLE_ASSERT(propertyEntry != NULL);
-#endif
-        
                 int numElements = readInt(streamPtrRef, streamStart, streamEnd);
                 int bytesToCopy = numElements * propertyLength;
-                char * buf = new char[bytesToCopy];
-                MleArray<char> charArray(numElements,buf);
-                while (--bytesToCopy >= 0)
-                {
-                    stdOutRawByte(*streamPtrRef);
-                    *buf++ = nextStreamByte(streamPtrRef, streamStart, streamEnd);
-                }
-                propertyValue = charArray;
-
-                if(chunkType == MLE_CHUNK_GROUP)
-        	        propertyEntry->setProperty(currentActor, propertyEntry->name, (unsigned char *)&propertyValue);
-                else if(chunkType == MLE_CHUNK_SET)
-                    propertyEntry->setProperty(currentSet, propertyEntry->name, (unsigned char *)&propertyValue);
-
-                MleArray<char> nulArray;
-                charArray = nulArray;
+                MLE_ASSERT(propertyEntry != NULL);
+                traceData(bytesToCopy);
+                MLE_ASSERT(bytesToCopy >= 0 && streamEnd - streamPtrRef >= bytesToCopy);
+
+                visitor->setArrayProperty(propertyEntry, streamPtrRef,
+                    numElements, propertyLength);
+                streamPtrRef += bytesToCopy;
             }
             break;
 
           case endActorGroupOpcode:
-            stdOutOpcode(endActorGroupOpcode);
+            traceOpcode(endActorGroupOpcode);
             streamPtrRef = streamEnd;
             break;
 
           case copyMediaRefOpcode:
-            {
-                stdOutOpcode(copyMediaRefOpcode);
-                //*(int*) &((char*) currentActor)[propertyOffset] = readIndex(streamPtrRef, streamStart, streamEnd);
-                int mrefIndex = readIndex(streamPtrRef, streamStart, streamEnd);
-                propertyEntry->setProperty(currentActor, propertyEntry->name, (unsigned char *)&mrefIndex);
-            }
+            traceOpcode(copyMediaRefOpcode);
+            MLE_ASSERT(propertyEntry != NULL);
+            index = readIndex(streamPtrRef, streamStart, streamEnd);
+            visitor->setMediaRef(propertyEntry, index);
             break;
 
           case createSetOpcode:
-            stdOutOpcode(createSetOpcode);
+            traceOpcode(createSetOpcode);
             index = readIndex(streamPtrRef, streamStart, streamEnd);
-            currentSet = (*mlRTSet[index].constructor)();
-            mlRTSet[index].ptr = currentSet;
-            MleSet::g_currentSet = currentSet;
+            MLE_ASSERT(index >= 0 && index < mlRTSetLength);
+            visitor->createSet(index);
             break;
 
           case endSetOpcode:
-            stdOutOpcode(endSetOpcode);
+            traceOpcode(endSetOpcode);
             break;
 
           default:
             MLE_ASSERT(0);
         }
-    } while (streamPtrRef < streamEnd);
+    }
+}
+
+
+// The visitor of parseStream(): it creates each object as the chunk
+//   names it, registering a group's actors in the load context.
+class MleStreamLoader : public MleChunkVisitor
+{
+  public:
 
-    // Now finish up by doing leftover role attachments.
-    if ( chunkType == MLE_CHUNK_GROUP )
+    MleStreamLoader(MleLoadContext *context, MleChunkType chunkType)
+      : m_context(context),
+        m_chunkType(chunkType),
+        m_currentActor(NULL),
+        m_currentSet(NULL),
+        m_actorIndex(-1)
+    {}
+
+    virtual void createActor(int classIndex)
     {
-        // Increment actor counter (it started at -1).
-        actorIndex++;
+        m_actorIndex++;
+        m_currentActor = ::createActor(m_context, classIndex);
+    }
 
-        // Loop through all the actors.
-        for ( int i = 0; i < actorIndex; i++ )
+    virtual void bindRole(int setIndex, int roleIndex)
+    {
+        MLE_ASSERT(m_currentActor != NULL);
+
+        // Set the current set, creating it if necessary
+        //   mlLoadSet() just returns the pointer if it has already
+        //   been created.  We also remember the set as being used
+        //   for this actor.
+        m_context->m_currentSet =
+            m_context->m_sets[m_actorIndex] =
+        mlLoadSet(setIndex);
+
+        // Now create the role; without its set, the actor has none.
+        if (m_context->m_currentSet != NULL)
+            createRole(m_context, m_currentActor, mlRTRoleClass[roleIndex].constructor);
+    }
+
+    virtual void attachRole(int parentIndex, int childIndex)
+    {
+        // Verify that the role has not already been attached.
+        MLE_ASSERT(m_context->m_attached[childIndex] == 0);
+
+        // Verify that the sets for these actors match.
+        MLE_ASSERT(m_context->m_sets[parentIndex] == m_context->m_sets[childIndex]);
+
+        // Roles whose set could not be loaded were not created.
+        if (m_context->m_sets[parentIndex] == NULL)
+            return;
+
+        // And do the attachment.
+        m_context->m_sets[parentIndex]->attach(
+        m_context->m_registry[parentIndex].m_actor->getRole(),
+        m_context->m_registry[childIndex].m_actor->getRole());
+        m_context->m_registry[childIndex].m_actor->getRole()->m_parent =
+            m_context->m_registry[parentIndex].m_actor->getRole();
+
+        // Mark the actor/role as having been attached.
+        m_context->m_attached[childIndex] = 1;
+    }
+
+    virtual void setProperty(MleRTPropertyEntry *propertyEntry,
+        unsigned char *value, int length)
+    {
+#if defined(MLE_DEBUG)
+        // TBD - fix this now that offsetof is no longer being used.
+        if (m_chunkType == MLE_CHUNK_GROUP)
         {
-            // See if the role has been attached.
-            if ( g_attachmentArray[i] == 0 &&
-                g_actorRegistry[i].m_actor->getRole() )
-            {
-                // If not, put it on the set.
-                _mleSetArray[i]->attach(
-                    NULL,g_actorRegistry[i].m_actor->getRole());
-            }
+            MLE_ASSERT(m_currentActor != NULL && getCurrentActorSize(m_context) > 0);
+            MLE_ASSERT(length > 0 && length <= getCurrentActorSize(m_context));
         }
+#endif
+        MleObject *object = getObject();
+        if (object)
+            loadProperty(object, propertyEntry, value, length);
+    }
 
-        // Have to be careful here - can't move this outside the if
-        //   clause because parseStream may be called recursively to
-        //   load sets.
-        delete g_attachmentArray;
-        g_attachmentArray = NULL;
+    virtual void setDynamicProperty(MleRTPropertyEntry *propertyEntry,
+        unsigned char *value, int length)
+    {
+#if defined(MLE_DEBUG)
+        if (m_chunkType == MLE_CHUNK_GROUP)
+            MLE_ASSERT((m_currentActor != NULL) && (getCurrentActorSize(m_context) > 0));
+#endif
+        MleObject *object = getObject();
+        if (object)
+            loadDynamicProperty(object, propertyEntry, value, length);
     }
+
+    virtual void setArrayProperty(MleRTPropertyEntry *propertyEntry,
+        unsigned char *elements, int numElements, int elementLength)
+    {
+#if defined(MLE_DEBUG)
+        MLE_ASSERT(m_currentActor != NULL && getCurrentActorSize(m_context) > 0);
+#endif
+        MleObject *object = getObject();
+        if (object)
+            loadArrayProperty(object, propertyEntry, elements, numElements, elementLength);
+    }
+
+    virtual void setMediaRef(MleRTPropertyEntry *propertyEntry, int mrefIndex)
+    {
+        propertyEntry->setProperty(m_currentActor, propertyEntry->name,
+            (unsigned char *) &mrefIndex);
+    }
+
+    virtual void createSet(int setIndex)
+    {
+        m_currentSet = (*mlRTSet[setIndex].constructor)();
+        mlRTSet[setIndex].ptr = m_currentSet;
+        m_context->m_currentSet = m_currentSet;
+    }
+
+  private:
+
+    // The object whose properties the chunk is setting.
+    MleObject *getObject(void) const
+    {
+        if (m_chunkType == MLE_CHUNK_GROUP)
+            return m_currentActor;
+        if (m_chunkType == MLE_CHUNK_SET)
+            return m_currentSet;
+        return NULL;
+    }
+
+    MleLoadContext *m_context;
+    MleChunkType m_chunkType;
+    MleActor *m_currentActor;
+    MleSet *m_currentSet;
+    int m_actorIndex;       // index of actor within the group
+};
+
+
+void parseStream(MleLoadContext *context,
+                 unsigned char *&streamPtrRef,
+                 unsigned char *streamStart,
+                 unsigned char *streamEnd,
+                 MleChunkType chunkType)
+{
+    MleStreamLoader loader(context, chunkType);
+    decodeStream(&loader, streamPtrRef, streamStart, streamEnd, chunkType);
+
+    // Roles not given a parent are left for the caller to attach, with
+    //   attachGroupRole().
+}
+
+
+void attachGroupRole(MleLoadContext *context, int actorIndex)
+{
+    MLE_ASSERT(actorIndex >= 0 && actorIndex < context->m_numActors);
+
+    MleRole *role = context->m_registry[actorIndex].m_actor->getRole();
+    if ((context->m_attached[actorIndex] == 0) && role)
+    {
+        // Not attached to a parent role, so put it on its set.
+        context->m_sets[actorIndex]->attach(NULL, role);
+        context->m_attached[actorIndex] = 1;
+    }
+}
+
+
+void releaseLoadContext(MleLoadContext *context)
+{
+    delete [] context->m_registry;
+    delete [] context->m_sets;
+    delete [] context->m_attached;
+    context->m_registry = NULL;
+    context->m_sets = NULL;
+    context->m_attached = NULL;
+    context->m_size = 0;
+    context->m_numActors = 0;
+    context->m_currentSet = NULL;
 }
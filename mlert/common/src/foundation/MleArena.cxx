@@ -0,0 +1,176 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleArena.cxx
+ * @ingroup MleFoundation
+ *
+ * @brief Block allocation for cloned objects.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+#include "mle/mlAssert.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleArena.h"
+
+
+MleArena **MleArena::g_arenas = NULL;
+int MleArena::g_numArenas = 0;
+int MleArena::g_maxArenas = 0;
+
+
+MleArena::MleArena(size_t size)
+  : m_size(align(size)),
+    m_used(0),
+    m_references(1)
+{
+    // mlMalloc() aligns for any type; the arena's allocations are
+    //   aligned relative to the start of the block.
+    m_block = (char *) mlMalloc(m_size ? m_size : MLE_ARENA_ALIGNMENT);
+
+    // File the arena by address, for free().
+    if (g_numArenas == g_maxArenas)
+    {
+        g_maxArenas = g_maxArenas ? 2 * g_maxArenas : 16;
+        g_arenas = (MleArena **) mlRealloc(g_arenas, g_maxArenas * sizeof(MleArena *));
+    }
+    int i = g_numArenas;
+    while ((i > 0) && (g_arenas[i - 1]->m_block > m_block))
+    {
+        g_arenas[i] = g_arenas[i - 1];
+        i--;
+    }
+    g_arenas[i] = this;
+    g_numArenas++;
+}
+
+
+MleArena::~MleArena(void)
+{
+    int i = find(m_block);
+    MLE_ASSERT((i >= 0) && (g_arenas[i] == this));
+    for (g_numArenas--; i < g_numArenas; i++)
+        g_arenas[i] = g_arenas[i + 1];
+
+    mlFree(m_block);
+}
+
+
+void *
+MleArena::allocate(size_t size)
+{
+    MLE_ASSERT(m_references > 0);
+
+    size = align(size);
+    if (size > m_size - m_used)
+        return NULL;
+
+    void *p = m_block + m_used;
+    m_used += size;
+    m_references++;
+    return p;
+}
+
+
+void
+MleArena::release(void)
+{
+    // Nothing more will be allocated, so the unused tail can never be
+    //   handed out.
+    m_size = m_used;
+    unreference();
+}
+
+
+void
+MleArena::unreference(void)
+{
+    MLE_ASSERT(m_references > 0);
+    if (--m_references == 0)
+        delete this;
+}
+
+
+int
+MleArena::find(const void *p)
+{
+    // Binary search for the last arena starting at or below p; the
+    //   caller decides whether p actually lies within it.
+    int low = 0;
+    int high = g_numArenas - 1;
+    while (low <= high)
+    {
+        int middle = (low + high) / 2;
+        if (g_arenas[middle]->m_block <= (const char *) p)
+            low = middle + 1;
+        else
+            high = middle - 1;
+    }
+
+    return high;
+}
+
+
+MlBoolean
+MleArena::free(void *p)
+{
+    // Most titles never clone, and then there is nothing to search.
+    if (g_numArenas == 0)
+        return FALSE;
+
+    int i = find(p);
+    if ((i < 0) || ((const char *) p >= g_arenas[i]->m_block + g_arenas[i]->m_size))
+        return FALSE;
+
+    g_arenas[i]->unreference();
+    return TRUE;
+}
+
+
+void *
+MleArena::operator new(size_t tSize)
+{
+    void *p = mlMalloc(tSize);
+    return p;
+}
+
+
+void
+MleArena::operator delete(void *p)
+{
+    mlFree(p);
+}
@@ -0,0 +1,264 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleChunkCodec.cxx
+ * @ingroup MleFoundation
+ *
+ * Magic Lantern Runtime Engine playprint chunk compression.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+
+// Include system header files.
+#include <string.h>
+
+// Include Runtime Engine header files.
+#include "mle/MleChunkCodec.h"
+
+
+// LZ4 block format limits.  A match is at least MIN_MATCH bytes long and
+//   at most MAX_OFFSET bytes back; the last LAST_LITERALS bytes of a
+//   block are always literals, and no match starts within MATCH_LIMIT
+//   bytes of its end.
+#define MIN_MATCH 4
+#define MAX_OFFSET 65535
+#define LAST_LITERALS 5
+#define MATCH_LIMIT 12
+#define HASH_LOG 12
+
+
+static unsigned int
+_read32(const unsigned char *p)
+{
+    unsigned int value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+
+static unsigned int
+_hash(unsigned int sequence)
+{
+    return (sequence * 2654435761u) >> (32 - HASH_LOG);
+}
+
+
+// Write the part of a length that does not fit in its token nibble.
+static unsigned char *
+_writeLength(unsigned char *out, size_t length)
+{
+    for (length -= 15; length >= 255; length -= 255)
+        *out++ = 255;
+    *out++ = (unsigned char) length;
+    return out;
+}
+
+
+// Write a sequence: a run of literals, then a match unless this is
+//   the last sequence of the block (matchLength 0).
+static unsigned char *
+_writeSequence(unsigned char *out, const unsigned char *literals, size_t numLiterals,
+               size_t offset, size_t matchLength)
+{
+    unsigned char *token = out++;
+    *token = (unsigned char) ((numLiterals < 15 ? numLiterals : 15) << 4);
+    if (numLiterals >= 15)
+        out = _writeLength(out, numLiterals);
+    memcpy(out, literals, numLiterals);
+    out += numLiterals;
+
+    if (matchLength == 0)
+        return out;
+
+    *out++ = (unsigned char) (offset & 0xff);
+    *out++ = (unsigned char) (offset >> 8);
+    matchLength -= MIN_MATCH;
+    *token |= (unsigned char) (matchLength < 15 ? matchLength : 15);
+    if (matchLength >= 15)
+        out = _writeLength(out, matchLength);
+    return out;
+}
+
+
+// Read the extension of a length whose token nibble was 15.
+static MlBoolean
+_readLength(const unsigned char *&in, const unsigned char *end, size_t limit, size_t &length)
+{
+    unsigned char byte;
+    do
+    {
+        if (in >= end)
+            return FALSE;
+        byte = *in++;
+        length += byte;
+        if (length > limit)
+            return FALSE;
+    } while (byte == 255);
+    return TRUE;
+}
+
+
+size_t
+MleChunkCodec::compress(const unsigned char *contents, size_t length,
+                        unsigned char *buffer)
+{
+    unsigned int rawLength = (unsigned int) length;
+    memcpy(buffer, &rawLength, sizeof(rawLength));
+    unsigned char *out = buffer + sizeof(rawLength);
+
+    // The start of the literals not yet written.
+    const unsigned char *anchor = contents;
+    const unsigned char *end = contents + length;
+
+    if (length > MATCH_LIMIT)
+    {
+        const unsigned char *matchEnd = end - LAST_LITERALS;
+        const unsigned char *searchEnd = end - MATCH_LIMIT;
+
+        // The last position seen with each hashed 4 byte sequence.
+        int table[1 << HASH_LOG];
+        memset(table, 0xff, sizeof(table));
+
+        // Step further between probes the longer nothing matches, so
+        //   incompressible data is skipped quickly.
+        unsigned int misses = 0;
+        const unsigned char *in = contents;
+        while (in < searchEnd)
+        {
+            unsigned int sequence = _read32(in);
+            unsigned int hash = _hash(sequence);
+            int candidate = table[hash];
+            table[hash] = (int) (in - contents);
+
+            const unsigned char *match = contents + candidate;
+            if ((candidate < 0) || (in - match > MAX_OFFSET) || (_read32(match) != sequence))
+            {
+                in += 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+
+            // Grow the match backwards over pending literals, then forwards.
+            while ((in > anchor) && (match > contents) && (in[-1] == match[-1]))
+            {
+                in--;
+                match--;
+            }
+            const unsigned char *last = in + MIN_MATCH;
+            match += MIN_MATCH;
+            while ((last < matchEnd) && (*last == *match))
+            {
+                last++;
+                match++;
+            }
+
+            out = _writeSequence(out, anchor, in - anchor, last - match, last - in);
+            anchor = in = last;
+        }
+    }
+
+    out = _writeSequence(out, anchor, end - anchor, 0, 0);
+    return out - buffer;
+}
+
+
+size_t
+MleChunkCodec::getUncompressedLength(const unsigned char *contents, size_t length)
+{
+    if (length < sizeof(unsigned int))
+        return 0;
+    return _read32(contents);
+}
+
+
+MlBoolean
+MleChunkCodec::decompress(const unsigned char *contents, size_t length,
+                          unsigned char *buffer)
+{
+    if (length < sizeof(unsigned int))
+        return FALSE;
+
+    size_t rawLength = _read32(contents);
+    const unsigned char *in = contents + sizeof(unsigned int);
+    const unsigned char *inEnd = contents + length;
+    unsigned char *out = buffer;
+    unsigned char *outEnd = buffer + rawLength;
+
+    while (in < inEnd)
+    {
+        unsigned int token = *in++;
+
+        size_t numLiterals = token >> 4;
+        if ((numLiterals == 15) && ! _readLength(in, inEnd, rawLength, numLiterals))
+            return FALSE;
+        if ((numLiterals > (size_t) (inEnd - in)) || (numLiterals > (size_t) (outEnd - out)))
+            return FALSE;
+        memcpy(out, in, numLiterals);
+        out += numLiterals;
+        in += numLiterals;
+
+        // The last sequence has no match.
+        if (in == inEnd)
+            break;
+
+        if (inEnd - in < 2)
+            return FALSE;
+        size_t offset = in[0] | (in[1] << 8);
+        in += 2;
+        if ((offset == 0) || (offset > (size_t) (out - buffer)))
+            return FALSE;
+
+        size_t matchLength = token & 15;
+        if ((matchLength == 15) && ! _readLength(in, inEnd, rawLength, matchLength))
+            return FALSE;
+        matchLength += MIN_MATCH;
+        if (matchLength > (size_t) (outEnd - out))
+            return FALSE;
+
+        // A match may overlap the bytes it produces, repeating a short
+        //   run; copy those a byte at a time.
+        const unsigned char *match = out - offset;
+        if (offset >= matchLength)
+            memcpy(out, match, matchLength);
+        else
+        {
+            for (size_t i = 0; i < matchLength; i++)
+                out[i] = match[i];
+        }
+        out += matchLength;
+    }
+
+    return out == outEnd;
+}
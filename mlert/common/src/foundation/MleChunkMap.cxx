@@ -0,0 +1,174 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleChunkMap.cxx
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#if defined(_WINDOWS)
+#include <windows.h>
+#include <io.h>
+#elif defined(__linux__) || defined(__APPLE__)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleChunkMap.h"
+
+
+MleChunkMap::MleChunkMap(void)
+  : m_base(NULL),
+    m_size(0)
+{
+#if defined(_WINDOWS)
+    m_mapping = NULL;
+#endif
+}
+
+
+MleChunkMap::~MleChunkMap(void)
+{
+    unmap();
+}
+
+
+MlBoolean
+MleChunkMap::map(FILE *fp)
+{
+    unmap();
+    if (fp == NULL)
+        return FALSE;
+
+#if defined(_WINDOWS)
+    HANDLE file = (HANDLE) _get_osfhandle(_fileno(fp));
+    if (file == INVALID_HANDLE_VALUE)
+        return FALSE;
+
+    LARGE_INTEGER size;
+    if (! GetFileSizeEx(file, &size) || size.QuadPart == 0 ||
+        (unsigned long long) size.QuadPart > (size_t) -1)
+        return FALSE;
+
+    HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+        return FALSE;
+
+    void *base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (base == NULL)
+    {
+        CloseHandle(mapping);
+        return FALSE;
+    }
+
+    m_mapping = mapping;
+    m_base = (unsigned char *) base;
+    m_size = (size_t) size.QuadPart;
+    return TRUE;
+#elif defined(__linux__) || defined(__APPLE__)
+    int fd = fileno(fp);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0 || info.st_size <= 0)
+        return FALSE;
+
+    void *base = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED)
+        return FALSE;
+
+    m_base = (unsigned char *) base;
+    m_size = (size_t) info.st_size;
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+
+void
+MleChunkMap::unmap(void)
+{
+    if (m_base == NULL)
+        return;
+
+#if defined(_WINDOWS)
+    UnmapViewOfFile(m_base);
+    CloseHandle((HANDLE) m_mapping);
+    m_mapping = NULL;
+#elif defined(__linux__) || defined(__APPLE__)
+    munmap(m_base, m_size);
+#endif
+    m_base = NULL;
+    m_size = 0;
+}
+
+
+void
+MleChunkMap::prefetch(size_t offset, size_t length) const
+{
+#if (defined(__linux__) || defined(__APPLE__)) && ! defined(_WINDOWS)
+    if (getAddress(offset, length) == NULL || length == 0)
+        return;
+
+    // madvise() wants a page aligned start; the mapping itself is.
+    size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+    size_t start = offset & ~(pageSize - 1);
+    madvise(m_base + start, offset + length - start, MADV_WILLNEED);
+#else
+    (void) offset;
+    (void) length;
+#endif
+}
+
+
+void *
+MleChunkMap::operator new(size_t tSize)
+{
+    void *p = mlMalloc(tSize);
+    return p;
+}
+
+
+void
+MleChunkMap::operator delete(void *p)
+{
+    mlFree(p);
+}
@@ -0,0 +1,189 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleChunkTrace.cxx
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleChunkTrace.h"
+#include "mle/MleOpcode.h"
+
+
+MlBoolean MleChunkTrace::g_enabled = FALSE;
+MleChunkTraceRecord *MleChunkTrace::g_records = NULL;
+unsigned int MleChunkTrace::g_mask = 0;
+unsigned int MleChunkTrace::g_count = 0;
+
+// Opcode names, in MleDppOpcodes order starting at beginActorSetOpcode.
+static const char *g_opcodeNames[] =
+{
+    "beginActorSetOpcode",
+    "createActorOpcode",
+    "setSetOpcode",
+    "bindRoleOpcode",
+    "parentRoleOpcode",
+    "childRoleOpcode",
+    "setPropertyOffsetOpcode",
+    "setPropertyLengthOpcode",
+    "copyPropertyOpcode",
+    "copyMediaRefOpcode",
+    "endActorGroupOpcode",
+    "copyDynamicPropertyOpcode",
+    "copyArrayPropertyOpcode",
+    "createSetOpcode",
+    "endSetOpcode"
+};
+
+
+void
+MleChunkTrace::enable(int capacity)
+{
+    unsigned int size = 1;
+    while (size < (unsigned int) capacity)
+        size <<= 1;
+
+    if (g_records == NULL || size != g_mask + 1)
+    {
+        if (g_records != NULL)
+            mlFree(g_records);
+        g_records = (MleChunkTraceRecord *) mlMalloc(size * sizeof(MleChunkTraceRecord));
+        g_mask = size - 1;
+    }
+    g_count = 0;
+    g_enabled = TRUE;
+}
+
+
+void
+MleChunkTrace::disable(void)
+{
+    g_enabled = FALSE;
+    if (g_records != NULL)
+        mlFree(g_records);
+    g_records = NULL;
+    g_mask = 0;
+    g_count = 0;
+}
+
+
+void
+MleChunkTrace::clear(void)
+{
+    g_count = 0;
+}
+
+
+void
+MleChunkTrace::record(MleChunkTraceKind kind, int opcode, int value, int offset)
+{
+    if (! g_enabled)
+        return;
+
+    MleChunkTraceRecord *r = &g_records[g_count & g_mask];
+    r->m_kind = (unsigned char) kind;
+    r->m_opcode = (unsigned char) opcode;
+    r->m_value = value;
+    r->m_offset = offset;
+    g_count++;
+}
+
+
+int
+MleChunkTrace::getNumRecords(void)
+{
+    if (g_records == NULL)
+        return 0;
+    return (g_count > g_mask) ? (int) (g_mask + 1) : (int) g_count;
+}
+
+
+const MleChunkTraceRecord *
+MleChunkTrace::getRecord(int i)
+{
+    int n = getNumRecords();
+    if (i < 0 || i >= n)
+        return NULL;
+
+    // The oldest record held is n records behind the next write.
+    return &g_records[(g_count - n + i) & g_mask];
+}
+
+
+const char *
+MleChunkTrace::getOpcodeName(int opcode)
+{
+    int i = opcode - beginActorSetOpcode;
+    if (i < 0 || i >= (int) (sizeof(g_opcodeNames) / sizeof(g_opcodeNames[0])))
+        return NULL;
+    return g_opcodeNames[i];
+}
+
+
+void
+MleChunkTrace::dump(FILE *fp)
+{
+    int n = getNumRecords();
+    if (g_count > (unsigned int) n)
+        fprintf(fp, "(%u earlier records dropped)\n", g_count - n);
+
+    for (int i = 0; i < n; i++)
+    {
+        const MleChunkTraceRecord *r = getRecord(i);
+        switch (r->m_kind)
+        {
+          case MLE_TRACE_OPCODE:
+            {
+                const char *name = getOpcodeName(r->m_opcode);
+                if (name)
+                    fprintf(fp, "%8d %s\n", r->m_offset, name);
+                else
+                    fprintf(fp, "%8d opcode=x%02x\n", r->m_offset, r->m_opcode);
+            }
+            break;
+          case MLE_TRACE_INDEX:
+            fprintf(fp, "%8d     index=%d\n", r->m_offset, r->m_value);
+            break;
+          case MLE_TRACE_DATA:
+            fprintf(fp, "%8d     data=%d bytes\n", r->m_offset, r->m_value);
+            break;
+        }
+    }
+    fflush(fp);
+}
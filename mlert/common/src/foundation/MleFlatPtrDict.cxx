@@ -0,0 +1,269 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleFlatPtrDict.cxx
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <stdio.h>
+#include <string.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleFlatPtrDict.h"
+
+/* The smallest table that will be allocated. */
+#define MLE_FLATPTRDICT_MIN_CAPACITY 8
+
+/*
+ * This is the constructor.  The argument is the number of entries
+ * the table should be able to hold before it has to grow.
+ */
+MleFlatPtrDict::MleFlatPtrDict(int size)
+{
+	/* Round up to a power of two that keeps size below the load limit. */
+	unsigned int capacity = MLE_FLATPTRDICT_MIN_CAPACITY;
+	while ( (size > 0) && (capacity*7 < (unsigned int)size*8) )
+		capacity <<= 1;
+
+	m_capacity = 0;
+	m_numEntries = 0;
+	m_slots = NULL;
+
+	rehash(capacity);
+}
+
+MleFlatPtrDict::~MleFlatPtrDict()
+{
+	mlFree(m_slots);
+}
+
+/*
+ * This function returns the index of the slot holding key, or -1.
+ *   With Robin Hood ordering the search can stop as soon as it
+ *   reaches a slot whose entry is closer to its home than the key
+ *   being searched for would be.
+ */
+int
+MleFlatPtrDict::lookup(const void *key) const
+{
+	unsigned int mask = m_capacity - 1;
+	unsigned int i = hash(key) & mask;
+	unsigned int dist = 1;
+
+	while ( m_slots[i].m_dist >= dist )
+	{
+		if ( (m_slots[i].m_dist == dist) && match(m_slots[i].m_key,key) )
+			return (int)i;
+
+		i = (i + 1) & mask;
+		dist++;
+	}
+
+	return -1;
+}
+
+/*
+ * This function returns the value for the key or NULL if the
+ * key is not found.
+ */
+void *
+MleFlatPtrDict::find(const void *key) const
+{
+	int i = lookup(key);
+
+	return (i < 0) ? NULL : m_slots[i].m_ptr;
+}
+
+/*
+ * This function creates or changes the value for the key.
+ */
+void
+MleFlatPtrDict::set(const void *key,const void *value)
+{
+	/* Change the value if the key is already present. */
+	int found = lookup(key);
+	if ( found >= 0 )
+	{
+		m_slots[found].m_ptr = (void *)value;
+		return;
+	}
+
+	/* Grow before the table goes over 7/8 full. */
+	if ( (m_numEntries + 1)*8 > m_capacity*7 )
+		rehash(m_capacity << 1);
+
+	/* Insert, displacing any entry that is closer to its home slot. */
+	MleFlatPtrDictEntry carry;
+	carry.m_key = (void *)key;
+	carry.m_ptr = (void *)value;
+	carry.m_dist = 1;
+
+	unsigned int mask = m_capacity - 1;
+	unsigned int i = hash(key) & mask;
+	while ( m_slots[i].m_dist != 0 )
+	{
+		if ( m_slots[i].m_dist < carry.m_dist )
+		{
+			MleFlatPtrDictEntry tmp = m_slots[i];
+			m_slots[i] = carry;
+			carry = tmp;
+		}
+
+		i = (i + 1) & mask;
+		carry.m_dist++;
+	}
+	m_slots[i] = carry;
+
+	m_numEntries++;
+}
+
+/*
+ * This function removes the entry for the key.
+ */
+void
+MleFlatPtrDict::remove(const void *key)
+{
+	int found = lookup(key);
+	if ( found < 0 )
+		return;
+
+	/* Shift the following run back by one so no tombstone is needed. */
+	unsigned int mask = m_capacity - 1;
+	unsigned int i = (unsigned int)found;
+	unsigned int next = (i + 1) & mask;
+	while ( m_slots[next].m_dist > 1 )
+	{
+		m_slots[i] = m_slots[next];
+		m_slots[i].m_dist--;
+		i = next;
+		next = (next + 1) & mask;
+	}
+	m_slots[i].m_key = NULL;
+	m_slots[i].m_ptr = NULL;
+	m_slots[i].m_dist = 0;
+
+	m_numEntries--;
+}
+
+/*
+ * This function removes all entries without releasing the table.
+ */
+void
+MleFlatPtrDict::clear(void)
+{
+	memset(m_slots,0,m_capacity*sizeof(MleFlatPtrDictEntry));
+	m_numEntries = 0;
+}
+
+/*
+ * This function returns the next occupied slot after index, or -1.
+ */
+int
+MleFlatPtrDict::next(int index) const
+{
+	for ( unsigned int i = (unsigned int)(index + 1); i < m_capacity; i++ )
+	{
+		if ( m_slots[i].m_dist != 0 )
+			return (int)i;
+	}
+
+	return -1;
+}
+
+/*
+ * This function moves all entries into a new slot array.
+ */
+void
+MleFlatPtrDict::rehash(unsigned int capacity)
+{
+	MleFlatPtrDictEntry *old = m_slots;
+	unsigned int oldCapacity = m_capacity;
+
+	m_slots = (MleFlatPtrDictEntry *)mlMalloc(capacity*sizeof(MleFlatPtrDictEntry));
+	memset(m_slots,0,capacity*sizeof(MleFlatPtrDictEntry));
+	m_capacity = capacity;
+	m_numEntries = 0;
+
+	for ( unsigned int j = 0; j < oldCapacity; j++ )
+	{
+		if ( old[j].m_dist != 0 )
+			set(old[j].m_key,old[j].m_ptr);
+	}
+
+	mlFree(old);
+}
+
+/*
+ * This is the default hash function.
+ */
+unsigned int
+MleFlatPtrDict::hash(const void *key) const
+{
+	/* Drop the alignment bits, then mix with a Fibonacci multiply */
+	/*   and fold the high bits down, since the table masks off the */
+	/*   low bits of the result. */
+	unsigned long long v = (unsigned long long)(size_t)key;
+	v = (v >> 3) * 0x9e3779b97f4a7c15ULL;
+
+	return (unsigned int)(v >> 32);
+}
+
+/*
+ * This is the default key matching function.
+ */
+int
+MleFlatPtrDict::match(const void *key0,const void *key1) const
+{
+	/* This is simply pointer equality. */
+	return (key0 == key1);
+}
+
+void *
+MleFlatPtrDict::operator new(size_t tSize)
+{
+	void *p = mlMalloc(tSize);
+	return p;
+}
+
+void
+MleFlatPtrDict::operator delete(void *p)
+{
+	mlFree(p);
+}
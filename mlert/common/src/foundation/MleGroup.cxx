@@ -40,6 +40,8 @@
 
 // Include Magic Lantern Runtime Engine header files.
 #include "mle/MleGroup.h"
+#include "mle/MleArena.h"
+#include "mle/MleFlatPtrDict.h"
 #include "mle/MleLoad.h"
 #include "mle/MleRole.h"
 #include "mle/MleSet.h"
@@ -99,7 +101,7 @@ MleGroup::MleGroup(void) : MlePtrContainer<MleActor*>(8)
 
 MleGroup::~MleGroup(void)
 {
-    // Delete all of our actors
+    // Delete all of our actors; each one unregisters itself.
     for (int i = 0; i < getSize(); i++)
     {
         delete (*this)[i];
@@ -116,6 +118,103 @@ void
 MleGroup::init(void)
 {}
 
+MleGroup *
+MleGroup::newInstance(void) const
+{
+    return new MleGroup(getSize());
+}
+
+MleGroup *
+MleGroup::clone(void)
+{
+    // Size one arena for all of the actors and their roles.
+    size_t size = 0;
+    int i;
+    for (i = 0; i < getSize(); i++)
+    {
+        MleActor *actor = (*this)[i];
+        size_t actorSize = actor->getCloneSize();
+        if (actorSize == 0)
+            return NULL;
+        size += MleArena::align(actorSize);
+
+        MleRole *role = actor->getRole();
+        if (role != NULL)
+        {
+            size_t roleSize = role->getCloneSize();
+            if (roleSize == 0)
+                return NULL;
+            size += MleArena::align(roleSize);
+        }
+    }
+
+    MleArena *arena = new MleArena(size);
+    MleGroup *group = newInstance();
+    MleSet *previousSet = MleSet::g_currentSet;
+
+    // Maps each original role to its copy.
+    MleFlatPtrDict roles(getSize());
+
+    for (i = 0; i < getSize(); i++)
+    {
+        MleActor *original = (*this)[i];
+        MleActor *actor = original->clone(arena->allocate(original->getCloneSize()));
+        MLE_ASSERT(actor != NULL);
+
+        MleRole *role = original->getRole();
+        if (role != NULL)
+        {
+            // The role constructor binds the new role to the set.
+            MleSet::g_currentSet = role->m_set;
+            MleRole *newRole = role->clone(actor, arena->allocate(role->getCloneSize()));
+            MLE_ASSERT(newRole != NULL);
+            roles.set(role, newRole);
+        }
+
+        group->add(actor);
+    }
+
+    // Attach the copies as the loader attached the originals: each
+    //   child to the copy of its parent, then the rest to their sets.
+    //   A role whose parent is not in the group goes on its set.
+    for (i = 0; i < getSize(); i++)
+    {
+        MleRole *role = (*this)[i]->getRole();
+        MleRole *newRole = (*group)[i]->getRole();
+        if ((newRole == NULL) || (newRole->m_set == NULL) || (role->m_parent == NULL))
+            continue;
+
+        MleRole *newParent = (MleRole *) roles.find(role->m_parent);
+        if (newParent != NULL)
+        {
+            newRole->m_set->attach(newParent, newRole);
+            newRole->m_parent = newParent;
+        }
+    }
+    for (i = 0; i < group->getSize(); i++)
+    {
+        MleRole *newRole = (*group)[i]->getRole();
+        if ((newRole != NULL) && (newRole->m_set != NULL) && (newRole->m_parent == NULL))
+            newRole->m_set->attach(NULL, newRole);
+    }
+
+    // The arena goes once the last of its actors and roles is deleted.
+    arena->release();
+
+    // Initialize the copies as mlLoadGroup() does, with each actor's
+    //   set current during its init().
+    for (i = 0; i < group->getSize(); i++)
+    {
+        MleActor *actor = (*group)[i];
+        MleSet::g_currentSet = actor->getRole() ? actor->getRole()->m_set : NULL;
+        actor->init();
+    }
+    group->init();
+
+    MleSet::g_currentSet = previousSet;
+    return group;
+}
+
 void *
 MleGroup::operator new(size_t tSize)
 {
@@ -142,15 +241,31 @@ MleGroup::getTypeName(void) const
     return "MleGroup";
 }
 
+MleTypeId
+MleGroup::classTypeId(void)
+{
+    static MleTypeId type = MleTypeSymbol::intern("MleGroup",MLE_TYPE_NONE);
+    return type;
+}
+
+MleTypeId
+MleGroup::getTypeId(void) const
+{
+    return classTypeId();
+}
+
+// String form of isa(), kept for compatibility.
 int
 MleGroup::isa(const char *type) const
 {
-    return !strcmp(type,"MleGroup");
+    MleTypeId self = getTypeId();
+    return MleTypeSymbol::isa(self,MleTypeSymbol::find(type,self));
 }
 
 void
 MleGroup::initClass(void)
 {
+    classTypeId();
     new MleGroupClass("MleGroup",_mlCreateMleGroup,"");
 }
 
@@ -181,15 +296,19 @@ MleGroup::registerInstance(const char* name)
 void
 MleGroup::unregisterInstance()
 {
-    // Eliminate from instance registry.
-    // XXX - must iterate through dict.  We could have registered this twice,
-    // or we could put a removeValue in the dict class
+    // Eliminate from instance registry by name.
+    if ( m_name && (MleGroup *) g_instanceRegistry.find(m_name) == this )
+        g_instanceRegistry.remove(m_name);
+}
 
-    for (MleDwpDictIter iter(g_instanceRegistry); iter.getValue(); iter.next()) {
-        if ((MleGroup*) iter.getValue() == this) {
-            g_instanceRegistry.remove(iter.getKey());
-            break;
-        }
+// Unregister all of our actors from the actor registry.
+void
+MleGroup::unregisterActors(void)
+{
+    for (int i = 0; i < getSize(); i++)
+    {
+        MleActor *actor = (*this)[i];
+        if (actor) actor->unregisterInstance();
     }
 }
 
@@ -0,0 +1,332 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleGroupTemplate.cxx
+ * @ingroup MleFoundation
+ *
+ * @brief A group chunk decoded for repeated instantiation.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <string.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+#include "mle/mlAssert.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleGroupTemplate.h"
+#include "mle/MleActorGC.h"
+#include "mle/MleGroup.h"
+#include "mle/MleActor.h"
+#include "mle/MleRole.h"
+#include "mle/MleSet.h"
+#include "mle/MleLoad.h"
+
+
+// Values are copied into the template at offsets aligned for any
+//   property type, so that instantiating hands every setter an aligned
+//   value without staging it.
+#define MLE_TEMPLATE_VALUE_ALIGNMENT 16
+
+
+MleGroupTemplate::MleGroupTemplate(void)
+  : m_createGroup(NULL),
+    m_numActors(0),
+    m_instructions(NULL),
+    m_numInstructions(0),
+    m_maxInstructions(0),
+    m_values(NULL),
+    m_valuesSize(0),
+    m_maxValues(0)
+{
+}
+
+
+MleGroupTemplate::~MleGroupTemplate(void)
+{
+    if (m_instructions)
+        mlFree(m_instructions);
+    if (m_values)
+        mlFree(m_values);
+}
+
+
+MleGroupInstruction *
+MleGroupTemplate::addInstruction(MleGroupOperation operation)
+{
+    if (m_numInstructions == m_maxInstructions)
+    {
+        m_maxInstructions = m_maxInstructions ? 2 * m_maxInstructions : 16;
+        m_instructions = (MleGroupInstruction *) mlRealloc(m_instructions,
+            m_maxInstructions * sizeof(MleGroupInstruction));
+    }
+
+    MleGroupInstruction *instruction = &m_instructions[m_numInstructions++];
+    memset(instruction, 0, sizeof(MleGroupInstruction));
+    instruction->m_operation = operation;
+    return instruction;
+}
+
+
+unsigned int
+MleGroupTemplate::addValue(const unsigned char *value, unsigned int length)
+{
+    unsigned int offset = (m_valuesSize + MLE_TEMPLATE_VALUE_ALIGNMENT - 1) &
+        ~(MLE_TEMPLATE_VALUE_ALIGNMENT - 1);
+    if (offset + length > m_maxValues)
+    {
+        unsigned int size = m_maxValues ? 2 * m_maxValues : 256;
+        while (size < offset + length)
+            size *= 2;
+        m_values = (unsigned char *) mlRealloc(m_values, size);
+        m_maxValues = size;
+    }
+
+    memcpy(m_values + offset, value, length);
+    m_valuesSize = offset + length;
+    return offset;
+}
+
+
+// The visitor of MleGroupTemplate::compile(): it records each operation
+//   of the chunk as an instruction, copying the values.
+class MleGroupCompiler : public MleChunkVisitor
+{
+  public:
+
+    MleGroupCompiler(MleGroupTemplate *groupTemplate)
+      : m_template(groupTemplate),
+        m_numActors(0)
+    {}
+
+    virtual void createActor(int classIndex)
+    {
+        MLE_ASSERT(m_numActors < m_template->m_numActors);
+
+        MleGroupInstruction *instruction =
+            m_template->addInstruction(MLE_GROUP_CREATE_ACTOR);
+        instruction->m_index = classIndex;
+        instruction->m_createActor = mlRTActorClass[classIndex].constructor;
+        m_numActors++;
+    }
+
+    virtual void bindRole(int setIndex, int roleIndex)
+    {
+        MleGroupInstruction *instruction =
+            m_template->addInstruction(MLE_GROUP_BIND_ROLE);
+        instruction->m_index = setIndex;
+        instruction->m_createRole = mlRTRoleClass[roleIndex].constructor;
+    }
+
+    virtual void attachRole(int parentIndex, int childIndex)
+    {
+        MleGroupInstruction *instruction =
+            m_template->addInstruction(MLE_GROUP_ATTACH_ROLE);
+        instruction->m_index = parentIndex;
+        instruction->m_count = childIndex;
+    }
+
+    virtual void setProperty(MleRTPropertyEntry *propertyEntry,
+        unsigned char *value, int length)
+    {
+        MLE_ASSERT(m_numActors > 0);
+        addValue(MLE_GROUP_PROPERTY, propertyEntry, value, length)->m_length = length;
+    }
+
+    virtual void setDynamicProperty(MleRTPropertyEntry *propertyEntry,
+        unsigned char *value, int length)
+    {
+        MLE_ASSERT(m_numActors > 0);
+        addValue(MLE_GROUP_DYNAMIC_PROPERTY, propertyEntry, value, length)->m_length = length;
+    }
+
+    virtual void setArrayProperty(MleRTPropertyEntry *propertyEntry,
+        unsigned char *elements, int numElements, int elementLength)
+    {
+        MLE_ASSERT(m_numActors > 0);
+        MleGroupInstruction *instruction = addValue(MLE_GROUP_ARRAY_PROPERTY,
+            propertyEntry, elements, numElements * elementLength);
+        instruction->m_count = numElements;
+        instruction->m_length = elementLength;
+    }
+
+    virtual void setMediaRef(MleRTPropertyEntry *propertyEntry, int mrefIndex)
+    {
+        MLE_ASSERT(m_numActors > 0);
+
+        MleGroupInstruction *instruction =
+            m_template->addInstruction(MLE_GROUP_MEDIAREF);
+        instruction->m_property = propertyEntry;
+        instruction->m_index = mrefIndex;
+    }
+
+    // Set opcodes have no place in a group chunk, so createSet() is
+    //   left to assert.
+
+  private:
+
+    // Append an instruction that sets a property from a copy of value.
+    MleGroupInstruction *addValue(MleGroupOperation operation,
+        MleRTPropertyEntry *propertyEntry, unsigned char *value, int length)
+    {
+        MleGroupInstruction *instruction = m_template->addInstruction(operation);
+        instruction->m_property = propertyEntry;
+        instruction->m_value = m_template->addValue(value, length);
+        return instruction;
+    }
+
+    MleGroupTemplate *m_template;
+    int m_numActors;
+};
+
+
+MleGroupTemplate *
+MleGroupTemplate::compile(unsigned char *chunk, unsigned int length)
+{
+    unsigned char *streamStart = chunk;
+    unsigned char *streamEnd = chunk + length;
+    unsigned char *streamPtr = chunk;
+    unsigned char *&streamPtrRef = streamPtr;
+
+    MleGroupTemplate *groupTemplate = new MleGroupTemplate();
+
+    int index = readInt(streamPtrRef, streamStart, streamEnd);
+    groupTemplate->m_createGroup = mlRTGroupClass[index].constructor;
+    groupTemplate->m_numActors = readIndex(streamPtrRef, streamStart, streamEnd);
+
+    // The chunk is decoded as parseStream() decodes it.
+    MleGroupCompiler compiler(groupTemplate);
+    decodeStream(&compiler, streamPtrRef, streamStart, streamEnd, MLE_CHUNK_GROUP);
+
+    return groupTemplate;
+}
+
+
+MleGroup *
+MleGroupTemplate::instantiate(MleLoadContext *context) const
+{
+    MleGroup *group = (*m_createGroup)();
+    if (group == NULL)
+        return NULL;
+
+    chunkInitialization(context, m_numActors);
+
+    MleActor *actor = NULL;
+    const MleGroupInstruction *instruction = m_instructions;
+    const MleGroupInstruction *end = m_instructions + m_numInstructions;
+    for (; instruction < end; instruction++)
+    {
+        switch (instruction->m_operation)
+        {
+          case MLE_GROUP_CREATE_ACTOR:
+            actor = (*instruction->m_createActor)();
+            registerActor(context, actor, instruction->m_index);
+            break;
+
+          case MLE_GROUP_BIND_ROLE:
+            // mlLoadSet() creates the set the first time it is asked for.
+            context->m_currentSet =
+                context->m_sets[context->m_numActors - 1] =
+            mlLoadSet(instruction->m_index);
+            if (context->m_currentSet != NULL)
+                createRole(context, actor, instruction->m_createRole);
+            break;
+
+          case MLE_GROUP_ATTACH_ROLE:
+            {
+                int parent = instruction->m_index;
+                int child = instruction->m_count;
+
+                // The role must not have been attached already, and
+                // must share its parent's set.
+                MLE_ASSERT(context->m_attached[child] == 0);
+                MLE_ASSERT(context->m_sets[parent] == context->m_sets[child]);
+                if (context->m_sets[parent] == NULL)
+                    break;
+
+                context->m_sets[parent]->attach(
+                    context->m_registry[parent].m_actor->getRole(),
+                    context->m_registry[child].m_actor->getRole());
+                context->m_registry[child].m_actor->getRole()->m_parent =
+                    context->m_registry[parent].m_actor->getRole();
+                context->m_attached[child] = 1;
+            }
+            break;
+
+          case MLE_GROUP_PROPERTY:
+            loadProperty(actor, instruction->m_property,
+                m_values + instruction->m_value, instruction->m_length);
+            break;
+
+          case MLE_GROUP_DYNAMIC_PROPERTY:
+            loadDynamicProperty(actor, instruction->m_property,
+                m_values + instruction->m_value, instruction->m_length);
+            break;
+
+          case MLE_GROUP_ARRAY_PROPERTY:
+            loadArrayProperty(actor, instruction->m_property,
+                m_values + instruction->m_value, instruction->m_count,
+                instruction->m_length);
+            break;
+
+          case MLE_GROUP_MEDIAREF:
+            {
+                int mrefIndex = instruction->m_index;
+                instruction->m_property->setProperty(actor,
+                    instruction->m_property->name, (unsigned char *) &mrefIndex);
+            }
+            break;
+        }
+    }
+
+    return group;
+}
+
+
+void *
+MleGroupTemplate::operator new(size_t tSize)
+{
+    void *p = mlMalloc(tSize);
+    return p;
+}
+
+
+void
+MleGroupTemplate::operator delete(void *p)
+{
+    mlFree(p);
+}
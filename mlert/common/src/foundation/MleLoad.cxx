@@ -41,6 +41,10 @@
 // Include system header files.
 #include <stdio.h>
 #include <memory.h>
+#ifdef MLE_DIGITAL_PLAYPRINT
+#include <atomic>
+#include <thread>
+#endif
 #ifdef _WINDOWS
 // include system header files
 #include <string.h>
@@ -168,15 +172,28 @@ static MleActor *_mlCreateActor(MleDwpActor *wpa)
     MleDwpProperty **prop;
 
     // If there is a template, set those properties first.
+    //   The template's properties are compiled into a plan the first
+    //   time the template is used for this class; later instances made
+    //   before the workprint is released just replay the plan.
     if ( tmpl )
     {
-        // Execute the finder.
-        propFinder.find(tmpl);
-        nProps = propFinder.getNumItems();
-        prop = (MleDwpProperty **)propFinder.getItems();
+        MleActorClass *tmplClass = (MleActorClass *)ac;
+        const MleActorPlan *plan = tmplClass->findPlan(tmpl);
+        if ( plan == NULL )
+        {
+            // Execute the finder.
+            propFinder.find(tmpl);
+            nProps = propFinder.getNumItems();
+            prop = (MleDwpProperty **)propFinder.getItems();
+
+            MleActorPlan *newPlan = new MleActorPlan(ac,nProps);
+            for ( i = 0; i < nProps; i++ )
+                newPlan->addProperty(prop[i]->getName(),&prop[i]->m_data);
+            tmplClass->addPlan(tmpl,newPlan);
+            plan = newPlan;
+        }
 
-        for ( i = 0; i < nProps; i++ )
-            actor->poke(prop[i]->getName(),&prop[i]->m_data);
+        plan->apply(actor);
     }
 
     // Set the properties in the actor.
@@ -334,20 +351,7 @@ MleGroup *_mlLoadGroup(MleDwpGroup* wpGroup)
         // And call the convenience function to create it.
         MleActor *actor = _mlCreateActor((MleDwpActor *)wpa);
 
-        // Remember 1-based index.
-        //   This is a hack because the dictionary returns 0 if
-        //   a key is not present.  Since 0 is a real value, we
-        //   have to have a different encoding for it.  A fix
-        //   would be to use a dictionary that returns ints that
-        //   has a separate mechanism for notifying that a key
-        //   is not present.
-        // Register with the group.
-        group->m_dictionary.set(wpa->getName(), (void*) (1 + numActors));
-
         // Check to see if actor got created.
-        //   Note we do this *after* the return value is
-        //   set because the caller may expect the first
-        //   actor to be a particular type.
         if ( actor == NULL )
         {
             //If we have a client callback, then
@@ -376,9 +380,10 @@ MleGroup *_mlLoadGroup(MleDwpGroup* wpGroup)
             actor->getRole()->m_set = MleSet::g_currentSet;
         }
 
-        // Add to list.
+        // Add to list and register the handle with the group.
         // we keep an array of actors and their forums
-        group->add(actor);
+        MleSlotHandle handle = group->add(actor);
+        group->m_dictionary.set(wpa->getName(), (void*) (size_t) handle);
         sets = (MleSet **)mlRealloc(sets,
             (numActors + 1)*sizeof(MleActor *));
         sets[numActors] = MleSet::g_currentSet;
@@ -431,7 +436,10 @@ MleGroup *_mlLoadGroup(MleDwpGroup* wpGroup)
         else if ( sets[parentIndex] != sets[childIndex] )
             printf("_mlLoadGroup: set mismatch between parent %s and child %s.\n",da->getParent(),da->getChild());
         else
+        {
             sets[parentIndex]->attach(parent,child);
+            child->m_parent = parent;
+        }
             
         // Now remove the child from the registry.
         //   We do this so no child can be given more
@@ -644,16 +652,6 @@ MleScene *_mlLoadScene(MleDwpScene* wpScene)
                   MleDwpGroupRef::typeId == item->getTypeId());
         }
 
-        // Remember 1-based index.
-        //   This is a hack because the dictionary returns 0 if
-        //   a key is not present.  Since 0 is a real value, we
-        //   have to have a different encoding for it.  A fix
-        //   would be to use a dictionary that returns ints that
-        //   has a separate mechanism for notifying that a key
-        //   is not present.
-        // Register with the scene.
-        scene->m_dictionary.set(wpg->getName(), (void*) (1+numGroups));
-
         // And call the convenience function to create it.
         MleGroup *group = _mlLoadGroup((MleDwpGroup *)wpg);
 
@@ -675,8 +673,10 @@ MleScene *_mlLoadScene(MleDwpScene* wpScene)
             _mlReleaseWorkprintGroup(wpg);
         }
 
-        // The scene holds a reference to each group.
-        scene->add(group);
+        // The scene holds a reference to each group, registered
+        // by handle.
+        MleSlotHandle handle = scene->add(group);
+        scene->m_dictionary.set(wpg->getName(), (void*) (size_t) handle);
         numGroups++;
     }
 
@@ -813,6 +813,157 @@ mlLoadBootScene(MleDwpItem *item)
 #include "mle/ppinput.h"
 #include "mle/chunk.h"  // XXX -- should not have this dependency
 #include "mle/MleTables.h"
+#include "mle/MleChunkMap.h"
+#include "mle/MleChunkCodec.h"
+#include "mle/MleChunkTrace.h"
+#include "mle/MleGroupTemplate.h"
+
+
+// The mapping of the playprint opened by mlLoadPlayprint(), when it
+//   could be mapped.  Chunks of any other playprint are read from its
+//   file pointer.
+static MleDppInput *g_mappedDpp = NULL;
+static MleChunkMap *g_dppMap = NULL;
+
+// The source set by mlSetPlayprintChunkSource(), if any.
+static MlePlayprintChunkSource g_chunkSource = NULL;
+
+
+static MleChunkMap *_getPlayprintMap(void)
+{
+    if ((g_dppMap != NULL) && (g_mappedDpp == g_theTitle->m_dpp))
+        return g_dppMap;
+    return NULL;
+}
+
+
+// Decode compressed chunk contents.  The uncompressed length leads the
+//   contents, so the chunk is decoded into one buffer of its final size.
+//   Returns NULL if the chunk is damaged.
+static unsigned char *
+_mlDecompressChunk(const unsigned char *contents, unsigned int storedLength,
+    unsigned int *length)
+{
+    *length = 0;
+
+    // The recorded length is not trusted with an allocation until it is
+    //   one the contents could decode to.
+    size_t rawLength = MleChunkCodec::getUncompressedLength(contents, storedLength);
+    if ((rawLength > MleChunkCodec::getUncompressedBound(storedLength)) ||
+        (rawLength >= MLE_CHUNK_COMPRESSED))
+        return NULL;
+
+    unsigned char *chunk = new unsigned char[rawLength];
+    if (! MleChunkCodec::decompress(contents, storedLength, chunk))
+    {
+        delete [] chunk;
+        return NULL;
+    }
+
+    *length = (unsigned int) rawLength;
+    return chunk;
+}
+
+
+unsigned char *
+mlGetPlayprintChunk(const int indexToPpTOC, unsigned int *length)
+{
+    if (g_chunkSource != NULL)
+        return (*g_chunkSource)(indexToPpTOC, length);
+
+    MLE_ASSERT(g_theTitle->m_dpp);
+
+    // Skip the chunk tag; the contents are preceded by their length.
+    size_t chunkOffset = g_theTitle->m_dpp->getTOCOffset(indexToPpTOC) + sizeof(MlDppTag);
+    unsigned int chunkLength;
+
+    MleChunkMap *map = _getPlayprintMap();
+    if (map != NULL)
+    {
+        unsigned char *header = map->getAddress(chunkOffset, sizeof(chunkLength));
+        if (header != NULL)
+        {
+            memcpy(&chunkLength, header, sizeof(chunkLength));
+            unsigned int storedLength = chunkLength & ~MLE_CHUNK_COMPRESSED;
+            unsigned char *chunk = map->getAddress(chunkOffset + sizeof(chunkLength), storedLength);
+            if (chunk != NULL)
+            {
+                // Compressed contents are decoded straight out of the mapping.
+                if (chunkLength & MLE_CHUNK_COMPRESSED)
+                    return _mlDecompressChunk(chunk, storedLength, length);
+                *length = chunkLength;
+                return chunk;
+            }
+        }
+    }
+
+    // Read the chunk, leaving the playprint positioned where it was.
+    FILE *file = g_theTitle->m_dpp->getFp();
+    MLE_ASSERT(file);
+    long curFileOffset = mlFTell(file);
+
+    mlFSeek(file, chunkOffset, SEEK_SET);
+    chunkLength = 0;
+    mlFRead(&chunkLength, sizeof(chunkLength), 1, file);
+    unsigned int storedLength = chunkLength & ~MLE_CHUNK_COMPRESSED;
+    unsigned char *chunk = new unsigned char[storedLength];
+    mlFRead(chunk, storedLength, 1, file);
+
+    mlFSeek(file, curFileOffset, SEEK_SET);
+
+    if (chunkLength & MLE_CHUNK_COMPRESSED)
+    {
+        unsigned char *contents = chunk;
+        chunk = _mlDecompressChunk(contents, storedLength, length);
+        delete [] contents;
+        return chunk;
+    }
+
+    *length = chunkLength;
+    return chunk;
+}
+
+
+void
+mlReleasePlayprintChunk(unsigned char *chunk)
+{
+    // Chunks from a source belong to the source.
+    if (g_chunkSource != NULL)
+        return;
+
+    // Mapped chunks belong to the mapping.
+    if ((g_dppMap != NULL) && g_dppMap->contains(chunk))
+        return;
+    delete [] chunk;
+}
+
+
+void
+mlPrefetchPlayprintChunk(const int indexToPpTOC)
+{
+    MleChunkMap *map = _getPlayprintMap();
+    if ((map == NULL) || (g_chunkSource != NULL))
+        return;
+
+    size_t chunkOffset = g_theTitle->m_dpp->getTOCOffset(indexToPpTOC) + sizeof(MlDppTag);
+    unsigned int chunkLength;
+    unsigned char *header = map->getAddress(chunkOffset, sizeof(chunkLength));
+    if (header == NULL)
+        return;
+
+    memcpy(&chunkLength, header, sizeof(chunkLength));
+    map->prefetch(chunkOffset, sizeof(chunkLength) + (chunkLength & ~MLE_CHUNK_COMPRESSED));
+}
+
+
+void
+mlSetPlayprintChunkSource(MlePlayprintChunkSource source)
+{
+    // Groups decoded from the old chunks must not be instantiated again.
+    if (source != g_chunkSource)
+        mlFlushGroupTemplates();
+    g_chunkSource = source;
+}
 
 
 char *
@@ -877,51 +1028,224 @@ mlLoadMediaRef(const int id, void* /*userData*/)
 }
 
 
+// The decoded group chunks of a playprint, indexed by TOC index.  They
+//   belong to g_templateDpp, and are flushed if another playprint
+//   becomes the title's.
+static MleDppInput *g_templateDpp = NULL;
+static MleGroupTemplate **g_groupTemplates = NULL;
+static int g_numGroupTemplates = 0;
+
+
+// The number of threads that decode a scene's group chunks, 0 for one
+//   per processor.
+static int g_numDecodeThreads = 0;
+
+
+// Find where the template of a group chunk is kept, making room for it.
+static MleGroupTemplate **_mlGetGroupTemplateSlot(const int indexToPpTOC)
+{
+    MLE_ASSERT(indexToPpTOC >= 0);
+
+    if (g_templateDpp != g_theTitle->m_dpp)
+    {
+        mlFlushGroupTemplates();
+        g_templateDpp = g_theTitle->m_dpp;
+    }
+
+    if (indexToPpTOC >= g_numGroupTemplates)
+    {
+        int size = g_numGroupTemplates ? 2 * g_numGroupTemplates : 64;
+        while (size <= indexToPpTOC)
+            size *= 2;
+        g_groupTemplates = (MleGroupTemplate **) mlRealloc(g_groupTemplates,
+            size * sizeof(MleGroupTemplate *));
+        memset(g_groupTemplates + g_numGroupTemplates, 0,
+            (size - g_numGroupTemplates) * sizeof(MleGroupTemplate *));
+        g_numGroupTemplates = size;
+    }
+
+    return &g_groupTemplates[indexToPpTOC];
+}
+
+
+static MleGroupTemplate *_mlGetGroupTemplate(const int indexToPpTOC)
+{
+    MleGroupTemplate **slot = _mlGetGroupTemplateSlot(indexToPpTOC);
+    if (*slot == NULL)
+    {
+        unsigned int length;
+        unsigned char *actorGroupChunk = mlGetPlayprintChunk(indexToPpTOC, &length);
+        if (actorGroupChunk == NULL)
+            return NULL;
+        *slot = MleGroupTemplate::compile(actorGroupChunk, length);
+        mlReleasePlayprintChunk(actorGroupChunk);
+    }
+
+    return *slot;
+}
+
+
+// A group chunk for _mlDecodeGroupJobs() to decode.
+struct MleGroupDecodeJob
+{
+    int m_indexToPpTOC;
+    unsigned char *m_chunk;
+    unsigned int m_length;
+    MleGroupTemplate *m_template;
+};
+
+
+// Decode jobs until none are left.  This runs on the workers and the
+//   calling thread at once; compiling a chunk touches only the chunk,
+//   its new template and the class tables, which are not changed while
+//   a title runs.
+static void _mlDecodeGroupJobs(MleGroupDecodeJob *jobs, int numJobs,
+    std::atomic<int> *nextJob)
+{
+    int i;
+    while ((i = (*nextJob)++) < numJobs)
+        jobs[i].m_template = MleGroupTemplate::compile(jobs[i].m_chunk, jobs[i].m_length);
+}
+
+
+// Decode the group chunks of a scene that have no template yet, several
+//   at a time.  Only the decoding is shared out: the chunks are read and
+//   the templates kept by the calling thread, since neither the playprint
+//   file nor the template table is locked, and the groups are still built
+//   and initialized one by one by mlLoadGroup(), since constructors,
+//   setters and init() use sets and other state shared by every group.
+static void _mlDecodeGroupTemplates(const int *groupIndices, int numGroups)
+{
+    int numThreads = g_numDecodeThreads;
+    if (numThreads == 0)
+        numThreads = (int) std::thread::hardware_concurrency();
+
+    // Trace records are not locked either.
+    if ((numThreads < 2) || (numGroups < 2) || MleChunkTrace::g_enabled)
+        return;
+
+    MleGroupDecodeJob *jobs = (MleGroupDecodeJob *)
+        mlMalloc(numGroups * sizeof(MleGroupDecodeJob));
+    int numJobs = 0;
+    int i, j;
+    for (i = 0; i < numGroups; i++)
+    {
+        if (*_mlGetGroupTemplateSlot(groupIndices[i]) != NULL)
+            continue;
+
+        // A scene may hold a group more than once.
+        for (j = 0; j < numJobs; j++)
+            if (jobs[j].m_indexToPpTOC == groupIndices[i])
+                break;
+        if (j < numJobs)
+            continue;
+
+        // A damaged chunk is left for mlLoadGroup() to fail on.
+        MleGroupDecodeJob *job = &jobs[numJobs];
+        job->m_chunk = mlGetPlayprintChunk(groupIndices[i], &job->m_length);
+        if (job->m_chunk == NULL)
+            continue;
+        job->m_indexToPpTOC = groupIndices[i];
+        job->m_template = NULL;
+        numJobs++;
+    }
+
+    // The calling thread decodes alongside the workers.
+    std::atomic<int> nextJob(0);
+    int numWorkers = ((numThreads < numJobs) ? numThreads : numJobs) - 1;
+    std::thread *workers = NULL;
+    if (numWorkers > 0)
+    {
+        workers = new std::thread[numWorkers];
+        for (i = 0; i < numWorkers; i++)
+            workers[i] = std::thread(_mlDecodeGroupJobs, jobs, numJobs, &nextJob);
+    }
+    _mlDecodeGroupJobs(jobs, numJobs, &nextJob);
+    for (i = 0; i < numWorkers; i++)
+        workers[i].join();
+    delete [] workers;
+
+    for (i = 0; i < numJobs; i++)
+    {
+        *_mlGetGroupTemplateSlot(jobs[i].m_indexToPpTOC) = jobs[i].m_template;
+        mlReleasePlayprintChunk(jobs[i].m_chunk);
+    }
+    mlFree(jobs);
+}
+
+
+void
+mlSetGroupDecodeThreads(int numThreads)
+{
+    MLE_ASSERT(numThreads >= 0);
+    g_numDecodeThreads = numThreads;
+}
+
+
+void
+mlFlushGroupTemplates(void)
+{
+    for (int i = 0; i < g_numGroupTemplates; i++)
+        delete g_groupTemplates[i];
+    if (g_groupTemplates)
+        mlFree(g_groupTemplates);
+
+    g_groupTemplates = NULL;
+    g_numGroupTemplates = 0;
+    g_templateDpp = NULL;
+}
+
+
+// Construct a group, its actors and their roles.  The roles are left
+//   unattached and the actors uninitialized; the loaded actors are left
+//   in context, which the caller releases.  Used by mlLoadGroup() and by
+//   MleSceneLoader, which commits the actors later.
+//
+// The group chunk is only decoded the first time; later loads of the
+//   group run its template.
+MleGroup *_mlParseGroup(const int indexToPpTOC, MleLoadContext *context)
+{
+    MleGroupTemplate *groupTemplate = _mlGetGroupTemplate(indexToPpTOC);
+    if (groupTemplate == NULL)
+        return NULL;
+    return groupTemplate->instantiate(context);
+}
+
+
 MleGroup *mlLoadGroup(const int indexToPpTOC)
 {
-    extern MleSet **_mleSetArray;    // declared in MleActorGC.cxx
-    unsigned int length;
-    size_t nRead;
+    MleGroupTemplate *groupTemplate = _mlGetGroupTemplate(indexToPpTOC);
+    if (groupTemplate == NULL)
+        return NULL;
+    return mlLoadGroup(groupTemplate);
+}
 
-    FILE *file = g_theTitle->m_dpp->getFp();
-    // XXX -- fix when PP API is available
 
-    mlFSeek(file,g_theTitle->m_dpp->getTOCOffset(indexToPpTOC)+4,SEEK_SET);
-    nRead = mlFRead(&length,sizeof(length),1,file);
-  
-    unsigned char *actorGroupChunk = new unsigned char[length];
-    unsigned char *chunkPtr = actorGroupChunk;
-    unsigned char *&chunkRef = chunkPtr;
-  
-    nRead = mlFRead(actorGroupChunk, length, 1, file);
-
-    // XXX Should also get the group type from the DPP (before 1st actor)
-    // to create here with a call to mleCreateGroup(<type>).
-    int groupIndex;
-    groupIndex = readInt(chunkRef, actorGroupChunk, actorGroupChunk + length);
-    MleGroup *group = (*mlRTGroupClass[groupIndex].constructor)();
+MleGroup *mlLoadGroup(const MleGroupTemplate *groupTemplate)
+{
+    MleLoadContext loaded;
+    MleGroup *group = groupTemplate->instantiate(&loaded);
     if ( group == NULL )
     {
           return NULL;
     }
 
-    int numActors = readIndex(chunkRef, actorGroupChunk,
-        actorGroupChunk + length);
-    chunkInitialization(numActors);
-    parseStream(chunkRef, actorGroupChunk, actorGroupChunk + length,
-        MLE_CHUNK_GROUP);
-    delete actorGroupChunk;
-    for (int i = 0; i < g_actorRegistryPtr - g_actorRegistry; i++)
+    // Attach the roles that were not given a parent to their sets.
+    int i;
+    for (i = 0; i < loaded.m_numActors; i++)
+        attachGroupRole(&loaded, i);
+
+    for (i = 0; i < loaded.m_numActors; i++)
     {
         // Set the current Set.
-        MleSet::g_currentSet = _mleSetArray[i];
+        MleSet::g_currentSet = loaded.m_sets[i];
 
         // XXX Why not dispense with actor registry and use the group?
         // Well, the registry holds at least the actor\'s table index
         // and delegate as well, so isn\'t 100% redundant.
-        group->add(g_actorRegistry[i].m_actor);
+        group->add(loaded.m_registry[i].m_actor);
 
-        g_actorRegistry[i].m_actor->init();
+        loaded.m_registry[i].m_actor->init();
     }
 
     // Now finish the init sequence.
@@ -934,8 +1258,7 @@ MleGroup *mlLoadGroup(const int indexToPpTOC)
     MleSet::g_currentSet = NULL;
 
     // Clean up before exit.
-    delete g_actorRegistry;
-    delete _mleSetArray;
+    releaseLoadContext(&loaded);
 
     return group;
 }
@@ -943,20 +1266,13 @@ MleGroup *mlLoadGroup(const int indexToPpTOC)
 
 MleScene *mlLoadScene(const int indexToPpTOC)
 {
-    extern MleSet **_mleSetArray;    // Declared in MleGroupGC.cxx.
     unsigned int length;
-    size_t nRead;
 
-    FILE *file = g_theTitle->m_dpp->getFp();
-
-    // XXX -- fix when DPP API is available
-    mlFSeek(file,g_theTitle->m_dpp->getTOCOffset(indexToPpTOC)+4,SEEK_SET);
-    nRead = mlFRead(&length,sizeof(length),1,file);
-  
-    unsigned char *sceneChunk = new unsigned char[length];
+    unsigned char *sceneChunk = mlGetPlayprintChunk(indexToPpTOC, &length);
+    if (sceneChunk == NULL)
+        return NULL;
     unsigned char *chunkPtr = sceneChunk;
     unsigned char *&chunkRef = chunkPtr;
-    nRead = mlFRead(sceneChunk, length, 1, file);
 
     // XXX Should also get the scene type from the sceneClass[indexToPpTOC]
     // in order to create the right scene type object, not just MleScene, here.
@@ -964,6 +1280,7 @@ MleScene *mlLoadScene(const int indexToPpTOC)
     MleScene *scene = (*mlRTSceneClass[sceneIndex].constructor)();
     if ( scene == NULL )
     {
+        mlReleasePlayprintChunk(sceneChunk);
         return NULL;
     }
 
@@ -979,20 +1296,39 @@ MleScene *mlLoadScene(const int indexToPpTOC)
     // [ numGroups, [ g0index, g1index, ... gNumIndex ] ]
     //
     int numGroups = readInt(chunkRef, sceneChunk, sceneChunk + length);
+
+    // Hint all of the group chunks in first, so that paging in the later
+    // groups overlaps loading the earlier ones.
+    int *groupIndices = NULL;
+    if (numGroups > 0)
+        groupIndices = (int *) mlMalloc(numGroups * sizeof(int));
     for (int i = 0; i < numGroups; i++)
     {
         // readInt() increments the chunk ptr, so just call repeatedly
         // XXX Kinda funny that the ReadInt() we use resides in actorgc.cxx
-        int groupIndex = readInt(chunkRef, sceneChunk, sceneChunk + length);
+        groupIndices[i] = readInt(chunkRef, sceneChunk, sceneChunk + length);
+        mlPrefetchPlayprintChunk(groupIndices[i]);
+    }
 
-        scene->add(mlLoadGroup( groupIndex ));
+    // Decode the groups that have not been loaded before in parallel;
+    // they are then built one after another.
+    _mlDecodeGroupTemplates(groupIndices, numGroups);
+
+    for (int i = 0; i < numGroups; i++)
+    {
+        // A group whose chunk is damaged is left out of the scene.
+        MleGroup *group = mlLoadGroup( groupIndices[i] );
+        if (group != NULL)
+            scene->add(group);
     }
 
     // Now finish the init sequence.
     scene->init();
 
     // Clean up before exit.
-    delete sceneChunk;
+    if (groupIndices)
+        mlFree(groupIndices);
+    mlReleasePlayprintChunk(sceneChunk);
 
     return scene;
 }
@@ -1018,6 +1354,16 @@ mlLoadPlayprint(const char *filename,unsigned long type)
     dpp->readHeader(NULL,NULL);
     dpp->readTOC(NULL,NULL);
 
+    // Map the playprint so its chunks are loaded in place.  Only one
+    // playprint is mapped at a time.
+    if (g_mappedDpp == NULL)
+    {
+        if (g_dppMap == NULL)
+            g_dppMap = new MleChunkMap();
+        if (g_dppMap->map(dpp->getFp()))
+            g_mappedDpp = dpp;
+    }
+
     return(dpp);
 }
 
@@ -1025,6 +1371,13 @@ mlLoadPlayprint(const char *filename,unsigned long type)
 void
 mlUnloadPlayprint(MleDppInput *dpp)
 {
+    if (dpp == g_templateDpp)
+        mlFlushGroupTemplates();
+    if (dpp == g_mappedDpp)
+    {
+        g_dppMap->unmap();
+        g_mappedDpp = NULL;
+    }
     dpp->end();
     delete dpp;
 }
@@ -112,10 +112,25 @@ MleMediaRef::getTypeName(void) const
 }
 
 
+MleTypeId
+MleMediaRef::classTypeId(void)
+{
+    static MleTypeId type = MleTypeSymbol::intern("MleMediaRef",MLE_TYPE_NONE);
+    return type;
+}
+
+MleTypeId
+MleMediaRef::getTypeId(void) const
+{
+    return classTypeId();
+}
+
+// String form of isa(), kept for compatibility.
 int
 MleMediaRef::isa(const char *type) const
 {
-    return !strcmp(type,"MleMediaRef");
+    MleTypeId self = getTypeId();
+    return MleTypeSymbol::isa(self,MleTypeSymbol::find(type,self));
 }
 #endif /* MLE_DIGITAL_WORKPRINT */
 
@@ -52,97 +52,6 @@
 // Include Runtime Engine header files.
 #include "mle/MleNotifier.h"
 
-MleNotifierPool::MleNotifierPool(int p)
-{
-	// Initialize variables.
-	m_poolsize = p;
-	m_link = NULL;
-
-	// Allocate the initial entries.
-	makePool();
-}
-
-MleNotifierPool::~MleNotifierPool()
-{
-	// Delete all the pools.
-	//   Each pool block is actually one larger than the poolsize,
-	//   and the first entry is used to link the blocks together.
-	//   This code follows those links to delete the blocks when
-	//   the object is destroyed.
-	while ( m_link )
-	{
-		MleNotifierEntry *next = m_link->m_next;
-		delete m_link;
-		m_link = next;
-	}
-}
-
-void
-MleNotifierPool::makePool(void)
-{
-	// Allocate an array of list items.
-	//   A pool block is actually one larger than the pool size.
-	//   The extra entry is used to link blocks together.
-	m_unused = new MleNotifierEntry[m_poolsize + 1];
-
-	// Link to the old pool.
-	m_unused[0].m_next = m_link;
-	m_link = m_unused;
-
-	// Initialize the free list.
-	m_unused = &m_link[1];
-	for ( int i = 0; i < m_poolsize - 1; i++ )
-		m_unused[i].m_next = &m_unused[i + 1];
-	m_unused[m_poolsize - 1].m_next = NULL;
-}
-
-// This function is used by a dictionary to get a new entry (instead
-//   of newing one off the heap).  It simply pulls the first element
-//   off the free list.
-MleNotifierEntry *
-MleNotifierPool::get(void)
-{
-	MleNotifierEntry *rval;	// Temporary for return value.
-
-	// Make a new pool if the current one is used up.
-	if ( m_unused == NULL )
-	{
-#if defined(MLE_DEBUG)
-//		printf("MleNotifierPool::get: warning - expanding pool.\n");
-#endif
-		makePool();
-	}
-
-	// Pull an entry off the free list.
-	rval = m_unused;
-	m_unused = m_unused->m_next;
-	return rval;
-}
-
-// This function is used by a dictionary to dispose of an entry
-//   (instead of deleting it from the heap).  It puts the entry
-//   back onto the free list.
-void
-MleNotifierPool::put(MleNotifierEntry *entry)
-{
-	// Put the entry on the free list.
-	entry->m_next = m_unused;
-	m_unused = entry;
-}
-
-void *
-MleNotifierPool::operator new(size_t tSize)
-{
-	void *p = mlMalloc(tSize);
-	return p;
-}
-
-void
-MleNotifierPool::operator delete(void *p)
-{
-	mlFree(p);
-}
-
 // This notifier constructor makes a new pool.
 MleNotifier::MleNotifier(int hashsize,int poolsize)
 {
@@ -161,34 +70,47 @@ MleNotifier::MleNotifier(int hashsize,MleNotifierPool *p)
 
 MleNotifier::~MleNotifier()
 {
-	// Loop over all the hash table lists.
-	for ( int i = 0; i < m_nbuckets; i++ )
+	// Return all the lists to the pool.
+	for ( int i = m_lists->next(-1); i >= 0; i = m_lists->next(i) )
 	{
-		// Prepend all the hash table lists to the pool free list.
-		//   Use intimate knowledge of the hash table instead of
-		//   doing this one at a time.
-		if ( m_bucket[i] )
-		{
-			// go to the last entry
-			MleNotifierEntry *entry = m_bucket[i];
-			while ( entry->m_next )
-				entry = entry->m_next;
-			
-			entry->m_next = m_pool->m_unused;
-			m_pool->m_unused = m_bucket[i];
-		}
+		MleNotifierList *list = (MleNotifierList *)m_lists->getValue(i);
+		if ( list->m_entries != list->m_local )
+			mlFree(list->m_entries);
+		m_pool->put(list);
 	}
+
+	delete m_lists;
 }
 
 // This is an initialization function that constructors can share.
+//   The hashsize is the number of keys to make room for initially.
 void
 MleNotifier::initialize(int hashsize)
 {
-	m_nbuckets = hashsize;
-	m_bucket = new MleNotifierEntry*[m_nbuckets];
+	m_lists = new MleFlatPtrDict(hashsize);
+}
+
+// This function appends a callback to a list.
+void
+MleNotifier::append(MleNotifierList *list,MleNotifierFunc func,const void *client)
+{
+	// Grow the list if it is full.
+	if ( list->m_numEntries == list->m_maxEntries )
+	{
+		unsigned int size = list->m_maxEntries*2;
+		if ( list->m_entries == list->m_local )
+		{
+			list->m_entries = (MleNotifierEntry *)mlMalloc(size*sizeof(MleNotifierEntry));
+			memcpy(list->m_entries,list->m_local,list->m_numEntries*sizeof(MleNotifierEntry));
+		}
+		else
+			list->m_entries = (MleNotifierEntry *)mlRealloc(list->m_entries,size*sizeof(MleNotifierEntry));
+		list->m_maxEntries = size;
+	}
 
-	// Zero out the bucket.
-	memset(m_bucket,0,m_nbuckets*sizeof(MleNotifierEntry *));
+	MleNotifierEntry *entry = &list->m_entries[list->m_numEntries++];
+	entry->m_func = func;
+	entry->m_client = (void *)client;
 }
 
 // This function adds a notification request.  Calling this function
@@ -197,18 +119,20 @@ MleNotifier::initialize(int hashsize)
 void
 MleNotifier::addCallback(const void *key,MleNotifierFunc func,const void *client)
 {
-	// Create a new entry.
-	MleNotifierEntry *entry = m_pool->get();
-	/* XXX 6.2 Beta compilers caught this, should fix need to cast. */
-	entry->m_key = (void *)key; 
-	entry->m_func = func;
-	/* XXX 6.2 Beta compilers caught this, should fix need to cast. */
-	entry->m_client = (void *)client;
+	// Find the list for the key, creating it if necessary.
+	MleNotifierList *list = (MleNotifierList *)m_lists->find(key);
+	if ( list == NULL )
+	{
+		list = m_pool->get();
+		list->m_entries = list->m_local;
+		list->m_numEntries = 0;
+		list->m_maxEntries = MLE_NOTIFIER_LOCAL_ENTRIES;
+		list->m_numRemoved = 0;
+		list->m_busy = 0;
+		m_lists->set(key,list);
+	}
 
-	// Prepend it to the right list.
-	MleNotifierEntry *&list = m_bucket[hash(key)];
-	entry->m_next = list;
-	list = entry;
+	append(list,func,client);
 }
 
 // This function removes a specific notification request.  If multiple
@@ -217,29 +141,32 @@ void
 MleNotifier::removeCallback(const void *key,
 	MleNotifierFunc func,const void *client)
 {
-	// Get the right list.
-	MleNotifierEntry **entry = &m_bucket[hash(key)];
+	MleNotifierList *list = (MleNotifierList *)m_lists->find(key);
 
-	while ( *entry )
+	// Search from the end for the most recent match.
+	unsigned int i = (list != NULL) ? list->m_numEntries : 0;
+	while ( i > 0 )
 	{
-		// Look for the right entry.
-		if ( (*entry)->m_key == key &&
-		     (*entry)->m_func == func &&
-		     (*entry)->m_client == client )
+		i--;
+		MleNotifierEntry *entry = &list->m_entries[i];
+		if ( entry->m_func == func && entry->m_client == client )
 		{
-			// Save the pointer.
-			MleNotifierEntry *tmp = *entry;
-
-			// Make the previous pointer skip over this entry.
-			*entry = (*entry)->m_next;
-
-			// Return the entry to the free list.
-			m_pool->put(tmp);
-
+			if ( list->m_busy )
+			{
+				// The list is being notified; leave the slot in place
+				//   so the notification loop does not skip anything.
+				entry->m_func = NULL;
+				list->m_numRemoved++;
+			}
+			else
+			{
+				list->m_numEntries--;
+				memmove(entry,entry + 1,(list->m_numEntries - i)*sizeof(MleNotifierEntry));
+				if ( list->m_numEntries == 0 )
+					release(key,list);
+			}
 			return;
 		}
-
-		entry = &(*entry)->m_next;
 	}
 
 	// shouldn't ever get here.
@@ -250,68 +177,80 @@ MleNotifier::removeCallback(const void *key,
 void
 MleNotifier::removeCallbacks(const void *key)
 {
-	// Get the right list.
-	MleNotifierEntry **entry = &m_bucket[hash(key)];
+	MleNotifierList *list = (MleNotifierList *)m_lists->find(key);
+	if ( list == NULL )
+		return;
 
-	while ( *entry )
+	if ( list->m_busy )
 	{
-		// Look for the right entry.
-		if ( (*entry)->m_key == key )
-		{
-			// Save the pointer
-			MleNotifierEntry *tmp = *entry;
-
-			// Make the previous pointer skip over this entry.
-			*entry = (*entry)->m_next;
+		// Defer the removal until the notification finishes.
+		for ( unsigned int i = 0; i < list->m_numEntries; i++ )
+			list->m_entries[i].m_func = NULL;
+		list->m_numRemoved = list->m_numEntries;
+	}
+	else
+		release(key,list);
+}
 
-			// Return the entry to the free list.
-			m_pool->put(tmp);
-		}
-		else
-			entry = &(*entry)->m_next;
+// This function notifies all interested parties who have registered with
+//   the passed key, in the order they registered.
+void
+MleNotifier::notify(const void *key) const
+{
+	MleNotifierList *list = (MleNotifierList *)m_lists->find(key);
+	if ( list == NULL )
+		return;
+
+	// Only call the entries present now.  The entries array is
+	//   indexed afresh on every pass because a callback may grow it.
+	unsigned int count = list->m_numEntries;
+	list->m_busy++;
+	for ( unsigned int i = 0; i < count; i++ )
+	{
+		MleNotifierFunc func = list->m_entries[i].m_func;
+		if ( func )
+			(*func)(key,list->m_entries[i].m_client);
 	}
+	list->m_busy--;
+
+	if ( list->m_busy == 0 && list->m_numRemoved )
+		compact(key,list);
 }
 
-// This static function does recursive traversal of a bucket.
-//   Recursion is used instead of iteration to allow post-order traversal.
-static void traverse(const void *key,MleNotifierEntry *entry)
+// This function notifies a batch of keys.
+void
+MleNotifier::notify(const void **keys,int numKeys) const
 {
-	if ( entry->m_next )
-		traverse(key,entry->m_next);
-	
-	if ( entry->m_key == key )
-		(*entry->m_func)(key,entry->m_client);
+	for ( int i = 0; i < numKeys; i++ )
+		notify(keys[i]);
 }
 
-// This function notifies all interested parties who have registered with
-//   the passed key.
+// This function squeezes out entries removed during notification.
 void
-MleNotifier::notify(const void *key) const
+MleNotifier::compact(const void *key,MleNotifierList *list) const
 {
-	// Pick the right bucket.
-	MleNotifierEntry *entry = m_bucket[hash(key)];
+	unsigned int n = 0;
+	for ( unsigned int i = 0; i < list->m_numEntries; i++ )
+	{
+		if ( list->m_entries[i].m_func )
+			list->m_entries[n++] = list->m_entries[i];
+	}
+	list->m_numEntries = n;
+	list->m_numRemoved = 0;
 
-	// This list can easily be traversed through iteration.  At a
-	//   slight cost, we traverse through recursion instead to execute
-	//   the list items from tail to head.  Because list items are
-	//   inserted at the head, this results in execution in the same
-	//   order as insertion.
-	if ( entry )
-		traverse(key,entry);
+	if ( n == 0 )
+		release(key,list);
 }
 
-// This is the default hash function, to map pointer values into
-//   bucket indices.
-unsigned int
-MleNotifier::hash(const void *key) const
+// This function removes a key and returns its list to the pool.
+void
+MleNotifier::release(const void *key,MleNotifierList *list) const
 {
-	unsigned int rval;
-
-	// This hash function is a little ad hoc, but seems to work
-	//   reasonably well.  It is the classic multiply/modulo thing.
-	rval = ((0xa74b2193*(unsigned long)key) >> 16) % m_nbuckets;
+	m_lists->remove(key);
 
-	return rval;
+	if ( list->m_entries != list->m_local )
+		mlFree(list->m_entries);
+	m_pool->put(list);
 }
 
 void *
@@ -0,0 +1,399 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MlePairingPq.cxx
+ * @ingroup MleFoundation
+ *
+ * This file implements the pairing heap Priority Queue object class for
+ * the Magic Lantern Runtime Engine.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <stdio.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+#include "mle/mlAssert.h"
+
+// Include Runtime Engine header files.
+#include "mle/MlePairingPq.h"
+
+
+//
+// MlePairingPQNode is a node of a pairing heap. The children of a node
+// are kept in a doubly linked sibling list; m_prev of the first child
+// points at the parent.
+//
+struct MlePairingPQNode
+{
+    MlePQItem m_item;             // the queued item
+    MlePairingPQNode *m_child;    // first child
+    MlePairingPQNode *m_next;     // next sibling
+    MlePairingPQNode *m_prev;     // previous sibling, or parent
+};
+
+
+MlePairingPQ::MlePairingPQ(int poolsize)
+    :m_root(NULL),
+     m_numItems(0),
+     m_ownPool(TRUE)
+{
+    m_pool = new MlePairingPQPool(poolsize);
+}
+
+
+MlePairingPQ::MlePairingPQ(MlePairingPQPool *pool)
+    :m_root(NULL),
+     m_numItems(0),
+     m_pool(pool),
+     m_ownPool(FALSE)
+{
+    // do nothing extra
+}
+
+
+MlePairingPQ::~MlePairingPQ(void)
+{
+    clear();
+    if (m_ownPool) delete m_pool;
+}
+
+
+void MlePairingPQ::insert(MlePQItem &item)
+{
+    insertWithHandle(item);
+}
+
+
+MlePairingPQHandle MlePairingPQ::insertWithHandle(MlePQItem &item)
+{
+    // declare local variables
+    MlePairingPQNode *node = m_pool->get();
+
+    node->m_item = item;
+    node->m_child = NULL;
+    node->m_next = NULL;
+    node->m_prev = NULL;
+
+    m_root = meld(m_root,node);
+    m_numItems++;
+
+    return(node);
+}
+
+
+MlBoolean MlePairingPQ::remove(MlePQItem &item)
+{
+    if (m_root == NULL) {
+        item.m_key = MLE_MIN_QPRIORITY;
+        item.m_data = NULL;
+        return(FALSE);
+    }
+
+    item = m_root->m_item;
+    destroy();
+
+    return(TRUE);
+}
+
+
+void MlePairingPQ::destroy(void)
+{
+    // declare local variables
+    MlePairingPQNode *oldRoot = m_root;
+
+    if (oldRoot == NULL) return;
+
+    m_root = combineSiblings(oldRoot->m_child);
+    m_pool->put(oldRoot);
+    m_numItems--;
+}
+
+
+void MlePairingPQ::destroyItem(MlePairingPQHandle handle)
+{
+    if (handle == NULL) return;
+    if (handle == m_root) {
+        destroy();
+        return;
+    }
+
+    // Cut the item out and merge its children back into the heap.
+    detach(handle);
+    m_root = meld(m_root,combineSiblings(handle->m_child));
+    m_pool->put(handle);
+    m_numItems--;
+}
+
+
+MlBoolean MlePairingPQ::changeItem(MlePairingPQHandle handle,int priority)
+{
+    // declare local variables
+    int prevKey;
+    MlePairingPQNode *children;
+
+    if (handle == NULL) return(FALSE);
+
+    prevKey = handle->m_item.m_key;
+    handle->m_item.m_key = priority;
+
+    if (priority > prevKey) {
+        // The subtree under the item is still a heap; cut it out
+        // and meld it with the root.
+        if (handle != m_root) {
+            detach(handle);
+            m_root = meld(m_root,handle);
+        }
+    } else if (priority < prevKey) {
+        // The children may now outrank the item; merge them back in
+        // separately.
+        children = handle->m_child;
+        handle->m_child = NULL;
+        if (handle == m_root)
+            m_root = meld(handle,combineSiblings(children));
+        else {
+            detach(handle);
+            m_root = meld(m_root,meld(handle,combineSiblings(children)));
+        }
+    }
+
+    return(TRUE);
+}
+
+
+MlBoolean MlePairingPQ::peek(MlePQItem &item)
+{
+    return(peek(m_root,item));
+}
+
+
+MlBoolean MlePairingPQ::peek(MlePairingPQHandle handle,MlePQItem &item)
+{
+    if (handle == NULL) {
+        item.m_key = MLE_MIN_QPRIORITY;
+        item.m_data = NULL;
+        return(FALSE);
+    }
+
+    item = handle->m_item;
+    return(TRUE);
+}
+
+
+MlePairingPQHandle MlePairingPQ::findItem(MlePQCallback func,void *clientData)
+{
+    // declare local variables
+    MlePairingPQNode *node = m_root;
+
+    // Walk the heap in preorder without a stack.
+    while (node != NULL) {
+        if (func(node->m_item,clientData))
+            return(node);
+
+        if (node->m_child != NULL) {
+            node = node->m_child;
+            continue;
+        }
+
+        // Climb until a node with a next sibling is found. The parent
+        // of a sibling list hangs off m_prev of its first node.
+        while ((node != NULL) && (node->m_next == NULL)) {
+            while ((node->m_prev != NULL) && (node->m_prev->m_child != node))
+                node = node->m_prev;
+            node = node->m_prev;
+        }
+        if (node != NULL)
+            node = node->m_next;
+    }
+
+    return(NULL);
+}
+
+
+void MlePairingPQ::clear(void)
+{
+    // declare local variables
+    MlePairingPQNode *list = m_root;
+    MlePairingPQNode *node,*last;
+
+    // Return every node to the pool, splicing the children of each
+    // node into the work list as it is released.
+    while (list != NULL) {
+        node = list;
+        list = node->m_next;
+        if (node->m_child != NULL) {
+            last = node->m_child;
+            while (last->m_next != NULL)
+                last = last->m_next;
+            last->m_next = list;
+            list = node->m_child;
+        }
+        m_pool->put(node);
+    }
+
+    m_root = NULL;
+    m_numItems = 0;
+}
+
+
+void MlePairingPQ::join(MlePairingPQ &queue)
+{
+    if ((&queue == this) || (queue.m_root == NULL)) return;
+
+    if (queue.m_pool == m_pool) {
+        // Nodes come from the same pool, so just meld the heaps.
+        m_root = meld(m_root,queue.m_root);
+        m_numItems += queue.m_numItems;
+    } else {
+        // Copy the items in; their nodes belong to the other pool.
+        MlePQItem item;
+        while (queue.remove(item))
+            insert(item);
+        return;
+    }
+
+    queue.m_root = NULL;
+    queue.m_numItems = 0;
+}
+
+
+//
+// Merge two heaps by making the root with the lower priority the first
+// child of the other.
+//
+MlePairingPQNode *MlePairingPQ::meld(MlePairingPQNode *a,MlePairingPQNode *b)
+{
+    // declare local variables
+    MlePairingPQNode *tmp;
+
+    if (a == NULL) return(b);
+    if (b == NULL) return(a);
+
+    if (b->m_item.m_key > a->m_item.m_key) {
+        tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    b->m_prev = a;
+    b->m_next = a->m_child;
+    if (a->m_child != NULL)
+        a->m_child->m_prev = b;
+    a->m_child = b;
+
+    a->m_next = NULL;
+    a->m_prev = NULL;
+
+    return(a);
+}
+
+
+//
+// Merge a sibling list. The first pass melds the siblings in pairs from
+// left to right; the second melds the pairs from right to left. Both
+// passes are iterative, so long sibling lists do not deepen the stack.
+//
+MlePairingPQNode *MlePairingPQ::combineSiblings(MlePairingPQNode *first)
+{
+    // declare local variables
+    MlePairingPQNode *pairs = NULL;
+    MlePairingPQNode *a,*b,*next,*result;
+
+    if (first == NULL) return(NULL);
+
+    // First pass; collect the melded pairs in reverse order.
+    while (first != NULL) {
+        a = first;
+        b = a->m_next;
+        if (b == NULL) {
+            a->m_prev = NULL;
+            a->m_next = pairs;
+            pairs = a;
+            break;
+        }
+        first = b->m_next;
+
+        a->m_next = a->m_prev = NULL;
+        b->m_next = b->m_prev = NULL;
+        a = meld(a,b);
+        a->m_next = pairs;
+        pairs = a;
+    }
+
+    // Second pass; meld the pairs, rightmost first.
+    result = pairs;
+    pairs = pairs->m_next;
+    result->m_next = NULL;
+    while (pairs != NULL) {
+        next = pairs->m_next;
+        pairs->m_next = NULL;
+        result = meld(result,pairs);
+        pairs = next;
+    }
+
+    return(result);
+}
+
+
+void MlePairingPQ::detach(MlePairingPQNode *node)
+{
+    MLE_ASSERT(node->m_prev != NULL);
+
+    if (node->m_prev->m_child == node)
+        node->m_prev->m_child = node->m_next;
+    else
+        node->m_prev->m_next = node->m_next;
+    if (node->m_next != NULL)
+        node->m_next->m_prev = node->m_prev;
+
+    node->m_next = NULL;
+    node->m_prev = NULL;
+}
+
+
+void *
+MlePairingPQ::operator new(size_t tSize)
+{
+    void *p = mlMalloc(tSize);
+    return p;
+}
+
+
+void
+MlePairingPQ::operator delete(void *p)
+{
+    mlFree(p);
+}
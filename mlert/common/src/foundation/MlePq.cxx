@@ -58,43 +58,194 @@
 
 // Include Magic Lantern header files.
 #include "mle/mlMalloc.h"
+#include "mle/mlAssert.h"
 
 // Include Runtime Engine header files.
 #include "mle/MlePq.h"
 
 
+//
+// MlePQIndexEntry tracks an item in an indexed queue. Internally the
+// handle of the item is its index into the handle table; the handles
+// given out also carry the entry's generation. Live handles are chained
+// into two hash tables, one over item priorities and one over item data;
+// free handles are chained through m_keyNext.
+//
+struct MlePQIndexEntry
+{
+    unsigned int m_position;   // queue slot of the item, 0 if free
+    unsigned int m_generation; // 1 to MLE_PQ_MAX_GENERATION
+    unsigned int m_keyNext;    // next handle in priority chain
+    unsigned int m_keyPrev;    // previous handle in priority chain
+    unsigned int m_dataNext;   // next handle in data chain
+    unsigned int m_dataPrev;   // previous handle in data chain
+};
+
+
+// Map a priority into a hash chain.
+static inline unsigned int _mlePQHashKey(int key,unsigned int numBuckets)
+{
+    unsigned int h = (unsigned int)key * 0x9e3779b1;
+    return((h ^ (h >> 16)) & (numBuckets - 1));
+}
+
+
+// Map item data into a hash chain.
+static inline unsigned int _mlePQHashData(const void *data,unsigned int numBuckets)
+{
+    unsigned int h = (unsigned int)((size_t)data >> 3) * 0x9e3779b1;
+    return((h ^ (h >> 16)) & (numBuckets - 1));
+}
+
+
 MlePQ::MlePQ(void)
     :m_fpqQueue(NULL),
      m_fpqSize(0),
-     m_fpqNumItems(0)
+     m_fpqNumItems(0),
+     m_fpqIndexed(FALSE),
+     m_fpqHandles(NULL),
+     m_fpqIndex(NULL),
+     m_fpqFreeHandle(0),
+     m_fpqKeyBucket(NULL),
+     m_fpqDataBucket(NULL),
+     m_fpqNumBuckets(0),
+     m_fpqIndexSize(0)
 {
     // do nothing extra
 }
 
 
 MlePQ::MlePQ(unsigned int size)
+    :m_fpqIndexed(FALSE),
+     m_fpqHandles(NULL),
+     m_fpqIndex(NULL),
+     m_fpqFreeHandle(0),
+     m_fpqKeyBucket(NULL),
+     m_fpqDataBucket(NULL),
+     m_fpqNumBuckets(0),
+     m_fpqIndexSize(0)
+{
+    m_fpqQueue = new MlePQItem[size + 1];
+    m_fpqSize = size;
+    m_fpqNumItems = 0;
+}
+
+
+MlePQ::MlePQ(unsigned int size, MlBoolean indexed)
+    :m_fpqIndexed(indexed),
+     m_fpqHandles(NULL),
+     m_fpqIndex(NULL),
+     m_fpqFreeHandle(0),
+     m_fpqKeyBucket(NULL),
+     m_fpqDataBucket(NULL),
+     m_fpqNumBuckets(0),
+     m_fpqIndexSize(0)
 {
     m_fpqQueue = new MlePQItem[size + 1];
     m_fpqSize = size;
     m_fpqNumItems = 0;
+
+    if (m_fpqIndexed) {
+        m_fpqHandles = new unsigned int[size + 1];
+        growIndex();
+    }
+}
+
+MlePQ::MlePQ(const MlePQItem *items, unsigned int numItems, MlBoolean indexed)
+    :m_fpqIndexed(indexed),
+     m_fpqHandles(NULL),
+     m_fpqIndex(NULL),
+     m_fpqFreeHandle(0),
+     m_fpqKeyBucket(NULL),
+     m_fpqDataBucket(NULL),
+     m_fpqNumBuckets(0),
+     m_fpqIndexSize(0)
+{
+    m_fpqQueue = new MlePQItem[numItems + 1];
+    m_fpqSize = numItems;
+    m_fpqNumItems = 0;
+
+    if (m_fpqIndexed) {
+        m_fpqHandles = new unsigned int[numItems + 1];
+        growIndex();
+    }
+
+    // Copy the items in and build the heap bottom-up.
+    append(items,numItems);
+    heapify();
 }
 
 MlePQ::~MlePQ(void)
 {
     if (m_fpqQueue) delete [] m_fpqQueue;
+    if (m_fpqHandles) delete [] m_fpqHandles;
+    if (m_fpqIndex) delete [] m_fpqIndex;
+    if (m_fpqKeyBucket) delete [] m_fpqKeyBucket;
+    if (m_fpqDataBucket) delete [] m_fpqDataBucket;
 }
 
 
 void MlePQ::insert(MlePQItem &item)
 {
+    insertWithHandle(item);
+}
+
+
+MlePQHandle MlePQ::insertWithHandle(MlePQItem &item)
+{
+    // declare local variables
+    unsigned int handle = 0;
+
     // Grow m_fpqQueue if needed
     if (m_fpqNumItems == m_fpqSize)
         grow();
 
     // Insert item
     m_fpqNumItems++;
-    m_fpqQueue[m_fpqNumItems] = item;
+    if (m_fpqIndexed) {
+        handle = allocHandle();
+        setSlot(m_fpqNumItems,item,handle);
+        linkHandle(handle);
+    } else
+        m_fpqQueue[m_fpqNumItems] = item;
     upHeap(m_fpqNumItems);
+
+    if (handle == 0)
+        return(0);
+    return((m_fpqIndex[handle].m_generation << MLE_PQ_INDEX_BITS) | handle);
+}
+
+
+void MlePQ::insertBulk(const MlePQItem *items, unsigned int numItems)
+{
+    // declare local variables
+    unsigned int first = m_fpqNumItems + 1;
+
+    if (numItems == 0) return;
+
+    // Grow m_fpqQueue once for all of the items
+    if (! reserve(m_fpqNumItems + numItems))
+        return;
+
+    append(items,numItems);
+
+    // Rebuilding the heap costs O(n) while sifting each new item up
+    // costs O(m log n); rebuild when the batch is the larger part.
+    if (numItems >= first - 1)
+        heapify();
+    else {
+        for (unsigned int k = first; k <= m_fpqNumItems; k++)
+            upHeap(k);
+    }
+}
+
+
+MlBoolean MlePQ::reserve(unsigned int size)
+{
+    if (size <= m_fpqSize)
+        return(TRUE);
+
+    return(_grow(size - m_fpqSize));
 }
 
 
@@ -110,11 +261,15 @@ MlBoolean MlePQ::remove(MlePQItem &item)
         retValue = FALSE;
     } else if (m_fpqNumItems == 1) {
         // check to see if there is only one item in the queue
+        if (m_fpqIndexed) freeHandle(m_fpqHandles[1]);
         item = m_fpqQueue[m_fpqNumItems--];
     } else
     {
         item = m_fpqQueue[1];
-        m_fpqQueue[1] = m_fpqQueue[m_fpqNumItems--];
+        if (m_fpqIndexed) freeHandle(m_fpqHandles[1]);
+        setSlot(1,m_fpqQueue[m_fpqNumItems],
+            m_fpqIndexed ? m_fpqHandles[m_fpqNumItems] : 0);
+        m_fpqNumItems--;
         downHeap(1);
     }
 
@@ -129,19 +284,49 @@ MlBoolean MlePQ::remove(int priority,MlePQItem **items,unsigned int *numItems)
     MlePQItem *foundQ;
     MlBoolean retValue = TRUE;
 
-    // allocate enough space for potential "hit" list
-    foundQ = new MlePQItem[m_fpqNumItems];
+    if (m_fpqIndexed) {
+        // count the matching items on the priority chain so that the
+        // "hit" list is sized to the result
+        unsigned int bucket = _mlePQHashKey(priority,m_fpqNumBuckets);
+        unsigned int handle;
 
-    // find matching items
-    while((k = findItem(priority)) != 0) {
-        foundQ[numFound++] = m_fpqQueue[k];
-        destroyItem(k);
+        for (handle = m_fpqKeyBucket[bucket]; handle != 0;
+             handle = m_fpqIndex[handle].m_keyNext) {
+            if (m_fpqQueue[m_fpqIndex[handle].m_position].m_key == priority)
+                numFound++;
+        }
+
+        if (numFound > 0) {
+            foundQ = new MlePQItem[numFound];
+            numFound = 0;
+
+            // destroying an item only unlinks its own handle, so the
+            // chain can be walked while removing
+            handle = m_fpqKeyBucket[bucket];
+            while (handle != 0) {
+                unsigned int next = m_fpqIndex[handle].m_keyNext;
+                k = m_fpqIndex[handle].m_position;
+                if (m_fpqQueue[k].m_key == priority) {
+                    foundQ[numFound++] = m_fpqQueue[k];
+                    destroyItem(k);
+                }
+                handle = next;
+            }
+        }
+    } else {
+        // allocate enough space for potential "hit" list
+        foundQ = new MlePQItem[m_fpqNumItems];
+
+        // remove matching items
+        numFound = removeMatching(priority,foundQ);
+
+        if (! numFound)
+            delete [] foundQ;
     }
 
     if (! numFound) {
         *items = NULL;
         *numItems = 0;
-        delete [] foundQ;
         retValue = FALSE;
     } else {
         *items = foundQ;
@@ -155,7 +340,18 @@ MlBoolean MlePQ::remove(int priority,MlePQItem **items,unsigned int *numItems)
 MlBoolean MlePQ::replace(MlePQItem &item)
 {
     m_fpqQueue[0] = item;
+    if (m_fpqIndexed) {
+        // the handle table always has one spare handle for slot 0
+        unsigned int handle = allocHandle();
+        m_fpqHandles[0] = handle;
+        m_fpqIndex[handle].m_position = 0;
+        linkHandle(handle);
+    }
     downHeap(0);
+    if (m_fpqIndexed) {
+        // release whichever item was pushed out of the heap
+        freeHandle(m_fpqHandles[0]);
+    }
     if ((item.m_key == m_fpqQueue[0].m_key) && (item.m_data == m_fpqQueue[0].m_data))
         return(FALSE);
     else
@@ -174,10 +370,21 @@ void MlePQ::destroy(int priority)
     // declare local variables
     unsigned int k;
 
-    // delete all items of specified weight
-    while((k = findItem(priority)) != 0) {
-        destroyItem(k);
+    if (m_fpqIndexed) {
+        // walk the priority chain instead of searching the queue
+        unsigned int handle = m_fpqKeyBucket[_mlePQHashKey(priority,m_fpqNumBuckets)];
+        while (handle != 0) {
+            unsigned int next = m_fpqIndex[handle].m_keyNext;
+            k = m_fpqIndex[handle].m_position;
+            if (m_fpqQueue[k].m_key == priority)
+                destroyItem(k);
+            handle = next;
+        }
+        return;
     }
+
+    // delete all items of specified weight
+    removeMatching(priority,NULL);
 }
 
 
@@ -259,12 +466,19 @@ void MlePQ::printSorted(void)
 void MlePQ::clear(void)
 {
     m_fpqNumItems = 0;
+    if (m_fpqIndexed)
+        resetIndex();
 }
 
 
 MlBoolean MlePQ::grow(void)
 {
-    return(_grow(MLE_INC_QSIZE));
+    // Double the queue, so that filling it item by item copies
+    // the queue a logarithmic number of times.
+    if (m_fpqSize < MLE_INC_QSIZE)
+        return(_grow(MLE_INC_QSIZE));
+    else
+        return(_grow(m_fpqSize));
 }
 
 
@@ -282,8 +496,10 @@ void MlePQ::upHeap(unsigned int k)
 {
     // declare local variables
     MlePQItem curItem;
+    unsigned int curHandle;
 
     curItem = m_fpqQueue[k];
+    curHandle = m_fpqIndexed ? m_fpqHandles[k] : 0;
 
     // Put a sentinel key (miximum priority) in m_fpqQueue[0] to stop the
     // the loop for the case that priority is greater than all the keys
@@ -293,9 +509,13 @@ void MlePQ::upHeap(unsigned int k)
     while(m_fpqQueue[k/2].m_key <= curItem.m_key)
     {
         m_fpqQueue[k] = m_fpqQueue[k/2];
+        if (m_fpqIndexed) {
+            m_fpqHandles[k] = m_fpqHandles[k/2];
+            m_fpqIndex[m_fpqHandles[k]].m_position = k;
+        }
         k = k/2;
     }
-    m_fpqQueue[k] = curItem;
+    setSlot(k,curItem,curHandle);
 }
 
 
@@ -307,9 +527,11 @@ void MlePQ::downHeap(unsigned int k)
 {
     // declare local variables
     MlePQItem curItem;
+    unsigned int curHandle;
     unsigned int j;
 
     curItem = m_fpqQueue[k];
+    curHandle = m_fpqIndexed ? m_fpqHandles[k] : 0;
 
     unsigned int loopCnd = m_fpqNumItems/2;
     while(k <= loopCnd) {
@@ -318,9 +540,78 @@ void MlePQ::downHeap(unsigned int k)
             (m_fpqQueue[j].m_key < m_fpqQueue[j + 1].m_key)) j++;
         if (curItem.m_key >= m_fpqQueue[j].m_key) break;
         m_fpqQueue[k] = m_fpqQueue[j];
+        if (m_fpqIndexed) {
+            m_fpqHandles[k] = m_fpqHandles[j];
+            m_fpqIndex[m_fpqHandles[k]].m_position = k;
+        }
         k = j;
     }
-    m_fpqQueue[k] = curItem;
+    setSlot(k,curItem,curHandle);
+}
+
+
+//
+// This method restores the heap condition over the whole queue (Floyd's
+// method). Every subtree rooted below m_fpqNumItems/2 is a leaf, so
+// sifting down each interior node, bottom-up, builds the heap in O(n).
+//
+void MlePQ::heapify(void)
+{
+    for (unsigned int k = m_fpqNumItems/2; k >= 1; k--)
+        downHeap(k);
+}
+
+
+//
+// This method copies items onto the end of the queue. The caller must
+// have made room for them, and must restore the heap condition.
+//
+void MlePQ::append(const MlePQItem *items,unsigned int numItems)
+{
+    MLE_ASSERT(m_fpqNumItems + numItems <= m_fpqSize);
+
+    if (m_fpqIndexed) {
+        for (unsigned int i = 0; i < numItems; i++) {
+            unsigned int handle = allocHandle();
+            m_fpqNumItems++;
+            setSlot(m_fpqNumItems,items[i],handle);
+            linkHandle(handle);
+        }
+    } else if (numItems > 0) {
+        memcpy(&m_fpqQueue[m_fpqNumItems + 1],items,numItems * sizeof(MlePQItem));
+        m_fpqNumItems += numItems;
+    }
+}
+
+
+//
+// This method removes every item of the specified priority in a single
+// pass, compacting the remaining items and then rebuilding the heap.
+// The removed items are copied to "found" if it is not NULL.
+//
+unsigned int MlePQ::removeMatching(int priority,MlePQItem *found)
+{
+    // declare local variables
+    unsigned int k,j = 0,numFound = 0;
+
+    for (k = 1; k <= m_fpqNumItems; k++) {
+        if (m_fpqQueue[k].m_key == priority) {
+            if (found) found[numFound] = m_fpqQueue[k];
+            numFound++;
+            if (m_fpqIndexed) freeHandle(m_fpqHandles[k]);
+        } else {
+            j++;
+            if (j != k)
+                setSlot(j,m_fpqQueue[k],m_fpqIndexed ? m_fpqHandles[k] : 0);
+        }
+    }
+
+    if (numFound > 0) {
+        m_fpqNumItems = j;
+        heapify();
+    }
+
+    return(numFound);
 }
 
 
@@ -342,33 +633,235 @@ MlBoolean MlePQ::_grow(unsigned int size)
         return(FALSE);
     } else {
         if (m_fpqQueue) {
-            memcpy(newQ,m_fpqQueue,(m_fpqSize + 1) * sizeof(MlePQItem));
+            memcpy(newQ,m_fpqQueue,(m_fpqNumItems + 1) * sizeof(MlePQItem));
             delete [] m_fpqQueue;
         }
         m_fpqQueue = newQ;
     }
 
+    if (m_fpqIndexed) {
+        // the slot to handle map grows with the queue
+        unsigned int *newHandles = new unsigned int[memSize];
+        if (newHandles == NULL)
+            return(FALSE);
+        if (m_fpqHandles) {
+            memcpy(newHandles,m_fpqHandles,(m_fpqNumItems + 1) * sizeof(unsigned int));
+            delete [] m_fpqHandles;
+        }
+        m_fpqHandles = newHandles;
+    }
+
     // bump size of queue
     m_fpqSize += size;
 
+    if (m_fpqIndexed)
+        return(growIndex());
+
     return(TRUE);
 }
 
 
+//
+// This method sizes the handle table and hash chains to the queue.
+// The handle table holds one more live handle than the queue size so
+// that replace() may temporarily place an item in slot 0.
+//
+MlBoolean MlePQ::growIndex(void)
+{
+    // declare local variables
+    unsigned int newSize = m_fpqSize + 2;
+    unsigned int numBuckets;
+    MlePQIndexEntry *newIndex;
+
+    // handles only have room for so many entries
+    MLE_ASSERT(newSize <= MLE_PQ_INDEX_MASK + 1);
+    if (newSize > MLE_PQ_INDEX_MASK + 1)
+        return(FALSE);
+
+    newIndex = new MlePQIndexEntry[newSize];
+    if (newIndex == NULL)
+        return(FALSE);
+    if (m_fpqIndex) {
+        memcpy(newIndex,m_fpqIndex,m_fpqIndexSize * sizeof(MlePQIndexEntry));
+        delete [] m_fpqIndex;
+    } else {
+        memset(&newIndex[0],0,sizeof(MlePQIndexEntry));
+        m_fpqIndexSize = 1;
+    }
+    m_fpqIndex = newIndex;
+
+    // put the new handles on the free list, lowest handle first
+    for (unsigned int handle = newSize - 1; handle >= m_fpqIndexSize; handle--) {
+        m_fpqIndex[handle].m_position = 0;
+        m_fpqIndex[handle].m_generation = 1;
+        m_fpqIndex[handle].m_keyNext = m_fpqFreeHandle;
+        m_fpqFreeHandle = handle;
+    }
+    m_fpqIndexSize = newSize;
+
+    // keep the hash chains short by sizing them to the handle table
+    numBuckets = 16;
+    while (numBuckets < newSize)
+        numBuckets <<= 1;
+    if (numBuckets != m_fpqNumBuckets) {
+        if (m_fpqKeyBucket) delete [] m_fpqKeyBucket;
+        if (m_fpqDataBucket) delete [] m_fpqDataBucket;
+        m_fpqKeyBucket = new unsigned int[numBuckets];
+        m_fpqDataBucket = new unsigned int[numBuckets];
+        if ((m_fpqKeyBucket == NULL) || (m_fpqDataBucket == NULL))
+            return(FALSE);
+        m_fpqNumBuckets = numBuckets;
+        memset(m_fpqKeyBucket,0,numBuckets * sizeof(unsigned int));
+        memset(m_fpqDataBucket,0,numBuckets * sizeof(unsigned int));
+
+        // rehash the items already in the queue
+        for (unsigned int k = 1; k <= m_fpqNumItems; k++)
+            linkHandle(m_fpqHandles[k]);
+    }
+
+    return(TRUE);
+}
+
+
+//
+// This method empties the index, returning every handle to the free list.
+//
+void MlePQ::resetIndex(void)
+{
+    memset(m_fpqKeyBucket,0,m_fpqNumBuckets * sizeof(unsigned int));
+    memset(m_fpqDataBucket,0,m_fpqNumBuckets * sizeof(unsigned int));
+
+    m_fpqFreeHandle = 0;
+    for (unsigned int handle = m_fpqIndexSize - 1; handle > 0; handle--) {
+        if (m_fpqIndex[handle].m_position != 0)
+            bumpGeneration(handle);
+        m_fpqIndex[handle].m_position = 0;
+        m_fpqIndex[handle].m_keyNext = m_fpqFreeHandle;
+        m_fpqFreeHandle = handle;
+    }
+}
+
+
+//
+// This method adds a handle to the head of its priority and data chains.
+// The item referenced by the handle must already be in its queue slot.
+//
+void MlePQ::linkHandle(unsigned int handle)
+{
+    // declare local variables
+    MlePQIndexEntry &entry = m_fpqIndex[handle];
+    MlePQItem &item = m_fpqQueue[entry.m_position];
+    unsigned int &keyList = m_fpqKeyBucket[_mlePQHashKey(item.m_key,m_fpqNumBuckets)];
+    unsigned int &dataList = m_fpqDataBucket[_mlePQHashData(item.m_data,m_fpqNumBuckets)];
+
+    entry.m_keyPrev = 0;
+    entry.m_keyNext = keyList;
+    if (keyList != 0)
+        m_fpqIndex[keyList].m_keyPrev = handle;
+    keyList = handle;
+
+    entry.m_dataPrev = 0;
+    entry.m_dataNext = dataList;
+    if (dataList != 0)
+        m_fpqIndex[dataList].m_dataPrev = handle;
+    dataList = handle;
+}
+
+
+//
+// This method removes a handle from its priority and data chains.
+// The item referenced by the handle must still be in its queue slot.
+//
+void MlePQ::unlinkHandle(unsigned int handle)
+{
+    // declare local variables
+    MlePQIndexEntry &entry = m_fpqIndex[handle];
+    MlePQItem &item = m_fpqQueue[entry.m_position];
+
+    if (entry.m_keyPrev != 0)
+        m_fpqIndex[entry.m_keyPrev].m_keyNext = entry.m_keyNext;
+    else
+        m_fpqKeyBucket[_mlePQHashKey(item.m_key,m_fpqNumBuckets)] = entry.m_keyNext;
+    if (entry.m_keyNext != 0)
+        m_fpqIndex[entry.m_keyNext].m_keyPrev = entry.m_keyPrev;
+
+    if (entry.m_dataPrev != 0)
+        m_fpqIndex[entry.m_dataPrev].m_dataNext = entry.m_dataNext;
+    else
+        m_fpqDataBucket[_mlePQHashData(item.m_data,m_fpqNumBuckets)] = entry.m_dataNext;
+    if (entry.m_dataNext != 0)
+        m_fpqIndex[entry.m_dataNext].m_dataPrev = entry.m_dataPrev;
+}
+
+
+//
+// This method retires the handles given out for an entry, so that they
+// do not find the next item to use it.
+//
+void MlePQ::bumpGeneration(unsigned int handle)
+{
+    if (++m_fpqIndex[handle].m_generation > MLE_PQ_MAX_GENERATION)
+        m_fpqIndex[handle].m_generation = 1;
+}
+
+
+unsigned int MlePQ::allocHandle(void)
+{
+    // declare local variables
+    unsigned int handle = m_fpqFreeHandle;
+
+    MLE_ASSERT(handle != 0);
+    m_fpqFreeHandle = m_fpqIndex[handle].m_keyNext;
+
+    return(handle);
+}
+
+
+void MlePQ::freeHandle(unsigned int handle)
+{
+    unlinkHandle(handle);
+    bumpGeneration(handle);
+    m_fpqIndex[handle].m_position = 0;
+    m_fpqIndex[handle].m_keyNext = m_fpqFreeHandle;
+    m_fpqFreeHandle = handle;
+}
+
+
+//
+// This method stores an item, and for indexed queues its handle, at
+// location m_fpqQueue[k].
+//
+void MlePQ::setSlot(unsigned int k,const MlePQItem &item,unsigned int handle)
+{
+    m_fpqQueue[k] = item;
+    if (m_fpqIndexed) {
+        m_fpqHandles[k] = handle;
+        m_fpqIndex[handle].m_position = k;
+    }
+}
+
+
 MlBoolean MlePQ::changeItem(unsigned int k,int priority)
 {
     // declare local variables
-    MlePQItem item;
+    int prevKey;
     MlBoolean retValue = TRUE;
 
     // check to see if there are any items in the queue
     if ((k == 0) || (k > m_fpqNumItems) || (m_fpqNumItems == 0)) {
         retValue = FALSE;
     } else {
-        item.m_key = priority;
-        item.m_data = m_fpqQueue[k].m_data;
-        destroyItem(k);
-        insert(item);
+        prevKey = m_fpqQueue[k].m_key;
+        if (prevKey != priority) {
+            // move the item to its new priority chain
+            if (m_fpqIndexed) unlinkHandle(m_fpqHandles[k]);
+            m_fpqQueue[k].m_key = priority;
+            if (m_fpqIndexed) linkHandle(m_fpqHandles[k]);
+
+            // and to its new place in the heap
+            if (priority > prevKey) upHeap(k);
+            else downHeap(k);
+        }
     }
 
     return(retValue);
@@ -382,18 +875,29 @@ void MlePQ::destroyItem(unsigned int k)
 
     // check to see if there are any items in the queue
     if ((k == 0) || (k > m_fpqNumItems) || (m_fpqNumItems == 0)) return;
-    else if (m_fpqNumItems == 1) {
+
+    if (m_fpqIndexed) freeHandle(m_fpqHandles[k]);
+
+    if ((m_fpqNumItems == 1) || (k == m_fpqNumItems)) {
         m_fpqNumItems--;
         return;
     }
 
     prevKey = m_fpqQueue[k].m_key;
-    m_fpqQueue[k] = m_fpqQueue[m_fpqNumItems--];
+    setSlot(k,m_fpqQueue[m_fpqNumItems],
+        m_fpqIndexed ? m_fpqHandles[m_fpqNumItems] : 0);
+    m_fpqNumItems--;
     if (m_fpqQueue[k].m_key < prevKey) downHeap(k);
     else if (m_fpqQueue[k].m_key > prevKey) upHeap(k);
 }
 
 
+MlBoolean MlePQ::peek(MlePQItem &item)
+{
+    return(peek(1,item));
+}
+
+
 MlBoolean MlePQ::peek(unsigned int k,MlePQItem &item)
 {
     // declare local variables
@@ -418,6 +922,17 @@ unsigned int MlePQ::findItem(int priority)
     MlBoolean notFound = TRUE;
     unsigned int i = 1;
 
+    if (m_fpqIndexed) {
+        // search the priority chain
+        unsigned int handle = m_fpqKeyBucket[_mlePQHashKey(priority,m_fpqNumBuckets)];
+        while (handle != 0) {
+            i = m_fpqIndex[handle].m_position;
+            if (m_fpqQueue[i].m_key == priority) return(i);
+            handle = m_fpqIndex[handle].m_keyNext;
+        }
+        return(0);
+    }
+
     // find first item with specified priority
     while((notFound) && (i <= m_fpqNumItems)) {
         if (m_fpqQueue[i].m_key == priority) notFound = FALSE;
@@ -435,6 +950,18 @@ unsigned int MlePQ::findItem(MlePQItem &item)
     MlBoolean notFound = TRUE;
     unsigned int i = 1;
 
+    if (m_fpqIndexed) {
+        // search the data chain
+        unsigned int handle = m_fpqDataBucket[_mlePQHashData(item.m_data,m_fpqNumBuckets)];
+        while (handle != 0) {
+            i = m_fpqIndex[handle].m_position;
+            if ((m_fpqQueue[i].m_key == item.m_key) && (m_fpqQueue[i].m_data == item.m_data))
+                return(i);
+            handle = m_fpqIndex[handle].m_dataNext;
+        }
+        return(0);
+    }
+
     // find first item with specified priority
     while((notFound) && (i <= m_fpqNumItems)) {
         if ((m_fpqQueue[i].m_key == item.m_key) &&(m_fpqQueue[i].m_data == item.m_data))
@@ -465,40 +992,91 @@ unsigned int MlePQ::findItem(MlePQCallback func,void *clientData)
 }
 
 
+unsigned int MlePQ::findHandle(MlePQHandle handle)
+{
+    // declare local variables
+    unsigned int index = handle & MLE_PQ_INDEX_MASK;
+
+    if ((! m_fpqIndexed) || (index == 0) || (index >= m_fpqIndexSize))
+        return(0);
+
+    // a handle from an earlier use of the entry finds nothing
+    if (m_fpqIndex[index].m_generation != (handle >> MLE_PQ_INDEX_BITS))
+        return(0);
+
+    return(m_fpqIndex[index].m_position);
+}
+
+
+MlePQHandle MlePQ::getHandle(unsigned int k)
+{
+    // declare local variables
+    unsigned int index;
+
+    if ((! m_fpqIndexed) || (k == 0) || (k > m_fpqNumItems))
+        return(0);
+
+    index = m_fpqHandles[k];
+    return((m_fpqIndex[index].m_generation << MLE_PQ_INDEX_BITS) | index);
+}
+
+
+//
+// Sift queue[k] down a 0-based heap of numItems items.
+//
+static void _mlePQSiftDown(MlePQItem *queue,int k,int numItems)
+{
+    // declare local variables
+    MlePQItem curItem = queue[k];
+    int j;
+
+    while ((j = k + k + 1) < numItems) {
+        if ((j + 1 < numItems) && (queue[j].m_key < queue[j + 1].m_key)) j++;
+        if (curItem.m_key >= queue[j].m_key) break;
+        queue[k] = queue[j];
+        k = j;
+    }
+    queue[k] = curItem;
+}
+
+
 void MlePQ::sort(MlePQItem *queue, int numItems)
 {
     // declare local variables
     int i;
-    MlePQ heap(numItems);
+    MlePQItem tmpItem;
 
-    for (i = 0; i < numItems; i++)
-        heap.insert(queue[i]);
-    for (i = --numItems; i >= 0; i--)
-        heap.remove(queue[i]);
+    if (numItems < 2) return;
+
+    // Build the heap in place, highest priority at queue[0].
+    for (i = numItems/2 - 1; i >= 0; i--)
+        _mlePQSiftDown(queue,i,numItems);
+
+    // Repeatedly move the highest remaining priority behind the heap.
+    for (i = numItems - 1; i > 0; i--) {
+        tmpItem = queue[0];
+        queue[0] = queue[i];
+        queue[i] = tmpItem;
+        _mlePQSiftDown(queue,0,i);
+    }
 }
 
 
 MlePQ *MlePQ::join(MlePQ &pq1,MlePQ &pq2)
 {
     // declare local variables
-    unsigned int i,numItems;
+    unsigned int numItems;
     MlePQ *heap;
-    MlePQItem *tmpQ1,*tmpQ2;
 
-    // construct a new queue
+    // construct a new queue from the concatenated queues
     numItems = pq1.getNumItems() + pq2.getNumItems();
     if (numItems > 0) {
-        heap = new MlePQ(numItems);
-
-        if (pq1.copyQueue(&tmpQ1) > 0)
-            for (i = 0; i < pq1.getNumItems(); i++)
-                heap->insert(tmpQ1[i]);
-        if (pq2.copyQueue(&tmpQ2) > 0)
-            for (i = 0; i < pq2.getNumItems(); i++)
-                heap->insert(tmpQ2[i]);
-
-        if (tmpQ1) delete [] tmpQ1;
-        if (tmpQ2) delete [] tmpQ2;
+        heap = new MlePQ(numItems,pq1.isIndexed());
+        if (pq1.getNumItems() > 0)
+            heap->append(&pq1.m_fpqQueue[1],pq1.getNumItems());
+        if (pq2.getNumItems() > 0)
+            heap->append(&pq2.m_fpqQueue[1],pq2.getNumItems());
+        heap->heapify();
     } else
         heap = NULL;
 
@@ -508,21 +1086,17 @@ MlePQ *MlePQ::join(MlePQ &pq1,MlePQ &pq2)
 
 void MlePQ::operator =(MlePQ &queue)
 {
-    // declare local variables
-    MlePQItem item;
-
     // clear the queue
-    if (m_fpqNumItems > 0)
-        clear();
+    clear();
 
     //
     // Note that index 0 is used as a sentinel value for heap
     // management. Therefore, begin copying the queue with index 1.
+    // The source is already a heap, so the copy needs no reordering.
     //
-    for (unsigned int i = 1; i <= queue.getNumItems(); i++) {
-        if (queue.peek(i,item))
-            insert(item);
-    }
+    if ((queue.getNumItems() == 0) || (! reserve(queue.getNumItems())))
+        return;
+    append(&queue.m_fpqQueue[1],queue.getNumItems());
 }
 
 
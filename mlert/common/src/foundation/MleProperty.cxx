@@ -0,0 +1,141 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleProperty.cxx
+ * @ingroup MleFoundation
+ *
+ * Bulk access to properties through their table descriptors.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <string.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlAssert.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleProperty.h"
+
+
+const MlePropertyEntry *
+mlFindProperty(const MlePropertyEntry *entries, int numEntries, const char *name)
+{
+    unsigned int hash = mlPropertyHash(name);
+
+    for (int i = 0; i < numEntries; i++)
+    {
+        if ((entries[i].nameHash == hash) && (strcmp(entries[i].name, name) == 0))
+            return &entries[i];
+    }
+
+    return NULL;
+}
+
+
+int
+mlCopyProperties(MleObject *dst, const MleObject *src,
+    const MlePropertyEntry *entries, int numEntries)
+{
+    int numCopied = 0;
+
+    for (int i = 0; i < numEntries; i++)
+    {
+        const MlePropertyEntry *entry = &entries[i];
+        if (! (entry->flags & MLE_PROPERTY_TRIVIAL))
+            continue;
+
+        memcpy((char *)dst + entry->offset, (const char *)src + entry->offset,
+            entry->size);
+        numCopied++;
+    }
+
+    return numCopied;
+}
+
+
+void
+mlSnapshotProperty(const MlePropertyEntry *entry,
+    MleObject *const *objects, int numObjects, void *buffer)
+{
+    MLE_ASSERT(entry->flags & MLE_PROPERTY_TRIVIAL);
+
+    size_t offset = entry->offset;
+    size_t size = entry->size;
+    char *dst = (char *)buffer;
+
+    for (int i = 0; i < numObjects; i++, dst += size)
+        memcpy(dst, (const char *)objects[i] + offset, size);
+}
+
+
+void
+mlRestoreProperty(const MlePropertyEntry *entry,
+    MleObject *const *objects, int numObjects, const void *buffer)
+{
+    MLE_ASSERT(entry->flags & MLE_PROPERTY_TRIVIAL);
+
+    size_t offset = entry->offset;
+    size_t size = entry->size;
+    const char *src = (const char *)buffer;
+
+    for (int i = 0; i < numObjects; i++, src += size)
+        memcpy((char *)objects[i] + offset, src, size);
+}
+
+
+int
+mlDiffProperty(const MlePropertyEntry *entry,
+    MleObject *const *objects, int numObjects, const void *buffer, int *changed)
+{
+    MLE_ASSERT(entry->flags & MLE_PROPERTY_TRIVIAL);
+
+    size_t offset = entry->offset;
+    size_t size = entry->size;
+    const char *src = (const char *)buffer;
+    int numChanged = 0;
+
+    for (int i = 0; i < numObjects; i++, src += size)
+    {
+        if (memcmp((const char *)objects[i] + offset, src, size) != 0)
+        {
+            if (changed)
+                changed[numChanged] = i;
+            numChanged++;
+        }
+    }
+
+    return numChanged;
+}
@@ -51,103 +51,6 @@
 // Include Runtime Engine header files.
 #include "mle/MlePtrDict.h"
 
-/*
- * This is the constructor for a pool.  The argument is the initial
- * pool size, which is also the blocksize for pool extensions.
- */
-MlePtrDictPool::MlePtrDictPool(int p)
-{
-	/* Initialize variables. */
-	m_poolsize = p;
-	m_link = NULL;
-
-	/* Allocate the initial entries. */
-	makePool();
-}
-
-MlePtrDictPool::~MlePtrDictPool()
-{
-	/* Delete all the pools. */
-	/*   Each pool block is actually one larger than the poolsize, */
-	/*   and the first entry is used to link the blocks together. */
-	/*   This code follows those links to delete the blocks when */
-	/*   the object is destroyed. */
-	while ( m_link )
-	{
-		MlePtrDictEntry *next = m_link->m_next;
-		delete m_link;
-		m_link = next;
-	}
-}
-
-void
-MlePtrDictPool::makePool(void)
-{
-	/* Allocate an array of list items. */
-	/*   A pool block is actually one larger than the pool size. */
-	/*   The extra entry is used to link blocks together */
-	m_unused = new MlePtrDictEntry[m_poolsize + 1];
-
-	/* Link to the old pool. */
-	m_unused[0].m_next = m_link;
-	m_link = m_unused;
-
-	/* Initialize the free list. */
-	m_unused = &m_link[1];
-	for ( int i = 0; i < m_poolsize - 1; i++ )
-		m_unused[i].m_next = &m_unused[i + 1];
-	m_unused[m_poolsize - 1].m_next = NULL;
-}
-
-/*
- * This function is used by a dictionary to get a new entry (instead
- * of newing one off the heap).  It simply pulls the first element
- * off the free list.
- */
-MlePtrDictEntry *
-MlePtrDictPool::get(void)
-{
-	MlePtrDictEntry *rval;	// Temporary for return value.
-
-	/* Make a new pool if the current one is used up. */
-	if ( m_unused == NULL )
-	{
-		printf("warning: expanding MlePtrDictPool.\n");
-		makePool();
-	}
-
-	/* Pull an entry off the free list. */
-	rval = m_unused;
-	m_unused = m_unused->m_next;
-	return rval;
-}
-
-/*
- * This function is used by a dictionary to dispose of an entry
- * (instead of deleting it from the heap).  It puts the entry
- * back onto the free list.
- */
-void
-MlePtrDictPool::put(MlePtrDictEntry *entry)
-{
-	/* put the entry on the free list. */
-	entry->m_next = m_unused;
-	m_unused = entry;
-}
-
-void *
-MlePtrDictPool::operator new(size_t tSize)
-{
-	void *p = mlMalloc(tSize);
-	return p;
-}
-
-void
-MlePtrDictPool::operator delete(void *p)
-{
-	mlFree(p);
-}
-
 /*
  * This dictionary constructor makes a new pool.
  */
@@ -178,21 +81,15 @@ MlePtrDict::MlePtrDict(int hashsize,MlePtrDictPool *p)
 
 MlePtrDict::~MlePtrDict()
 {
-	/* Loop over all the hash table lists. */
+	/* Return all the entries to the pool. */
 	for ( int i = 0; i < m_nbuckets; i++ )
 	{
-		/* Prepend all the hash table lists to the pool free list. */
-		/*   Use intimate knowledge of the hash table instead of */
-		/*   doing this one at a time. */
-		if ( m_bucket[i] )
+		MlePtrDictEntry *entry = m_bucket[i];
+		while ( entry )
 		{
-			/* Go to the last entry. */
-			MlePtrDictEntry *entry = m_bucket[i];
-			while ( entry->m_next )
-				entry = entry->m_next;
-			
-			entry->m_next = m_pool->m_unused;
-			m_pool->m_unused = m_bucket[i];
+			MlePtrDictEntry *next = entry->m_next;
+			m_pool->put(entry);
+			entry = next;
 		}
 	}
 }
@@ -45,6 +45,7 @@
 
 // Include Runtime Engine header files.
 #include "mle/MleRole.h"
+#include "mle/MleArena.h"
 
 
 // Declare creation function used by runtime engine.
@@ -91,7 +92,23 @@ MleRole::operator new(size_t tSize)
 void
 MleRole::operator delete(void *p)
 {
-    mlFree(p);
+    // The roles of cloned actors live in an arena.
+    if (! MleArena::free(p))
+        mlFree(p);
+}
+
+
+size_t
+MleRole::getCloneSize(void) const
+{
+    return sizeof(MleRole);
+}
+
+
+MleRole *
+MleRole::clone(MleActor *actor, void *storage) const
+{
+    return new (storage) MleRole(actor);
 }
 
 
@@ -121,10 +138,25 @@ MleRole::getTypeName(void) const
     return "MleRole";
 }
 
+MleTypeId
+MleRole::classTypeId(void)
+{
+    static MleTypeId type = MleTypeSymbol::intern("MleRole",MLE_TYPE_NONE);
+    return type;
+}
+
+MleTypeId
+MleRole::getTypeId(void) const
+{
+    return classTypeId();
+}
+
+// String form of isa(), kept for compatibility.
 int
 MleRole::isa(const char *type) const
 {
-    return !strcmp(type,"MleRole");
+    MleTypeId self = getTypeId();
+    return MleTypeSymbol::isa(self,MleTypeSymbol::find(type,self));
 }
 
 #if defined(_WINDOWS)
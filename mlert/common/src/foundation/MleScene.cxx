@@ -144,15 +144,31 @@ MleScene::getTypeName(void) const
     return "MleScene";
 }
 
+MleTypeId
+MleScene::classTypeId(void)
+{
+    static MleTypeId type = MleTypeSymbol::intern("MleScene",MLE_TYPE_NONE);
+    return type;
+}
+
+MleTypeId
+MleScene::getTypeId(void) const
+{
+    return classTypeId();
+}
+
+// String form of isa(), kept for compatibility.
 int
 MleScene::isa(const char *type) const
 {
-    return !strcmp(type,"MleScene");
+    MleTypeId self = getTypeId();
+    return MleTypeSymbol::isa(self,MleTypeSymbol::find(type,self));
 }
 
 void
 MleScene::initClass(void)
 {
+    classTypeId();
     new MleSceneClass("MleScene",_mlCreateMleScene,"");
 }
 
@@ -183,18 +199,10 @@ MleScene::registerInstance(const char* name)
 void
 MleScene::unregisterInstance()
 {
-    // Eliminate from instance registry.
-    // XXX - must iterate through dict.  We could have registered this twice,
-    // or we could put a removeValue in the dict class
-
-    for (MleDwpDictIter iter(g_instanceRegistry); iter.getValue(); iter.next())
-    {
-        if ((MleScene*) iter.getValue() == this)
-        {
-            g_instanceRegistry.remove(iter.getKey());
-            break;
-        }
-    }
+    // Eliminate from instance registry, unless another scene has
+    // since been registered under our name.
+    if ( m_name && (MleScene *) g_instanceRegistry.find(m_name) == this )
+        g_instanceRegistry.remove(m_name);
 }
 
 // This function returns the scene class of an scene.
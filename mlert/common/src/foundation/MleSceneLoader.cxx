@@ -0,0 +1,350 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleSceneLoader.cxx
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+#include "mle/mlAssert.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleSceneLoader.h"
+#include "mle/MleScene.h"
+#include "mle/MleGroup.h"
+#include "mle/MleActor.h"
+#include "mle/MleActorGC.h"
+#include "mle/MleSet.h"
+#include "mle/MleLoad.h"
+#include "mle/MleTables.h"
+#include "mle/MleDirector.h"
+#include "mle/MleScheduler.h"
+
+
+// Defined in MleLoad.cxx.
+extern MleGroup *_mlParseGroup(const int indexToPpTOC, MleLoadContext *context);
+
+
+MleSceneLoader::MleSceneLoader(const int indexToPpTOC)
+  : m_indexToPpTOC(indexToPpTOC),
+    m_stage(FETCH),
+    m_scene(NULL),
+    m_numGroups(0),
+    m_groupIndices(NULL),
+    m_groups(NULL),
+    m_contexts(NULL),
+    m_numParsed(0),
+    m_numCommitted(0),
+    m_numInitialized(-1),
+    m_committing(FALSE),
+    m_item(NULL),
+    m_budget(1)
+{
+    // Nothing else to do.
+}
+
+
+MleSceneLoader::~MleSceneLoader(void)
+{
+    // Once the scene is current the load can only be completed.
+    if (m_committing)
+        finish();
+    else if (! isFinished())
+        discard(CANCELLED);
+
+    if (m_item != NULL)
+        g_theTitle->m_theScheduler->remove(m_item);
+
+    if (m_groupIndices != NULL)
+        mlFree(m_groupIndices);
+    if (m_groups != NULL)
+        mlFree(m_groups);
+    if (m_contexts != NULL)
+        mlFree(m_contexts);
+}
+
+
+MlBoolean
+MleSceneLoader::step(int budget)
+{
+    while ((budget-- > 0) && ! isFinished())
+    {
+        switch (m_stage)
+        {
+          case FETCH:
+            fetch();
+            break;
+          case CONSTRUCT:
+            construct();
+            break;
+          case COMMIT:
+            commit();
+            break;
+          default:
+            break;
+        }
+    }
+
+    if (isFinished() && (m_item != NULL))
+    {
+        g_theTitle->m_theScheduler->remove(m_item);
+        m_item = NULL;
+    }
+
+    return isFinished();
+}
+
+
+void
+MleSceneLoader::finish(void)
+{
+    while (! step())
+        ;
+}
+
+
+MlBoolean
+MleSceneLoader::cancel(void)
+{
+    if (isFinished() || m_committing)
+        return FALSE;
+
+    discard(CANCELLED);
+    if (m_item != NULL)
+    {
+        g_theTitle->m_theScheduler->remove(m_item);
+        m_item = NULL;
+    }
+    return TRUE;
+}
+
+
+void
+MleSceneLoader::schedule(MleSchedulerPhase *phase, int budget)
+{
+    MLE_ASSERT(budget > 0);
+    m_budget = budget;
+
+    if ((m_item == NULL) && ! isFinished())
+        m_item = g_theTitle->m_theScheduler->insertFunc(phase,
+            MleSceneLoader::update, this, this);
+}
+
+
+void
+MleSceneLoader::update(void *loader)
+{
+    MleSceneLoader *self = (MleSceneLoader *) loader;
+    self->step(self->m_budget);
+}
+
+
+float
+MleSceneLoader::getProgress(void) const
+{
+    if (m_stage == DONE)
+        return 1.0f;
+    if ((m_stage == FETCH) || (m_stage == CANCELLED) || (m_stage == FAILED))
+        return 0.0f;
+
+    // Reading the scene chunk counts as one unit, and parsing and
+    // committing each group as one more each.
+    float done = 1.0f + m_numParsed + m_numCommitted;
+    if ((m_numCommitted < m_numGroups) && (m_numInitialized > 0))
+    {
+        int numActors = m_contexts[m_numCommitted].m_numActors;
+        done += (float) m_numInitialized / (float) (numActors + 1);
+    }
+    return done / (float) (1 + 2 * m_numGroups);
+}
+
+
+void
+MleSceneLoader::fetch(void)
+{
+    unsigned int length;
+    unsigned char *sceneChunk = mlGetPlayprintChunk(m_indexToPpTOC, &length);
+    if (sceneChunk == NULL)
+    {
+        m_stage = FAILED;
+        return;
+    }
+    unsigned char *chunkPtr = sceneChunk;
+    unsigned char *&chunkRef = chunkPtr;
+
+    int sceneIndex = readInt(chunkRef, sceneChunk, sceneChunk + length);
+    m_scene = (*mlRTSceneClass[sceneIndex].constructor)();
+    if (m_scene == NULL)
+    {
+        mlReleasePlayprintChunk(sceneChunk);
+        m_stage = FAILED;
+        return;
+    }
+
+    // The chunk holds [ numGroups, [ g0index, g1index, ... ] ], as read
+    // by mlLoadScene().
+    m_numGroups = readInt(chunkRef, sceneChunk, sceneChunk + length);
+    MLE_ASSERT(m_numGroups >= 0);
+    if (m_numGroups > 0)
+    {
+        m_groupIndices = (int *) mlMalloc(m_numGroups * sizeof(int));
+        m_groups = (MleGroup **) mlMalloc(m_numGroups * sizeof(MleGroup *));
+        m_contexts = (MleLoadContext *) mlMalloc(m_numGroups * sizeof(MleLoadContext));
+    }
+
+    for (int i = 0; i < m_numGroups; i++)
+    {
+        m_groupIndices[i] = readInt(chunkRef, sceneChunk, sceneChunk + length);
+
+        // Start paging in every group now; they are parsed one per step.
+        mlPrefetchPlayprintChunk(m_groupIndices[i]);
+    }
+
+    mlReleasePlayprintChunk(sceneChunk);
+    m_stage = (m_numGroups > 0) ? CONSTRUCT : COMMIT;
+}
+
+
+void
+MleSceneLoader::construct(void)
+{
+    MleGroup *group = _mlParseGroup(m_groupIndices[m_numParsed], &m_contexts[m_numParsed]);
+    if (group == NULL)
+    {
+        discard(FAILED);
+        return;
+    }
+
+    m_groups[m_numParsed++] = group;
+    if (m_numParsed == m_numGroups)
+        m_stage = COMMIT;
+}
+
+
+void
+MleSceneLoader::commit(void)
+{
+    if (! m_committing)
+    {
+        // As in mlLoadScene(), the scene becomes current before any
+        // group is initialized.  This deletes the previous scene.
+        m_scene->changeCurrentScene(m_scene);
+        m_committing = TRUE;
+        return;
+    }
+
+    if (m_numCommitted == m_numGroups)
+    {
+        m_scene->init();
+        m_stage = DONE;
+        return;
+    }
+
+    MleLoadContext *loaded = &m_contexts[m_numCommitted];
+    MleGroup *group = m_groups[m_numCommitted];
+
+    if (m_numInitialized < 0)
+    {
+        // Attach the group's roles together, before any of its actors
+        // is initialized, as mlLoadGroup() does.
+        for (int i = 0; i < loaded->m_numActors; i++)
+            attachGroupRole(loaded, i);
+        m_numInitialized = 0;
+    }
+    else if (m_numInitialized < loaded->m_numActors)
+    {
+        MleActor *actor = loaded->m_registry[m_numInitialized].m_actor;
+
+        MleSet::g_currentSet = loaded->m_sets[m_numInitialized];
+        group->add(actor);
+        actor->init();
+        MleSet::g_currentSet = NULL;
+
+        m_numInitialized++;
+    }
+    else
+    {
+        group->init();
+        m_scene->add(group);
+
+        releaseLoadContext(loaded);
+        m_groups[m_numCommitted++] = NULL;
+        m_numInitialized = -1;
+    }
+}
+
+
+void
+MleSceneLoader::discard(Stage stage)
+{
+    MLE_ASSERT(! m_committing);
+
+    // The actors have not been added to their groups yet, so they are
+    // deleted separately; each takes its role with it.
+    for (int i = 0; i < m_numParsed; i++)
+    {
+        MleLoadContext *loaded = &m_contexts[i];
+        for (int j = 0; j < loaded->m_numActors; j++)
+            delete loaded->m_registry[j].m_actor;
+        releaseLoadContext(loaded);
+
+        delete m_groups[i];
+        m_groups[i] = NULL;
+    }
+    m_numParsed = 0;
+
+    if (m_scene != NULL)
+        delete m_scene;
+    m_scene = NULL;
+
+    m_stage = stage;
+}
+
+
+void *
+MleSceneLoader::operator new(size_t tSize)
+{
+    void *p = mlMalloc(tSize);
+    return p;
+}
+
+
+void
+MleSceneLoader::operator delete(void *p)
+{
+    mlFree(p);
+}
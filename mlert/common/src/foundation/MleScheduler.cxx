@@ -98,6 +98,7 @@ struct MleSchedulerPhase {
 // MleScheduler data member definition
 
 MleScheduler::MleScheduler(unsigned int phases, unsigned int items)
+  : m_itemPool(items)
 {
     unsigned int index;
 
@@ -113,11 +114,6 @@ MleScheduler::MleScheduler(unsigned int phases, unsigned int items)
         m_phaseArray[index] = NULL;
     }
     
-    // set initSize to specified size.
-    m_initSize = items;
-    m_memLink = NULL;
-    makeItemMemory();
-    
     // NULL iterator indicates not within a call to go()
     m_iterator = NULL;
     m_deleteItem = NULL;
@@ -139,13 +135,6 @@ MleScheduler::~MleScheduler()
     }
 
     delete[] m_phaseArray;
-
-    while (m_memLink)
-    {
-      MleSchedulerItem *next = m_memLink->m_next;
-      delete m_memLink;
-      m_memLink = next;
-    }
 }
 
 // 
@@ -277,24 +266,6 @@ MleScheduler::removePhase(MleSchedulerPhase* phase)
     m_inUsePhases--;
 }
 
-void
-MleScheduler::makeItemMemory(void)
-{
-  m_freeItem = new MleSchedulerItem [m_initSize+1];
-  
-  // link to the old memory block
-  m_freeItem[0].m_next = m_memLink;
-  m_memLink = m_freeItem;
-
-  // freeItem starts from the 1st item in the block
-  m_freeItem = &m_memLink[1];
-  for (int index=0; index<m_initSize-1; index++)
-    {
-      m_freeItem[index].m_next = &(m_freeItem[index+1]);
-    }
-  m_freeItem[m_initSize-1].m_next = NULL;
-}
-
 // Execute functions for a single phase
 void
 MleScheduler::go(MleSchedulerPhase *phase)
@@ -353,8 +324,7 @@ MleScheduler::go(MleSchedulerPhase *phase)
             {
                 m_deleteItem->m_next->m_prev = m_deleteItem->m_prev;
             }
-            m_deleteItem->m_next = m_freeItem;
-            m_freeItem = m_deleteItem;
+            m_itemPool.put(m_deleteItem);
 
            m_deleteItem = NULL;
         }
@@ -391,16 +361,8 @@ MleSchedulerItem* MleScheduler::insertFunc(MleSchedulerPhase *phase,
     MLE_ASSERT(NULL != phase);
     
     
-    // if run out of allocated memory for items
-    if (m_freeItem == NULL)
-    {
-        makeItemMemory();
-    }
-
     // Get a new MleSchedulerItem
-    MLE_ASSERT(m_freeItem != NULL); 
-    MleSchedulerItem* ctrlBlk = m_freeItem;
-    m_freeItem = m_freeItem->m_next;
+    MleSchedulerItem* ctrlBlk = m_itemPool.get();
     
     
     // Setup control block for this insert
@@ -453,13 +415,12 @@ void MleScheduler::remove(MleSchedulerItem* ctrlBlk)
     {
         ctrlBlk->m_next->m_prev = ctrlBlk->m_prev;
     }
-    ctrlBlk->m_next = m_freeItem;
-    m_freeItem = ctrlBlk;
 #if defined(MLE_DEBUG)
     if ( ctrlBlk->m_name != NULL ) {
         mlFree(ctrlBlk->m_name);
     }
 #endif
+    m_itemPool.put(ctrlBlk);
     }
     else
     {
@@ -469,6 +430,12 @@ void MleScheduler::remove(MleSchedulerItem* ctrlBlk)
 }
 
 
+// Report the usage of the item pool.
+void MleScheduler::getItemPoolStats(MleFixedPoolStats &stats) const
+{
+    m_itemPool.getStats(stats);
+}
+
 // Remove all items matching tag.  For the momment do no optimization for 
 // finding tagged items.
 void MleScheduler::remove(void* tag)
@@ -44,9 +44,11 @@
 
 // Include Magic Lantern header files.
 #include "mle/mlMalloc.h"
+#include "mle/mlAssert.h"
 
 // Include Runtime Engine header files.
 #include "mle/MleSet.h"
+#include "mle/MleActor.h"
 
 
 // This static is valid during actor set loads.  Actors and roles
@@ -75,6 +77,10 @@ void MleSet::setProperty(MleObject * /*object*/, const char * /*name*/, unsigned
 MleSet::MleSet(void)
   : MleObject()
 {
+    m_dirtyActors = NULL;
+    m_lastDirtyActor = NULL;
+    m_numDirtyActors = 0;
+
 #ifdef MLE_DIGITAL_WORKPRINT
     m_name = NULL;
     m_setClass = NULL;
@@ -84,6 +90,16 @@ MleSet::MleSet(void)
 
 MleSet::~MleSet(void)
 {
+    // Detach the dirty actors; they keep their dirty masks.
+    MleActor *actor = m_dirtyActors;
+    while (actor)
+    {
+        MleActor *next = actor->m_dirtyNext;
+        actor->m_dirtySet = NULL;
+        actor->m_dirtyPrev = actor->m_dirtyNext = NULL;
+        actor = next;
+    }
+
 #ifdef MLE_DIGITAL_WORKPRINT
     unregisterInstance();
     if (m_name)
@@ -121,6 +137,52 @@ MleSet::attach(MleRole * /* parent */, MleRole * /* child */)
 }
 
 
+void
+MleSet::addDirtyActor(MleActor *actor)
+{
+    MLE_ASSERT(actor && ! actor->m_dirtySet);
+
+    actor->m_dirtySet = this;
+    actor->m_dirtyPrev = m_lastDirtyActor;
+    actor->m_dirtyNext = NULL;
+    if (m_lastDirtyActor)
+        m_lastDirtyActor->m_dirtyNext = actor;
+    else
+        m_dirtyActors = actor;
+    m_lastDirtyActor = actor;
+    m_numDirtyActors++;
+}
+
+
+void
+MleSet::removeDirtyActor(MleActor *actor)
+{
+    MLE_ASSERT(actor && (actor->m_dirtySet == this));
+
+    if (actor->m_dirtyPrev)
+        actor->m_dirtyPrev->m_dirtyNext = actor->m_dirtyNext;
+    else
+        m_dirtyActors = actor->m_dirtyNext;
+    if (actor->m_dirtyNext)
+        actor->m_dirtyNext->m_dirtyPrev = actor->m_dirtyPrev;
+    else
+        m_lastDirtyActor = actor->m_dirtyPrev;
+
+    actor->m_dirtySet = NULL;
+    actor->m_dirtyPrev = actor->m_dirtyNext = NULL;
+    m_numDirtyActors--;
+}
+
+
+void
+MleSet::clearDirtyActors(void)
+{
+    // Clearing an actor's mask unlinks it, so keep taking the head.
+    while (m_dirtyActors)
+        m_dirtyActors->clearDirty();
+}
+
+
 MleSet *_mlCreateMleSet(void)
 {
     return new MleSet;
@@ -130,10 +192,25 @@ MleSet *_mlCreateMleSet(void)
 #include <stdio.h>
 #include <string.h>
 
+MleTypeId
+MleSet::classTypeId(void)
+{
+    static MleTypeId type = MleTypeSymbol::intern("MleSet",MLE_TYPE_NONE);
+    return type;
+}
+
+MleTypeId
+MleSet::getTypeId(void) const
+{
+    return classTypeId();
+}
+
+// String form of isa(), kept for compatibility.
 int
 MleSet::isa(const char *type) const
 {
-    return !strcmp(type,"MleSet");
+    MleTypeId self = getTypeId();
+    return MleTypeSymbol::isa(self,MleTypeSymbol::find(type,self));
 }
 
 #ifdef MLE_DIGITAL_WORKPRINT
@@ -161,6 +238,7 @@ MleSet::getTypeName(void) const
 void
 MleSet::initClass(void)
 {
+    classTypeId();
     new MleSetClass("MleSet", _mlCreateMleSet, "");
 }
 
@@ -260,16 +338,9 @@ MleSet::registerInstance(const char* n)
 void
 MleSet::unregisterInstance(void)
 {
-    // Eliminate from instance registry.
-    // XXX - must iterate through dict.  We could have registered this twice,
-    // or we could put a removeValue in the dict class
-
-    for (MleDwpDictIter iter(g_instanceRegistry); iter.getValue(); iter.next()) {
-        if ((MleSet*) iter.getValue() == this) {
-            g_instanceRegistry.remove(iter.getKey());
-            break;
-        }
-    }
+    // Eliminate from instance registry by name (see MleActor).
+    if ( m_name && (MleSet *) g_instanceRegistry.find(m_name) == this )
+        g_instanceRegistry.remove(m_name);
 }
 
 #endif /* MLE_DIGITAL_WORKPRINT */
@@ -0,0 +1,236 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleSlotMap.cxx
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+#include "mle/mlAssert.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleSlotMap.h"
+
+
+// A slot holds the dense position of its item, or -1 if it is free.
+// Free slots are chained oldest first through m_nextFree.
+struct MleSlotMapSlot
+{
+    unsigned int m_generation;  // 1 to MLE_SLOTMAP_MAX_GENERATION
+    int m_index;                // dense position, or -1
+    int m_nextFree;             // next free slot, or -1
+};
+
+
+MleSlotMap::MleSlotMap(int initSize)
+{
+    if (initSize < 1)
+        initSize = 1;
+
+    m_n = 0;
+    m_allocSize = initSize;
+    m_array = (void **)mlMalloc(m_allocSize*sizeof(void *));
+    m_slotOf = (unsigned int *)mlMalloc(m_allocSize*sizeof(unsigned int));
+
+    m_numSlots = 0;
+    m_maxSlots = initSize;
+    m_slots = (MleSlotMapSlot *)mlMalloc(m_maxSlots*sizeof(MleSlotMapSlot));
+    m_freeHead = -1;
+    m_freeTail = -1;
+}
+
+
+MleSlotMap::~MleSlotMap()
+{
+    mlFree(m_array);
+    mlFree(m_slotOf);
+    mlFree(m_slots);
+}
+
+
+// This function returns a slot for a new item.  Slots freed earliest
+// are reused first, to keep generations turning over slowly.
+unsigned int
+MleSlotMap::allocSlot(void)
+{
+    // Reuse a free slot.
+    if (m_freeHead >= 0)
+    {
+        unsigned int slot = (unsigned int)m_freeHead;
+        m_freeHead = m_slots[slot].m_nextFree;
+        if (m_freeHead < 0)
+            m_freeTail = -1;
+        return slot;
+    }
+
+    // Append a new slot.
+    if (m_numSlots == m_maxSlots)
+    {
+        MLE_ASSERT(m_maxSlots <= MLE_SLOTMAP_INDEX_MASK);
+        m_maxSlots *= 2;
+        if (m_maxSlots > MLE_SLOTMAP_INDEX_MASK + 1)
+            m_maxSlots = MLE_SLOTMAP_INDEX_MASK + 1;
+        m_slots = (MleSlotMapSlot *)mlRealloc(m_slots,m_maxSlots*sizeof(MleSlotMapSlot));
+    }
+    m_slots[m_numSlots].m_generation = 1;
+    return m_numSlots++;
+}
+
+
+// This function adds an item at the end of the dense array.
+MleSlotHandle
+MleSlotMap::add(void *ptr)
+{
+    if (m_n == m_allocSize)
+    {
+        m_allocSize *= 2;
+        m_array = (void **)mlRealloc(m_array,m_allocSize*sizeof(void *));
+        m_slotOf = (unsigned int *)mlRealloc(m_slotOf,m_allocSize*sizeof(unsigned int));
+    }
+
+    unsigned int slot = allocSlot();
+    m_slots[slot].m_index = m_n;
+    m_array[m_n] = ptr;
+    m_slotOf[m_n] = slot;
+    m_n++;
+
+    return (m_slots[slot].m_generation << MLE_SLOTMAP_INDEX_BITS) | slot;
+}
+
+
+// This function removes an item, filling its dense position with
+// the last item.
+MlBoolean
+MleSlotMap::remove(MleSlotHandle handle)
+{
+    int index = getIndex(handle);
+    if (index < 0)
+        return FALSE;
+
+    // Move the last item into the hole.
+    int last = m_n - 1;
+    if (index != last)
+    {
+        m_array[index] = m_array[last];
+        m_slotOf[index] = m_slotOf[last];
+        m_slots[m_slotOf[index]].m_index = index;
+    }
+    m_n--;
+
+    // Retire the slot.
+    unsigned int slot = handle & MLE_SLOTMAP_INDEX_MASK;
+    MleSlotMapSlot *s = &m_slots[slot];
+    s->m_index = -1;
+    if (++s->m_generation > MLE_SLOTMAP_MAX_GENERATION)
+        s->m_generation = 1;
+    s->m_nextFree = -1;
+    if (m_freeTail >= 0)
+        m_slots[m_freeTail].m_nextFree = (int)slot;
+    else
+        m_freeHead = (int)slot;
+    m_freeTail = (int)slot;
+
+    return TRUE;
+}
+
+
+// This function removes all items.
+void
+MleSlotMap::removeAll(void)
+{
+    while (m_n > 0)
+        remove(getHandle(m_n - 1));
+}
+
+
+// This function returns the item for a handle, or NULL if it is stale.
+void *
+MleSlotMap::get(MleSlotHandle handle) const
+{
+    int index = getIndex(handle);
+
+    return (index < 0) ? NULL : m_array[index];
+}
+
+
+MlBoolean
+MleSlotMap::isValid(MleSlotHandle handle) const
+{
+    return (getIndex(handle) >= 0) ? TRUE : FALSE;
+}
+
+
+MleSlotHandle
+MleSlotMap::getHandle(int index) const
+{
+    MLE_ASSERT(index >= 0 && index < m_n);
+
+    unsigned int slot = m_slotOf[index];
+    return (m_slots[slot].m_generation << MLE_SLOTMAP_INDEX_BITS) | slot;
+}
+
+
+// This function returns the dense position for a handle, or -1 if
+// the handle is stale.
+int
+MleSlotMap::getIndex(MleSlotHandle handle) const
+{
+    unsigned int slot = handle & MLE_SLOTMAP_INDEX_MASK;
+    if (slot >= m_numSlots)
+        return -1;
+
+    const MleSlotMapSlot *s = &m_slots[slot];
+    if (s->m_index < 0 || s->m_generation != (handle >> MLE_SLOTMAP_INDEX_BITS))
+        return -1;
+
+    return s->m_index;
+}
+
+
+void *
+MleSlotMap::operator new(size_t tSize)
+{
+    void *p = mlMalloc(tSize);
+    return p;
+}
+
+
+void
+MleSlotMap::operator delete(void *p)
+{
+    mlFree(p);
+}
@@ -152,17 +152,32 @@ MleStage::getTypeName(void) const
     return "MleStage";
 }
 
-// This function is the terminal case for determining if an object
-// instance is an instance of a specified type.
+// The stage class is the root of the stage type symbols.
+MleTypeId
+MleStage::classTypeId(void)
+{
+    static MleTypeId type = MleTypeSymbol::intern("MleStage",MLE_TYPE_NONE);
+    return type;
+}
+
+MleTypeId
+MleStage::getTypeId(void) const
+{
+    return classTypeId();
+}
+
+// String form of isa(), kept for compatibility.
 int
 MleStage::isa(const char *type) const
 {
-    return !strcmp(type,"MleStage");
+    MleTypeId self = getTypeId();
+    return MleTypeSymbol::isa(self,MleTypeSymbol::find(type,self));
 }
 
 void
 MleStage::initClass(void)
 {
+    classTypeId();
     new MleStageClass("MleStage", _mlCreateMleStage, "");
 }
 
@@ -0,0 +1,228 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleTypeSymbol.cxx
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <limits.h>
+#include <string.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+#include "mle/mlAssert.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleTypeSymbol.h"
+#include "mle/MleFlatPtrDict.h"
+
+/* The initial number of symbols to make room for. */
+#define MLE_TYPESYMBOL_INIT_SIZE 64
+
+/*
+ * This dictionary maps interned names to symbols.  Keys are the
+ * names owned by the symbol array, compared by content.
+ */
+class MleTypeSymbolDict : public MleFlatPtrDict
+{
+  public:
+
+	MleTypeSymbolDict(void) : MleFlatPtrDict(MLE_TYPESYMBOL_INIT_SIZE) {}
+
+  protected:
+
+	virtual unsigned int hash(const void *key) const
+	{
+		/* FNV-1a. */
+		unsigned int h = 2166136261u;
+		for ( const unsigned char *s = (const unsigned char *)key; *s; s++ )
+			h = (h ^ *s) * 16777619u;
+		return h;
+	}
+
+	virtual int match(const void *key0,const void *key1) const
+	{
+		return !strcmp((const char *)key0,(const char *)key1);
+	}
+};
+
+/*
+ * The sentinel for MLE_TYPE_NONE.  Its range is empty and lies outside
+ * every other range, so MleTypeSymbol::isa() needs no special case.
+ */
+static MleTypeSymbolEntry g_noSymbol[1] =
+{
+	{ NULL, MLE_TYPE_NONE, MLE_TYPE_NONE, MLE_TYPE_NONE, MLE_TYPE_NONE,
+	  INT_MAX, INT_MIN, NULL }
+};
+
+/* The names of the root classes; each root holds its hierarchy's. */
+static MleTypeSymbolDict *g_rootNames = NULL;
+
+MleTypeSymbolEntry *MleTypeSymbol::g_symbols = g_noSymbol;
+int MleTypeSymbol::g_numSymbols = 1;
+int MleTypeSymbol::g_maxSymbols = 1;
+
+MleTypeId
+MleTypeSymbol::intern(const char *name, MleTypeId parent)
+{
+	MLE_ASSERT((parent >= 0) && (parent < g_numSymbols));
+
+	MleTypeId type = find(name,parent);
+	if ( type != MLE_TYPE_NONE )
+		return type;
+
+	if ( g_rootNames == NULL )
+		g_rootNames = new MleTypeSymbolDict;
+
+	/* Grow the symbol array, moving off the static sentinel. */
+	if ( g_numSymbols == g_maxSymbols )
+	{
+		int size = (g_maxSymbols < MLE_TYPESYMBOL_INIT_SIZE) ?
+			MLE_TYPESYMBOL_INIT_SIZE : g_maxSymbols*2;
+		MleTypeSymbolEntry *symbols =
+			(MleTypeSymbolEntry *)mlMalloc(size*sizeof(MleTypeSymbolEntry));
+		memcpy(symbols,g_symbols,g_numSymbols*sizeof(MleTypeSymbolEntry));
+		if ( g_symbols != g_noSymbol )
+			mlFree(g_symbols);
+		g_symbols = symbols;
+		g_maxSymbols = size;
+	}
+
+	type = g_numSymbols++;
+	MleTypeSymbolEntry *entry = &g_symbols[type];
+	entry->m_name = (char *)mlMalloc(strlen(name) + 1);
+	strcpy(entry->m_name,name);
+	entry->m_parent = parent;
+	entry->m_child = MLE_TYPE_NONE;
+	entry->m_sibling = MLE_TYPE_NONE;
+	entry->m_names = NULL;
+	if ( parent != MLE_TYPE_NONE )
+	{
+		entry->m_sibling = g_symbols[parent].m_child;
+		g_symbols[parent].m_child = type;
+		entry->m_root = g_symbols[parent].m_root;
+	}
+	else
+	{
+		/* A new hierarchy, whose table starts with its root. */
+		entry->m_root = type;
+		entry->m_names = new MleTypeSymbolDict;
+		g_rootNames->set(entry->m_name,(void *)(size_t)type);
+	}
+
+	g_symbols[entry->m_root].m_names->set(entry->m_name,(void *)(size_t)type);
+	renumber();
+
+	return type;
+}
+
+MleTypeId
+MleTypeSymbol::find(const char *name, MleTypeId hierarchy)
+{
+	MLE_ASSERT((hierarchy >= 0) && (hierarchy < g_numSymbols));
+
+	MleTypeSymbolDict *names = (hierarchy == MLE_TYPE_NONE) ?
+		g_rootNames : g_symbols[g_symbols[hierarchy].m_root].m_names;
+	if ( (names == NULL) || (name == NULL) )
+		return MLE_TYPE_NONE;
+	return (MleTypeId)(size_t)names->find(name);
+}
+
+const char *
+MleTypeSymbol::getName(MleTypeId type)
+{
+	MLE_ASSERT((type >= 0) && (type < g_numSymbols));
+	return g_symbols[type].m_name;
+}
+
+MleTypeId
+MleTypeSymbol::getParent(MleTypeId type)
+{
+	MLE_ASSERT((type >= 0) && (type < g_numSymbols));
+	return g_symbols[type].m_parent;
+}
+
+int
+MleTypeSymbol::getNumSymbols(void)
+{
+	return g_numSymbols - 1;
+}
+
+/*
+ * Number the class forest in pre-order.
+ *   The walk follows the child, sibling and parent links, so it
+ *   needs no stack.  A symbol's m_exit is set on the way back up,
+ *   once every symbol below it has been numbered.
+ */
+void
+MleTypeSymbol::renumber(void)
+{
+	int next = 0;
+
+	for ( MleTypeId root = 1; root < g_numSymbols; root++ )
+	{
+		if ( g_symbols[root].m_parent != MLE_TYPE_NONE )
+			continue;
+
+		MleTypeId type = root;
+		while ( type != MLE_TYPE_NONE )
+		{
+			g_symbols[type].m_enter = next++;
+			if ( g_symbols[type].m_child != MLE_TYPE_NONE )
+			{
+				type = g_symbols[type].m_child;
+				continue;
+			}
+
+			/* Close finished subtrees until one has a sibling left. */
+			while ( type != MLE_TYPE_NONE )
+			{
+				g_symbols[type].m_exit = next - 1;
+				if ( type == root )
+					type = MLE_TYPE_NONE;
+				else if ( g_symbols[type].m_sibling != MLE_TYPE_NONE )
+				{
+					type = g_symbols[type].m_sibling;
+					break;
+				}
+				else
+					type = g_symbols[type].m_parent;
+			}
+		}
+	}
+}
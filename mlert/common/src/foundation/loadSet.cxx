@@ -175,56 +175,34 @@ mlLoadSet(const char *id)
 static void
 _mlCreateSet(int id)
 {
-    int chunkTOCIndex;
-    long curFileOffset, setChunkOffset;
     unsigned char *setChunk, *tmpSetChunk;
     unsigned int setChunkLength;
-    FILE *ppFilePtr;
 
     /*
-     * Make sure there is a playprint file pointer.
+     * Get the Set chunk.  The playprint file position is left alone,
+     * since Sets are created while another chunk is being parsed.
      */
-    MLE_ASSERT(g_theTitle->m_dpp);
-    ppFilePtr = g_theTitle->m_dpp->getFp();
-    MLE_ASSERT(ppFilePtr);
-
-    /*
-     * Save the current position of the playprint.
-     */
-    curFileOffset = mlFTell(ppFilePtr);
-
-    /*
-     * Seek to the beginning of the appropriate Set chunk.
-     * XXX Mark will do the clean up to make use of the tag and size of
-     *     MleDppChunk structure correctly.
-     */
-    chunkTOCIndex = MleRTSetChunk[id];
-    setChunkOffset = g_theTitle->m_dpp->getTOCOffset((unsigned long) chunkTOCIndex);
-    mlFSeek(ppFilePtr, setChunkOffset + sizeof(MlDppTag), SEEK_SET);
-
-    /*
-     * Allocate memory to store the Set chunk, read in the size and content
-     * of the Set chunk.
-     */
-    mlFRead(&setChunkLength, sizeof(unsigned int), 1, ppFilePtr);
-    setChunk = new unsigned char[setChunkLength];
-    mlFRead(setChunk, setChunkLength, 1, ppFilePtr);
+    setChunk = mlGetPlayprintChunk(MleRTSetChunk[id], &setChunkLength);
+    if (setChunk == NULL)
+        return;
 
     /*
      * Interpret the Set chunk, create the Set, initialize its property
      * values if any.
      */
+    MleLoadContext context;
+    context.m_registry = NULL;
+    context.m_size = context.m_numActors = 0;
+    context.m_sets = NULL;
+    context.m_attached = NULL;
+    context.m_currentSet = NULL;
+
     tmpSetChunk = setChunk;
     unsigned char *&setChunkRef = tmpSetChunk;
-    parseStream(setChunkRef, setChunk, setChunk + setChunkLength,
+    parseStream(&context, setChunkRef, setChunk, setChunk + setChunkLength,
         MLE_CHUNK_SET);
 
-    delete [] setChunk;
-
-    /*
-     * Restore the current position of the playprint.
-     */
-    mlFSeek(ppFilePtr, curFileOffset, SEEK_SET);
+    mlReleasePlayprintChunk(setChunk);
 }
 
 
@@ -240,9 +218,15 @@ mlLoadSet(const int id)
         // Find the Set chunk in the playprint, create the Set,
         // and initialize the Set property values.
         _mlCreateSet(id);
+        if (! mlRTSet[id].ptr)
+            return NULL;
 
-        // Run the initialization function.
+        // Run the initialization function.  The set is current while
+        // it initializes, as the chunk parser used to leave it.
+        MleSet *previousSet = MleSet::g_currentSet;
+        MleSet::g_currentSet = mlRTSet[id].ptr;
         (mlRTSet[id].ptr)->init();
+        MleSet::g_currentSet = previousSet;
     }
 
     return mlRTSet[id].ptr;
@@ -56,6 +56,7 @@
 
 // Include Magic Lantern Runtime Engine header files.
 #include "mle/MleRuntime.h"
+#include "mle/MleActorClass.h"
 
 #ifdef MLE_REHEARSAL
 #if 0
@@ -70,6 +71,10 @@ MLE_RUNTIME_API MlePlayer *_mlPlayer = NULL;
 
 static void releaseItem(MleDwpItem *item)
 {
+    // Property plans are keyed by template address, and the templates
+    // may be deleted or replaced once they are released.
+    MleActorClass::invalidatePlans();
+
 #ifdef MLE_REHEARSAL
 #if 0
     if ( _mlPlayer )
@@ -80,7 +85,7 @@ static void releaseItem(MleDwpItem *item)
         // Find the root.
         while ( item->getParent() )
             item = item->getParent();
-        
+
         delete item;
     }
 #endif /* MLE_REHEARSAL */
@@ -97,6 +102,9 @@ MleDwpGroup *_mlGetWorkprintGroup(const char *id)
 #endif /* 0 */
 #endif /* MLE_REHEARSAL */
 
+    // The templates in the workprint may have been edited or replaced.
+    MleActorClass::invalidatePlans();
+
     MLE_ASSERT(mlGetWorkprint());
 #if defined(_WINDOWS)
     MleDwpFinder groupFinder("MleDwpGroup",id,0);
@@ -122,6 +130,9 @@ MleDwpScene *_mlGetWorkprintScene(const char *id)
 #endif /* 0 */
 #endif /* MLE_REHEARSAL */
 
+    // The templates in the workprint may have been edited or replaced.
+    MleActorClass::invalidatePlans();
+
     MLE_ASSERT(mlGetWorkprint());
 #if defined(_WINDOWS)
     MleDwpFinder sceneFinder("MleDwpScene",id,0);
@@ -157,6 +168,9 @@ MleDwpMediaRef *_mlGetWorkprintMediaRef(const char *id)
 #endif /* 0 */
 #endif /* MLE_REHEARSAL */
 
+    // The templates in the workprint may have been edited or replaced.
+    MleActorClass::invalidatePlans();
+
     MLE_ASSERT(mlGetWorkprint());
 #if defined(_WINDOWS)
     MleDwpFinder mediaRefFinder("MleDwpMediaRef",id,0);
@@ -192,6 +206,9 @@ MleDwpSet *_mlGetWorkprintSet(const char *id)
 #endif /* 0 */
 #endif /* MLE_REHEARSAL */
 
+    // The templates in the workprint may have been edited or replaced.
+    MleActorClass::invalidatePlans();
+
     MLE_ASSERT(mlGetWorkprint());
 #if defined(_WINDOWS)
     MleDwpFinder setFinder("MleDwpSet",id,0);
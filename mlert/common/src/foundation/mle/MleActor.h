@@ -46,11 +46,14 @@
 #include <string.h>
 
 // Include Magic Lantern header files.
+#include "mle/mlTypes.h"
 #include "mle/mlAssert.h"
 //#include "math/scalar.h"
 
 #include "mle/MleRuntime.h"
+#include "mle/MleTypeSymbol.h"
 #include "mle/MleObject.h"
+#include "mle/MleProperty.h"
 
 #ifdef MLE_DIGITAL_WORKPRINT
 
@@ -96,12 +99,71 @@ class MlTransform;
 
 #endif /* MLE_DIGITAL_WORKPRINT */
 
+// Actor property dirty mask.
+//
+// Each property is assigned one bit of the mask the first time one of
+// its setters runs.  Bits are assigned per actor class: a property never
+// shares a bit with another property of its class or of the superclasses,
+// while classes that are not related reuse the same bits.
+typedef unsigned int MleDirtyMask;
+
+// Every dirty bit.
+#define MLE_DIRTY_ALL 0xffffffffu
+
+// The number of dirty bits.
+#define MLE_DIRTY_BITS (8*sizeof(MleDirtyMask))
+
+/**
+ * The dirty bits assigned to the properties of one actor class.
+ *
+ * MLE_ACTOR_SOURCE() defines one of these for each actor class,
+ * linked to that of its superclass.
+ */
+class MLE_RUNTIME_API MleDirtyClass
+{
+  public:
+
+    MleDirtyClass(const MleDirtyClass *superclass);
+
+    // The class's superclass, or NULL for MleActor.
+    const MleDirtyClass *m_superclass;
+
+    // The next of all the classes, so subclasses can be found.
+    MleDirtyClass *m_next;
+
+    // The property name owning each bit in this class, or NULL.
+    const char *m_names[MLE_DIRTY_BITS];
+
+    // The bits owned by this class's properties.
+    MleDirtyMask m_used;
+};
+
+// Declare the dirty mask accessor for a property; used by the
+// property macros below.
+#define MLE_ACTOR_DIRTY_MASK(NAME)                          \
+    static MleDirtyMask NAME##DirtyMask(void) {             \
+        static MleDirtyMask mask =                          \
+            MleActor::getPropertyDirtyMask(dirtyClass(), #NAME); \
+        return mask; }
+
 // New Actor Property definitions (to remove legacy offsetof implementation).
+//
+// Dynamic and array properties also get NAME##Adopt(), which takes over
+// the caller's storage instead of copying it: a dynamic property takes
+// ownership of an mlMalloc()ed buffer and an array property swaps
+// contents with the argument.  NAME##AdoptProperty() is the hook the
+// loader calls through the property table.
 #define MLE_ACTOR_PROPERTY(TYPE,NAME,GETTER,SETTER)         \
   public:                                                   \
     TYPE NAME;                                              \
+    MLE_PROPERTY_VALUE_TRAITS(TYPE,NAME)                    \
+    MLE_ACTOR_DIRTY_MASK(NAME)                              \
     virtual TYPE GETTER() {return NAME;}                    \
-    virtual void SETTER(TYPE value) {this->NAME = value;}   \
+    virtual void SETTER(TYPE value) {                       \
+        this->NAME = value;                                 \
+        markDirty(NAME##DirtyMask()); }                     \
+    void NAME##AdoptProperty(unsigned char *value, int) {   \
+        SETTER(*(TYPE *)value); }                           \
     int NAME##IsOfType(const char *type) {                  \
         if (strcmp(#TYPE, type) == 0) return 1;             \
         else return 0; }
@@ -109,11 +171,22 @@ class MlTransform;
 #define MLE_ACTOR_DYNAMIC_PROPERTY(TYPE,NAME,GETTER,SETTER) \
   public:                                                   \
     TYPE NAME;                                              \
+    struct NAME##DynamicTag;                                \
+    static void dynamicPropertyTag(NAME##DynamicTag *) {}   \
+    MLE_PROPERTY_TRAITS(TYPE,NAME,0)                        \
+    MLE_ACTOR_DIRTY_MASK(NAME)                              \
     virtual const TYPE GETTER() {return NAME;}              \
     virtual void SETTER(const TYPE value, size_t size) {    \
         if (this->NAME != NULL) mlFree(this->NAME);         \
         this->NAME = (TYPE) mlMalloc(size);                 \
-        memcpy(this->NAME, value, size); }                  \
+        memcpy(this->NAME, value, size);                    \
+        markDirty(NAME##DirtyMask()); }                     \
+    virtual void NAME##Adopt(TYPE value) {                  \
+        if (this->NAME != NULL) mlFree(this->NAME);         \
+        this->NAME = value;                                 \
+        markDirty(NAME##DirtyMask()); }                     \
+    void NAME##AdoptProperty(unsigned char *value, int) {   \
+        NAME##Adopt((TYPE) value); }                        \
     int NAME##IsOfType(const char *type) {                  \
         if (strcmp(#TYPE, type) == 0) return 1;             \
         else return 0; }
@@ -121,11 +194,22 @@ class MlTransform;
 #define MLE_ACTOR_ARRAY_PROPERTY(TYPE,NAME,GETTER,SETTER)   \
   public:                                                   \
     MleArray<TYPE> NAME;                                    \
+    MLE_PROPERTY_TRAITS(MleArray<TYPE>,NAME,0)              \
+    MLE_ACTOR_DIRTY_MASK(NAME)                              \
     virtual const MleArray<TYPE> *GETTER() {return &NAME;}  \
     virtual void SETTER(MleArray<TYPE> &value) {            \
         this->NAME.resize(value.size());                    \
         for (int i = 0; i < value.size(); i++)              \
-            this->NAME[i] = value[i]; }                     \
+            this->NAME[i] = value[i];                       \
+        markDirty(NAME##DirtyMask()); }                     \
+    virtual void NAME##Adopt(MleArray<TYPE> &value) {       \
+        mlSwapProperty(this->NAME, value);                  \
+        markDirty(NAME##DirtyMask()); }                     \
+    void NAME##AdoptProperty(unsigned char *value, int count) { \
+        MleArray<TYPE> elements(count);                     \
+        if (count > 0)                                      \
+            memcpy(&elements[0], value, count * sizeof(TYPE)); \
+        NAME##Adopt(elements); }                            \
     int NAME##IsOfArrayType(const char *type) {             \
         if (strcmp(#TYPE, type) == 0) return 1;             \
         else return 0; }
@@ -138,6 +222,65 @@ class MlTransform;
 
 // Forward declaration.
 class MleRole;
+class MleSet;
+class MleActor;
+
+// MleActor macro.
+//
+// Defines the dirty bit record of an actor class, linked to that of
+// its superclass S; used by MLE_ACTOR_SOURCE().
+#define MLE_ACTOR_DIRTY_CLASS(C,S) \
+    MleDirtyClass *C::dirtyClass(void) { \
+        static MleDirtyClass record(S::dirtyClass()); \
+        return &record; \
+    }
+
+// MleActor macro.
+//
+// Declares that the copy constructor of actor class C copies its
+// dynamic properties, so that the class may be cloned; see
+// MleActor::clone().  It is not inherited.
+#define MLE_ACTOR_COPIES_DYNAMIC_PROPERTIES(C) \
+  public: \
+    static C *dynamicPropertiesCopied(C *actor) { return actor; }
+
+// Clone traits of an actor class C.
+//
+// Each MLE_ACTOR_DYNAMIC_PROPERTY() overloads dynamicPropertyTag(), so
+// the name only resolves to MleActor's own, parameterless version in
+// a class with no dynamic properties, declared or inherited.
+template <class C, class = void> struct MleHasDynamicProperties : std::true_type {};
+template <class C> struct MleHasDynamicProperties<C, typename std::enable_if<
+    std::is_same<decltype(&C::dynamicPropertyTag), void (*)(void)>::value>::type>
+  : std::false_type {};
+
+template <class C, class = void> struct MleCopiesDynamicProperties : std::false_type {};
+template <class C> struct MleCopiesDynamicProperties<C, typename std::enable_if<
+    std::is_same<decltype(C::dynamicPropertiesCopied((C *) 0)), C *>::value>::type>
+  : std::true_type {};
+
+// A class is cloned with its copy constructor, unless the implicit one
+// would share the buffers of its dynamic properties.
+template <class C> struct MleCloneable : std::integral_constant<bool,
+    std::is_copy_constructible<C>::value &&
+    (! MleHasDynamicProperties<C>::value || MleCopiesDynamicProperties<C>::value)> {};
+
+// Copy an actor into storage for MleActor::clone(); a class that is not
+// MleCloneable is not cloned.
+template <class C> inline MleActor *mlCloneActor(const C *actor, void *storage, std::true_type)
+{ return new (storage) C(*actor); }
+template <class C> inline MleActor *mlCloneActor(const C *, void *, std::false_type)
+{ return NULL; }
+
+// MleActor macro.
+//
+// Declares the clone hooks of a concrete actor class; used by
+// MLE_ACTOR_HEADER().
+#define MLE_ACTOR_CLONE(C) \
+    virtual size_t getCloneSize(void) const { \
+        return MleCloneable<C>::value ? sizeof(C) : 0; } \
+    virtual MleActor *clone(void *storage) const { \
+        return mlCloneActor<C>(this, storage, MleCloneable<C>()); }
 
 #ifdef MLE_DIGITAL_WORKPRINT
 
@@ -158,8 +301,11 @@ class MleRole;
 // Note: This macro switches subsequent declarations to 'public.'
 #define MLE_ACTOR_HEADER(C) \
   public: \
+    MLE_ACTOR_CLONE(C) \
+    static MleDirtyClass *dirtyClass(void); \
     virtual const char *getTypeName(void) const; \
-    virtual int isa(const char *type) const; \
+    static MleTypeId classTypeId(void); \
+    virtual MleTypeId getTypeId(void) const; \
     static C *cast(MleActor *actor); \
     static void initClass(void)
 
@@ -177,14 +323,16 @@ class MleRole;
 //
 #define MLE_ACTOR_SOURCE(C,S) \
     const char *C::getTypeName(void) const { return #C; } \
-    int C::isa(const char *type) const { \
-	if ( !strcmp(type,#C) ) return 1; \
-	else return S::isa(type); \
+    MleTypeId C::classTypeId(void) { \
+        static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+        return type; \
     } \
+    MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
     C *C::cast(MleActor *actor) { \
-	MLE_ASSERT(actor->isa(#C)); \
+	MLE_ASSERT(actor->isa(C::classTypeId())); \
 	return (C *)actor; \
     } \
+    MLE_ACTOR_DIRTY_CLASS(C,S) \
     MleActor *_mlCreate##C(void) { return new C; }
 
 // MleActor DWP-only macro.
@@ -192,8 +340,10 @@ class MleRole;
 // This macro should be used instead of MLE_ACTOR_HEADER for abstract classes.
 #define MLE_ACTOR_ABSTRACT_HEADER(C) \
   public: \
+    static MleDirtyClass *dirtyClass(void); \
     virtual const char *getTypeName(void) const = 0; \
-    virtual int isa(const char *type) const; \
+    static MleTypeId classTypeId(void); \
+    virtual MleTypeId getTypeId(void) const; \
     static C *cast(MleActor *actor); \
     static void initClass(void)
 
@@ -201,14 +351,16 @@ class MleRole;
 //
 // This macro should be used instead of MLE_ACTOR_SOURCE for abstract classes
 #define MLE_ACTOR_ABSTRACT_SOURCE(C,S) \
-    int C::isa(const char *type) const { \
-	if ( !strcmp(type,#C) ) return 1; \
-	else return S::isa(type); \
+    MleTypeId C::classTypeId(void) { \
+        static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+        return type; \
     } \
+    MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
     C *C::cast(MleActor *actor) { \
-	MLE_ASSERT(actor->isa(#C)); \
+	MLE_ASSERT(actor->isa(C::classTypeId())); \
 	return (C *)actor; \
     } \
+    MLE_ACTOR_DIRTY_CLASS(C,S) \
     MleActor *_mlCreate##C(void) { return NULL; }
 
 // MleActor DWP-only macro.
@@ -228,6 +380,7 @@ class MleRole;
     if ( _mleActorClassInited ) return; \
     _mleActorClassInited = 1; \
     SUPERCLASS::initClass(); \
+    ACTOR::classTypeId(); \
     new MleActorClass(#ACTOR,_mlCreate##ACTOR,#SUPERCLASS)
 
 // MleActor DWP-only macro.
@@ -240,6 +393,7 @@ class MleRole;
     if ( _mleActorClassInited ) return; \
     _mleActorClassInited = 1; \
     SUPERCLASS::initClass(); \
+    ACTOR::classTypeId(); \
     new MleActorClass(#ACTOR,_mlCreate##ACTOR,#SUPERCLASS, #EDITOR, #CONTENT_EDITOR)
 
 // MleActor DWP-only macro.
@@ -262,6 +416,11 @@ class MleRole;
 	entryFor##MEMBER->name = #MEMBER; \
 	entryFor##MEMBER->getProperty = ACTOR::getProperty; \
 	entryFor##MEMBER->setProperty = ACTOR::setProperty; \
+	entryFor##MEMBER->nameHash = mlPropertyHash(#MEMBER); \
+	entryFor##MEMBER->type = #TYPE; \
+	entryFor##MEMBER->offset = MLE_PROPERTY_OFFSET(ACTOR,MEMBER); \
+	entryFor##MEMBER->size = sizeof(((ACTOR *)0)->MEMBER); \
+	entryFor##MEMBER->flags = ACTOR::MEMBER##PropertyFlags(); \
     MleActorClass::find(#ACTOR)->addMember(#MEMBER,#TYPE,entryFor##MEMBER)
 #endif
 
@@ -285,12 +444,19 @@ class MleRole;
 
 // Need a statement so trailing semicolon will work.
 #define MLE_ACTOR_HEADER(C) \
+  public: \
+    MLE_ACTOR_CLONE(C) \
+    static MleDirtyClass *dirtyClass(void); \
     friend class _mleDummy
 #define MLE_ACTOR_ABSTRACT_HEADER(C) \
+  public: \
+    static MleDirtyClass *dirtyClass(void); \
     friend class _mleDummy
 #define MLE_ACTOR_SOURCE(C,S) \
+    MLE_ACTOR_DIRTY_CLASS(C,S) \
     MleActor *_mlCreate##C(void) { return new C; }
-#define MLE_ACTOR_ABSTRACT_SOURCE(C,S)
+#define MLE_ACTOR_ABSTRACT_SOURCE(C,S) \
+    MLE_ACTOR_DIRTY_CLASS(C,S)
 #endif /* MLE_DIGITAL_PLAYPRINT */
 
 /**
@@ -403,6 +569,12 @@ class MLE_RUNTIME_API MleActor : public MleObject
      * removeRole functions are private and protected, respectively.
 	 */
     friend class MleRole;
+
+    /**
+     * MleSet is a friend of MleActor so that it can maintain its
+     * list of dirty actors through the actor's links.
+	 */
+    friend class MleSet;
     
     /**
      * @brief Default property get accessor.
@@ -444,7 +616,43 @@ class MLE_RUNTIME_API MleActor : public MleObject
      * unregistered from the actor registry.
 	 */
     virtual ~MleActor();
-    
+
+    /**
+	 * @brief Get the size of the storage clone() needs.
+	 *
+     * @return The size of the actor's class, or 0 if the actor cannot
+     * be cloned.
+	 */
+    virtual size_t getCloneSize(void) const;
+
+    /**
+	 * @brief Copy the actor.
+	 *
+     * MLE_ACTOR_HEADER() implements this for each actor class with the
+     * class's copy constructor, so the copy has the actor's property
+     * values without any setters being called.  An actor class whose
+     * members cannot be copied memberwise must define a copy
+     * constructor that copies them properly.  A class with a
+     * MLE_ACTOR_DYNAMIC_PROPERTY(), declared or inherited, is not
+     * cloned unless it defines a copy constructor that duplicates the
+     * property buffers and says so with
+     * MLE_ACTOR_COPIES_DYNAMIC_PROPERTIES().
+     *
+     * The copy has no role and has not been initialized.  Every
+     * property is marked dirty.
+	 *
+	 * @param storage getCloneSize() bytes in which to construct the
+	 * copy, suitably aligned.  The copy is deleted normally, so the
+	 * storage must come from operator new or an MleArena.
+	 *
+	 * @return The copy, or NULL if the actor cannot be cloned.
+	 */
+    virtual MleActor *clone(void *storage) const;
+
+    // The overload that MLE_ACTOR_DYNAMIC_PROPERTY() hides; see
+    // MleHasDynamicProperties.
+    static void dynamicPropertyTag(void) {}
+
     /**
 	 * @brief Get the actor's role.
 	 *
@@ -458,6 +666,83 @@ class MLE_RUNTIME_API MleActor : public MleObject
      * is called is undefined.
 	 */
     MleRole* getRole(void) const { return m_role; }
+
+    /**
+	 * @brief Get the dirty bit record of MleActor, the root of all
+	 * the actor classes' records.
+	 */
+    static MleDirtyClass *dirtyClass(void);
+
+    /**
+	 * @brief Get the dirty bit assigned to a property of a class.
+	 *
+     * The first call for a name assigns it a bit that no other
+     * property of the class, its superclasses or its subclasses
+     * owns; later calls return the same bit.  A class that runs out
+     * of bits fails an assertion; without assertions the property
+     * is given every bit, so that changes to it are never missed.
+	 *
+	 * @param dirtyClass The record of the class declaring the property.
+	 * @param property The name of the property.  It is kept, not copied.
+	 *
+	 * @return A mask with the property's bit set.
+	 */
+    static MleDirtyMask getPropertyDirtyMask(MleDirtyClass *dirtyClass, const char *property);
+
+    /**
+	 * @brief Get the actor's dirty mask.
+	 *
+     * The property setters generated by MLE_ACTOR_PROPERTY(),
+     * MLE_ACTOR_DYNAMIC_PROPERTY() and MLE_ACTOR_ARRAY_PROPERTY()
+     * set their property's bit.  Note that actors loaded by
+     * mleLoadGroup() start out dirty, since loading goes through
+     * the same setters.
+	 */
+    MleDirtyMask getDirtyMask(void) const { return m_dirtyMask; }
+
+    /**
+	 * @brief Test the actor's dirty mask.
+	 *
+	 * @param mask The bits to test; all bits by default.
+	 *
+	 * @return TRUE if any of the bits in mask are dirty.
+	 */
+    MlBoolean isDirty(MleDirtyMask mask = MLE_DIRTY_ALL) const
+    { return (m_dirtyMask & mask) ? TRUE : FALSE; }
+
+    /**
+	 * @brief Mark properties of the actor as changed.
+	 *
+     * The first time an actor becomes dirty it is appended to the
+     * dirty actor list of its role's set, if it has one.
+	 *
+	 * @param mask The bits to set.
+	 */
+    void markDirty(MleDirtyMask mask)
+    {
+        MleDirtyMask old = m_dirtyMask;
+        m_dirtyMask = old | mask;
+        if (! old && mask) enlistDirty();
+    }
+
+    /**
+	 * @brief Clear bits of the actor's dirty mask.
+	 *
+     * Once no bits remain the actor is dropped from its set's
+     * dirty actor list.
+	 *
+	 * @param mask The bits to clear; all bits by default.
+	 *
+	 * @return The bits of mask that were dirty.
+	 */
+    MleDirtyMask clearDirty(MleDirtyMask mask = MLE_DIRTY_ALL);
+
+    /**
+	 * @brief Get the next actor in the set's dirty actor list.
+	 *
+	 * @see MleSet::getDirtyActors()
+	 */
+    MleActor *getNextDirtyActor(void) const { return m_dirtyNext; }
     
     /**
 	 * @brief Initialize the actor.
@@ -501,6 +786,33 @@ class MLE_RUNTIME_API MleActor : public MleObject
 	 */
     virtual int isa(const char *type) const;
 
+	/**
+	 * @brief Get the interned type symbol of the actor class.
+	 *
+     * Rehearsal-only member function.  The class name is interned,
+     * beneath its superclass, the first time this is called.
+	 */
+    static MleTypeId classTypeId(void);
+
+	/**
+	 * @brief Get the interned type symbol of the actor instance's class.
+	 *
+     * Rehearsal-only member function.
+	 */
+    virtual MleTypeId getTypeId(void) const;
+
+	/**
+	 * @brief Determine whether the actor class is of the specified type.
+	 *
+     * Rehearsal-only member function.  Unlike the string version,
+     * this costs two integer compares however deep the hierarchy is.
+	 *
+	 * @param type The symbol of the actor superclass candidate,
+     * e.g. MyActor::classTypeId().
+	 */
+    int isa(MleTypeId type) const
+    { return MleTypeSymbol::isa(getTypeId(),type); }
+
     /**
 	 * @brief Initialize the actor's class.
 	 *
@@ -760,7 +1072,25 @@ class MLE_RUNTIME_API MleActor : public MleObject
 	 */
     void  operator delete(void *p);
 
+	/**
+	 * Construct an actor in storage, for clone().
+	 */
+	void* operator new(size_t /* tSize */, void *storage) { return storage; }
+
+	/**
+	 * Match the placement operator new; there is nothing to free.
+	 */
+    void  operator delete(void * /* p */, void * /* storage */) {}
+
   protected:
+
+	/**
+	 * @brief Copy the actor's base state, for clone().
+	 *
+	 * The copy has no role, no name and is not on any dirty list.
+	 */
+    MleActor(const MleActor &actor);
+
 	/**
 	 * @brief Remove the role from this actor.
 	 *
@@ -793,9 +1123,21 @@ class MLE_RUNTIME_API MleActor : public MleObject
 
   private:
 
+    // Append the actor to its set's dirty actor list.
+    void enlistDirty(void);
+
 	// The actor's role.
     MleRole* m_role;
 
+    // The dirty property bits.
+    MleDirtyMask m_dirtyMask;
+
+    // The set whose dirty actor list holds this actor, and the
+    // neighbouring actors in that list.
+    MleSet *m_dirtySet;
+    MleActor *m_dirtyPrev;
+    MleActor *m_dirtyNext;
+
 #ifdef MLE_DIGITAL_WORKPRINT
 	// The name of the actor.
     char* m_name;
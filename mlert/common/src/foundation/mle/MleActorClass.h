@@ -41,16 +41,54 @@
 #ifndef __MLE_ACTORCLASSTABLE_H_
 #define __MLE_ACTORCLASSTABLE_H_
 
+#include "mle/mlTypes.h"
 #include "mle/DwpStrKeyDict.h"
 #include "mle/MleRuntime.h"
 #include "mle/MleDsoLoader.h"
 #include "mle/MleProperty.h"
+#include "mle/MleFlatPtrDict.h"
 #define TEMPLATE
 #include "mle/MlePtrArray.h"
 
 class MleActor;
 class MleActorClass;
 class MleDwpDatatype;
+class MleDwpDataUnion;
+
+/**
+ * The ways a workprint value can be converted into an Actor property.
+ * Each member resolves its kind from its datatype when it is registered,
+ * so poking a value needs no datatype name compares.
+ */
+enum MleActorMemberKind
+{
+    MLE_MEMBER_GENERIC = 0,   // passed as a copy of the MleDwpDataUnion
+    MLE_MEMBER_FLOATARRAY,
+    MLE_MEMBER_INTARRAY,
+    MLE_MEMBER_SCALARARRAY,
+    MLE_MEMBER_VECTOR3ARRAY,
+    MLE_MEMBER_VECTOR2,
+    MLE_MEMBER_VECTOR3,
+    MLE_MEMBER_VECTOR4,
+    MLE_MEMBER_TRANSFORM,
+    MLE_MEMBER_ROTATION,
+    MLE_MEMBER_STRING,
+    MLE_MEMBER_NUM_KINDS
+};
+
+/** The size of an MleActorMemberValue, in bytes. */
+#define MLE_ACTOR_MEMBER_VALUE_SIZE 128
+
+/**
+ * Storage for a property value converted by MleActorMember::convert().
+ * It is large enough for the value of any MleActorMemberKind.
+ */
+union MLE_RUNTIME_API MleActorMemberValue
+{
+    char m_bytes[MLE_ACTOR_MEMBER_VALUE_SIZE];
+    double m_alignDouble;
+    void *m_alignPointer;
+};
 
 /**
  * This class represents a property registered by an Actor in its
@@ -83,6 +121,43 @@ class MLE_RUNTIME_API MleActorMember
 	 */
     MlePropertyEntry *getEntry(void) const { return m_entry; }
 
+	/**
+	 * Get the conversion kind of the property, resolved from its
+	 * type when the member was created.
+	 *
+	 * @return One of the MleActorMemberKind values.
+	 */
+    MleActorMemberKind getKind(void) const { return m_kind; }
+
+	/**
+	 * Determine whether a workprint value of the given type can be
+	 * assigned to this property.
+	 *
+	 * @param type The datatype of the value.
+	 *
+	 * @return TRUE if the types match.
+	 */
+    MlBoolean matches(const MleDwpDatatype *type) const;
+
+	/**
+	 * Convert a workprint value into the form the property setter
+	 * expects.
+	 *
+	 * @param value The workprint value; its type must match.
+	 * @param buffer Storage the converted value may be built in.
+	 *
+	 * @return A pointer to pass to the setter.  It must be handed to
+	 * release() when it is no longer needed.
+	 */
+    void *convert(MleDwpDataUnion *value,MleActorMemberValue *buffer) const;
+
+	/**
+	 * Destroy a value returned by convert().
+	 *
+	 * @param pvalue The converted value.
+	 */
+    void release(void *pvalue) const;
+
 	/**
 	 * Override operator new.
 	 *
@@ -116,10 +191,243 @@ class MLE_RUNTIME_API MleActorMember
     const MleDwpDatatype *m_type;
 	/** Property meta-dta. */
     MlePropertyEntry *m_entry;
+	/** Property conversion kind. */
+    MleActorMemberKind m_kind;
 
     friend class MleActorClass;
 };
 
+// This is a slot of an MleActorMemberTable.
+struct MLE_RUNTIME_API MleActorMemberSlot
+{
+    const char *m_name;               // NULL if the slot is empty
+    const MleActorMember *m_member;
+    unsigned int m_hash;              // hash of m_name
+};
+
+/**
+ * This is an immutable table of Actor members keyed by property name.
+ *
+ * The table is built in one step from a complete list of members using
+ * hash-and-displace perfect hashing: the names are split into small
+ * buckets, and each bucket is given a seed that sends all of its names
+ * to distinct slots.  A lookup therefore examines exactly one slot.
+ */
+class MLE_RUNTIME_API MleActorMemberTable
+{
+  public:
+
+    MleActorMemberTable(void);
+
+    ~MleActorMemberTable();
+
+    /**
+     * Rebuild the table from a list of members.
+     *
+     * @param num The number of members.
+     * @param names The property names; these must be distinct and must
+     * outlive the table.
+     * @param members The member objects, parallel to names.
+     */
+    void build(int num,const char **names,const MleActorMember **members);
+
+    /**
+     * Discard the contents of the table.
+     */
+    void clear(void);
+
+    /**
+     * Look up a member by property name.
+     *
+     * @return A pointer to the member, or NULL if there is none.
+     */
+    const MleActorMember *find(const char *name) const;
+
+    /**
+     * Get the number of members in the table.
+     */
+    int getNumMembers(void) const { return (int)m_numMembers; }
+
+    /**
+     * Get the number of slots; empty slots have a NULL name.
+     */
+    int getNumSlots(void) const { return (int)m_numSlots; }
+
+    /**
+     * Get a slot by index.
+     */
+    const MleActorMemberSlot *getSlot(int index) const
+      { return &m_slots[index]; }
+
+	/**
+	 * Override operator new.
+	 *
+	 * @param tSize The size, in bytes, to allocate.
+	 */
+	void* operator new(size_t tSize);
+
+	/**
+	 * Override operator delete.
+	 *
+	 * @param p A pointer to the memory to delete.
+	 */
+    void  operator delete(void *p);
+
+  protected:
+
+    /** The number of members. */
+    unsigned int m_numMembers;
+    /** The number of slots; zero or a power of two. */
+    unsigned int m_numSlots;
+    /** The slot array. */
+    MleActorMemberSlot *m_slots;
+    /** The number of buckets; a power of two. */
+    unsigned int m_numBuckets;
+    /** The displacement seed of each bucket. */
+    unsigned int *m_seeds;
+
+  private:
+
+    // Hide the copy constructor and assignment operator.
+    MleActorMemberTable(const MleActorMemberTable &);
+    void operator =(const MleActorMemberTable &);
+};
+
+// One property assignment of an MleActorPlan.
+struct MLE_RUNTIME_API MleActorPlanStep
+{
+    const MleActorMember *m_member;
+    void *m_value;                    // converted value passed to the setter
+};
+
+/**
+ * An MleActorPlan is the compiled form of the property assignments
+ * an actor template makes.
+ *
+ * The loader builds one the first time a template is instantiated for
+ * an actor class: each property is resolved to its member and its value
+ * is converted once.  Every later instance of the template then has its
+ * template properties set by a single pass over the plan, with no member
+ * lookups, type checks or conversions.  Plans are owned by the
+ * MleActorClass they were built for.
+ *
+ * A plan holds its own copies of the converted values and never looks
+ * at its template again, so it is safe to keep after the workprint
+ * items it was built from are deleted; it is discarded the next time it
+ * is looked up.
+ */
+class MLE_RUNTIME_API MleActorPlan
+{
+  public:
+
+	/**
+	 * The constructor.
+	 *
+	 * @param ac The Actor class the plan applies to.
+	 * @param maxSteps The largest number of properties that will be added.
+	 */
+    MleActorPlan(const MleActorClass *ac,int maxSteps);
+
+    /**
+     * The destructor releases the converted values.
+     */
+    ~MleActorPlan();
+
+	/**
+	 * Add a property assignment, converting its value now.
+	 *
+	 * A property that is not present on the class, or whose type does
+	 * not match, is reported and left out of the plan, as poke() would.
+	 *
+	 * @param name The name of the property.
+	 * @param value The workprint value; it is copied into the plan.
+	 *
+	 * @return Zero if the property was added, nonzero otherwise.
+	 */
+    int addProperty(const char *name,MleDwpDataUnion *value);
+
+	/**
+	 * Set the planned properties on an actor, in the order they were
+	 * added.
+	 *
+	 * @param actor The actor, which must be of the plan's class.
+	 */
+    void apply(MleActor *actor) const;
+
+	/**
+	 * Get the number of property assignments in the plan.
+	 */
+    int getNumSteps(void) const { return m_numSteps; }
+
+	/**
+	 * Get the member generation the plan was built at.
+	 */
+    unsigned int getGeneration(void) const { return m_generation; }
+
+	/**
+	 * Get the template generation the plan was built at.
+	 */
+    unsigned int getTemplateGeneration(void) const { return m_templateGeneration; }
+
+	/**
+	 * Override operator new.
+	 *
+	 * @param tSize The size, in bytes, to allocate.
+	 */
+	void* operator new(size_t tSize);
+
+	/**
+	 * Override operator delete.
+	 *
+	 * @param p A pointer to the memory to delete.
+	 */
+    void  operator delete(void *p);
+
+  protected:
+
+    /** The Actor class the plan was built for. */
+    const MleActorClass *m_class;
+    /** The property assignments. */
+    MleActorPlanStep *m_steps;
+    /** Storage for the converted values, parallel to m_steps. */
+    MleActorMemberValue *m_values;
+    /** The number of steps in use. */
+    int m_numSteps;
+    /** The number of steps allocated. */
+    int m_maxSteps;
+    /** The member generation the steps were resolved at. */
+    unsigned int m_generation;
+    /** The member removal count when the steps were resolved. */
+    unsigned int m_removals;
+    /** The template generation the values were converted at. */
+    unsigned int m_templateGeneration;
+
+  private:
+
+    // Hide the copy constructor and assignment operator.
+    MleActorPlan(const MleActorPlan &);
+    void operator =(const MleActorPlan &);
+};
+
+/**
+ * The well-known transform members of an Actor class, each already
+ * checked against the datatype MleActor's transform interface expects.
+ * A member that is absent or of another type is NULL.
+ */
+struct MLE_RUNTIME_API MleActorTransformMembers
+{
+    int m_capabilities;                    // the MleActor::hasTransform() result
+    const MleActorMember *m_transform;     // "transform" as a transform
+    const MleActorMember *m_position3;     // "position" as a 3D vector
+    const MleActorMember *m_position2;     // "position" as a 2D vector
+    const MleActorMember *m_translation3;  // "translation" as a 3D vector
+    const MleActorMember *m_translation2;  // "translation" as a 2D vector
+    const MleActorMember *m_scale3;        // "scale" as a 3D vector
+    const MleActorMember *m_scale1;        // "scale" as a scalar
+    const MleActorMember *m_orientation;   // "orientation" as a rotation
+    const MleActorMember *m_rotation;      // "rotation" as a 3D vector
+};
+
 /**
  * This is an object that contains MleActorClass pointers.  It needs
  * to be a distinguished object so it can create dictionary entries
@@ -165,6 +473,11 @@ class MLE_RUNTIME_API MleActorClassDict : public MleDwpStrKeyDict
  * of the Actor class, and it is a dictionary of Actor members
  * (properties).  It has a static find() function that can be used to
  * look up an Actor class by name.
+ *
+ * The dictionary holds only the members registered on this class
+ * itself.  Inherited members are found through the superclass's
+ * flattened member table, which is built once and shared by all of
+ * its subclasses, so no member is copied down the hierarchy.
  */
 class MLE_RUNTIME_API MleActorClass : public MleDwpStrKeyDict
 {
@@ -230,7 +543,12 @@ class MLE_RUNTIME_API MleActorClass : public MleDwpStrKeyDict
     MlePropertyEntry *removeMember(const char *name);
 
 	/**
-	 * Finds the member object of a given name.
+	 * Finds the member object of a given name, including members
+	 * inherited from superclasses.
+	 *
+	 * This probes the perfect hash of this class's own members and
+	 * then that of the superclass's flattened table, building either
+	 * table first if members have been registered since it was built.
 	 *
 	 * @param name The name of the member to find.
 	 *
@@ -238,6 +556,64 @@ class MLE_RUNTIME_API MleActorClass : public MleDwpStrKeyDict
 	 */
     const MleActorMember *findMember(const char *name) const;
 
+    /**
+     * Get the superclass of this Actor class.
+     *
+     * @return A pointer to the superclass, or NULL for a root class.
+     */
+    MleActorClass *getSuperclass(void) const { return m_superclass; }
+
+    /**
+     * Find the property plan built for an actor template.
+     *
+     * A plan built before members were last added to or removed from
+     * any Actor class, or before the last call to invalidatePlans(),
+     * is discarded.
+     *
+     * @param tmpl The actor template the plan was built from.  It is
+     * only used as a key.
+     *
+     * @return A pointer to the plan, or NULL if there is none.
+     */
+    const MleActorPlan *findPlan(const void *tmpl);
+
+    /**
+     * Keep the property plan built for an actor template.  The class
+     * takes ownership of the plan, replacing any previous one.
+     *
+     * @param tmpl The actor template the plan was built from.
+     * @param plan The plan.
+     */
+    void addPlan(const void *tmpl,MleActorPlan *plan);
+
+    /**
+     * Delete the property plans of this class.
+     */
+    void deletePlans(void);
+
+    /**
+     * Delete the property plans of every registered Actor class.
+     */
+    static void flushPlans(void);
+
+    /**
+     * Mark the property plans of every Actor class stale.  This must be
+     * called whenever a workprint is fetched or released, or its actor
+     * templates may otherwise have been edited, replaced or deleted, so
+     * that a new template at a freed template's address does not find
+     * its plan.  Stale plans are rebuilt the next time they are found.
+     */
+    static void invalidatePlans(void) { g_templateGeneration++; }
+
+    /**
+     * Get the transform members of this class.  They are resolved
+     * the first time they are asked for, and again after members
+     * are added to or removed from any Actor class.
+     *
+     * @return A pointer to the cached members.
+     */
+    const MleActorTransformMembers *getTransformMembers(void) const;
+
     /**
      * Add the member into a property dataset.  A new property
      * dataset is created if it hasn't been created yet.
@@ -310,6 +686,55 @@ class MLE_RUNTIME_API MleActorClass : public MleDwpStrKeyDict
 
 	/** The instance creation function pointer. */
     MleActor *(*create)(void);
+
+    /** The immediate superclass, if it was registered. */
+    MleActorClass *m_superclass;
+
+    /** Perfect hash of the members registered on this class. */
+    MleActorMemberTable m_localTable;
+    /** The member generation m_localTable was built at. */
+    unsigned int m_localGeneration;
+    /**
+     * All members visible in this class, built the first time a
+     * subclass or an iterator needs it.
+     */
+    MleActorMemberTable *m_flatTable;
+    /** The member generation m_flatTable was built at. */
+    unsigned int m_flatGeneration;
+
+    /** Property plans, keyed by actor template; NULL until one is added. */
+    MleFlatPtrDict *m_plans;
+
+    /** The resolved transform members. */
+    MleActorTransformMembers m_transformMembers;
+    /** The member generation m_transformMembers was resolved at. */
+    unsigned int m_transformGeneration;
+
+    /**
+     * Incremented whenever a member is added to or removed from any
+     * Actor class; tables built at an older generation are stale.
+     */
+    static unsigned int g_memberGeneration;
+
+    /** Incremented whenever a member is removed from any Actor class. */
+    static unsigned int g_memberRemovals;
+
+    /** Incremented by invalidatePlans(); older plans are stale. */
+    static unsigned int g_templateGeneration;
+
+    friend class MleActorPlan;
+
+    /**
+     * Get the table of members registered on this class, rebuilding
+     * it if it is stale.
+     */
+    const MleActorMemberTable *getLocalTable(void);
+
+    /**
+     * Get the table of all members visible in this class, rebuilding
+     * it if it is stale.
+     */
+    const MleActorMemberTable *getFlatTable(void);
     
     /**
 	 * This is a MleDwpDict virtual override that creates entries
@@ -337,9 +762,10 @@ class MLE_RUNTIME_API MleActorClass : public MleDwpStrKeyDict
 
 /**
  * This is a simple iterator class to run through an Actor class property
- * list.
+ * list.  Inherited properties are included.  The class must not gain
+ * or lose members while it is being iterated.
  */
-class MLE_RUNTIME_API MleActorMemberIter : public MleDwpDictIter
+class MLE_RUNTIME_API MleActorMemberIter
 {
   public:
 
@@ -348,28 +774,32 @@ class MLE_RUNTIME_API MleActorMemberIter : public MleDwpDictIter
 	 *
 	 * @param ac The argument is the Actor class whose properties are of interest.
 	 */
-    MleActorMemberIter(MleActorClass *ac) : MleDwpDictIter(*ac) {};
+    MleActorMemberIter(MleActorClass *ac);
     
     /**
 	 * Get the name for the current property.
 	 *
-	 * @return The name of the current property is returned.
+	 * @return The name of the current property is returned, or NULL
+	 * if the iteration is finished.
 	 */
     const char *getName(void) const
-      { return (const char *)getKey(); }
+      { return m_slot ? m_slot->m_name : NULL; }
 
 	/**
 	 * Get the member object pointer for the current property.
 	 *
-	 * @return A pointer to the MleActorMemeber is returned.
+	 * @return A pointer to the MleActorMemeber is returned, or NULL
+	 * if the iteration is finished.
 	 */
     const MleActorMember *getMember(void) const
-      { return (const MleActorMember *)getValue(); }
+      { return m_slot ? m_slot->m_member : NULL; }
     
     /**
 	 * Change the state of the iterator to the next property.
+	 *
+	 * @return Nonzero if there is a next property.
 	 */
-    int next(void) { return MleDwpDictIter::next(); }
+    int next(void);
 
 	/**
 	 * Override operator new.
@@ -384,6 +814,15 @@ class MLE_RUNTIME_API MleActorMemberIter : public MleDwpDictIter
 	 * @param p A pointer to the memory to delete.
 	 */
     void  operator delete(void *p);
+
+  protected:
+
+    /** The flattened member table of the class being iterated. */
+    const MleActorMemberTable *m_table;
+    /** The index of the current slot. */
+    int m_index;
+    /** The current slot, or NULL when finished. */
+    const MleActorMemberSlot *m_slot;
 };
 
 #endif /* __MLE_ACTORCLASSTABLE_H_ */
@@ -71,20 +71,29 @@ typedef enum
     MLE_CHUNK_SET
 } MleChunkType;
 
-extern unsigned char* g_streamEnd;
-
-extern struct MleGCRegistry* g_actorRegistry;
-
-extern struct MleGCRegistry* g_actorRegistryPtr;
-
-#if defined(MLE_DEBUG)
 /**
- * The end of registry.
+ * The state of one chunk load.
+ *
+ * Everything parseStream() builds up while loading a group chunk lives
+ * here rather than in globals, so a load started while another is in
+ * progress, such as a set loaded by bindRoleOpcode or a group loaded
+ * from an actor's init(), has state of its own, and a loaded group may
+ * be committed after other chunks have been parsed.
  */
-extern struct MleGCRegistry* g_actorRegistryEnd;
-#endif /* MLE_DEBUG */
+struct MleLoadContext
+{
+    struct MleGCRegistry *m_registry;   // actors, in load order
+    int m_size;                         // capacity of the arrays
+    int m_numActors;                    // entries of m_registry in use
+    MleSet **m_sets;                    // the set each actor's role is bound to
+    int *m_attached;                    // nonzero once a role is attached
+    MleSet *m_currentSet;               // the set of the role being created
+};
+
+extern unsigned char* g_streamEnd;
 
-extern void chunkInitialization(int sizeofRegistry);
+// Allocate a context's arrays for a group of sizeofRegistry actors.
+extern void chunkInitialization(MleLoadContext *context, int sizeofRegistry);
 
 extern int readIndex(unsigned char *&streamPtrRef, unsigned char *streamStart,
   unsigned char *streamEnd);
@@ -92,8 +101,85 @@ extern int readIndex(unsigned char *&streamPtrRef, unsigned char *streamStart,
 extern int readInt(unsigned char *&streamPtrRef, unsigned char *streamStart,
   unsigned char *streamEnd);
 
-extern void parseStream(unsigned char *&streamPtrRef,
+/**
+ * The receiver of the operations decodeStream() finds in a chunk.
+ *
+ * The decoder reads the opcodes and their arguments, keeps the state
+ * they set up (the set of the next role, the parent of the next child
+ * role, the current property and its length) and resolves property
+ * indices against the runtime tables.  What is done with each operation
+ * is up to the visitor: parseStream() creates the objects at once and
+ * MleGroupTemplate records them.  Values point into the chunk, so they
+ * only last the call.
+ */
+class MleChunkVisitor
+{
+  public:
+
+    virtual ~MleChunkVisitor(void) {}
+
+    // An actor of class index classIndex begins.
+    virtual void createActor(int classIndex) = 0;
+
+    // The current actor gets a role of class index roleIndex, bound to
+    //   set setIndex.
+    virtual void bindRole(int setIndex, int roleIndex) = 0;
+
+    // The role of actor childIndex is the child of actor parentIndex's;
+    //   both are indices within the group.
+    virtual void attachRole(int parentIndex, int childIndex) = 0;
+
+    virtual void setProperty(MlePropertyEntry *propertyEntry,
+        unsigned char *value, int length) = 0;
+
+    virtual void setDynamicProperty(MlePropertyEntry *propertyEntry,
+        unsigned char *value, int length) = 0;
+
+    virtual void setArrayProperty(MlePropertyEntry *propertyEntry,
+        unsigned char *elements, int numElements, int elementLength) = 0;
+
+    virtual void setMediaRef(MlePropertyEntry *propertyEntry, int mrefIndex) = 0;
+
+    // The set of index setIndex begins; only in set chunks.
+    virtual void createSet(int setIndex);
+};
+
+// Decode the opcodes of a group or set chunk, from streamPtrRef to
+//   streamEnd, for a visitor.
+extern void decodeStream(MleChunkVisitor *visitor,
+  unsigned char *&streamPtrRef,
+  unsigned char *streamStart, unsigned char *streamEnd,
+  MleChunkType chunkType);
+
+// Load the objects of a chunk, decoding it with decodeStream().
+extern void parseStream(MleLoadContext *context,
+  unsigned char *&streamPtrRef,
   unsigned char *streamStart, unsigned char *streamEnd,
   MleChunkType chunkType);
 
+// Add an actor to a context, with no role or set yet.
+extern void registerActor(MleLoadContext *context, MleActor *actor, int index);
+
+// Create the role of the last actor added to a context, for the
+//   context's current set.
+extern MleRole *createRole(MleLoadContext *context, MleActor *actor,
+  MleRole *(*constructor)(MleActor *a));
+
+// Hand property values read from a chunk to an object's setters.  The
+//   values are copied, so need only last the call.
+extern void loadProperty(MleObject *object, MlePropertyEntry *propertyEntry,
+  unsigned char *value, int length);
+
+extern void loadDynamicProperty(MleObject *object, MlePropertyEntry *propertyEntry,
+  unsigned char *value, int length);
+
+extern void loadArrayProperty(MleObject *object, MlePropertyEntry *propertyEntry,
+  unsigned char *elements, int numElements, int elementLength);
+
+// Attach an actor's role to its set, unless it already has a parent.
+extern void attachGroupRole(MleLoadContext *context, int actorIndex);
+
+// Free the arrays allocated by chunkInitialization().
+extern void releaseLoadContext(MleLoadContext *context);
+
 #endif /* __MLE_ACTORGC_H_ */
@@ -0,0 +1,145 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleArena.h
+ * @ingroup MleFoundation
+ *
+ * @brief Block allocation for cloned objects.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __MLE_ARENA_H_
+#define __MLE_ARENA_H_
+
+// Include system header files.
+#include <stddef.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlTypes.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleRuntime.h"
+
+// The alignment of every allocation from an arena.
+#define MLE_ARENA_ALIGNMENT 16
+
+
+/**
+ * @brief MleArena hands out pieces of one block of memory.
+ *
+ * An arena is sized up front for a batch of objects, such as the actors
+ * and roles of a cloned group, which are then allocated from it with a
+ * pointer bump instead of one heap allocation each.
+ *
+ * The objects are still deleted one at a time, in any order: the
+ * operator delete of MleActor and MleRole pass their pointer to free(),
+ * which recognizes memory belonging to an arena.  The arena counts its
+ * live allocations and gives its block back to the heap when the last
+ * has been freed and its creator has called release().
+ */
+class MLE_RUNTIME_API MleArena
+{
+  public:
+
+    /**
+     * @brief Create an arena.
+     *
+     * @param size The number of bytes to reserve; allocations take
+     * align() of their size.
+     */
+    MleArena(size_t size);
+
+    /**
+     * @brief Allocate from the arena.
+     *
+     * @param size The number of bytes needed.
+     *
+     * @return The memory, aligned to MLE_ARENA_ALIGNMENT, or NULL if
+     * the arena has too little left.
+     */
+    void *allocate(size_t size);
+
+    /**
+     * @brief Give up the creator's hold on the arena.
+     *
+     * No more may be allocated from it.  The arena deletes itself once
+     * all of its allocations have been freed, or now if there are none.
+     */
+    void release(void);
+
+    /**
+     * @brief Free memory allocated from any arena.
+     *
+     * @param p The memory, which need not have come from an arena.
+     *
+     * @return TRUE if p belonged to an arena and has been freed, FALSE
+     * if it is some other memory, which the caller must free.
+     */
+    static MlBoolean free(void *p);
+
+    /**
+     * @brief Round a size up to the arena alignment.
+     */
+    static size_t align(size_t size)
+    { return (size + MLE_ARENA_ALIGNMENT - 1) & ~((size_t) MLE_ARENA_ALIGNMENT - 1); }
+
+    // Override operator new.
+    void* operator new(size_t tSize);
+
+    // Override operator delete.
+    void  operator delete(void *p);
+
+  private:
+
+    char *m_block;          // the memory handed out
+    size_t m_size;          // bytes in m_block
+    size_t m_used;          // bytes handed out so far
+    int m_references;       // live allocations, plus one until release()
+
+    // Arenas delete themselves.
+    ~MleArena(void);
+
+    // Drop one reference, deleting the arena when none remain.
+    void unreference(void);
+
+    // The arenas with live allocations, ordered by block address.
+    static MleArena **g_arenas;
+    static int g_numArenas;
+    static int g_maxArenas;
+
+    static int find(const void *p);
+};
+
+#endif /* __MLE_ARENA_H_ */
@@ -0,0 +1,157 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleChunkCodec.h
+ * @ingroup MleFoundation
+ *
+ * Magic Lantern Runtime Engine playprint chunk compression API.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+
+#ifndef __MLE_CHUNKCODEC_H_
+#define __MLE_CHUNKCODEC_H_
+
+// Include system header files.
+#include <stddef.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlTypes.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleRuntime.h"
+
+/**
+ * Set in a chunk's length word when its contents are compressed.  The
+ * remaining bits hold the stored length of the contents, as usual.
+ */
+#define MLE_CHUNK_COMPRESSED 0x80000000u
+
+/**
+ * MleChunkCodec compresses and decompresses playprint chunk contents.
+ *
+ * A compressed chunk keeps the tag and length layout of a raw one so
+ * that TOC offsets and the DPP library are unaffected; only its length
+ * word carries MLE_CHUNK_COMPRESSED.  The contents start with the
+ * uncompressed length, as a 32-bit integer in the playprint's byte
+ * order, followed by an LZ4 block.  The loader reads the uncompressed
+ * length first and decodes the block straight into a single buffer
+ * of that size.
+ *
+ * LZ4 decoding is a few byte copies per sequence, fast enough that a
+ * chunk decodes well before the disk could have delivered its raw
+ * form.  The block format is implemented here rather than taken from
+ * liblz4 so that the runtime needs no extra library; playprints written
+ * with liblz4's block compressor decode the same way.
+ *
+ * Only chunks reached through mlGetPlayprintChunk() may be compressed:
+ * group, scene and set chunks.  Media reference chunks and the TOC
+ * are read by the DPP library and must stay raw.
+ */
+class MLE_RUNTIME_API MleChunkCodec
+{
+  public:
+
+    /**
+     * @brief Get the largest compressed form of a chunk.
+     *
+     * @param length The length of the raw contents, in bytes.
+     *
+     * @return The size of buffer compress() needs, preamble included.
+     */
+    static size_t getCompressedBound(size_t length)
+    { return sizeof(unsigned int) + length + length / 255 + 16; }
+
+    /**
+     * @brief Compress chunk contents.
+     *
+     * This is used by playprint writers.  The output is the preamble
+     * and the LZ4 block, ready to follow a length word of
+     * (returned length | MLE_CHUNK_COMPRESSED).
+     *
+     * @param contents The raw chunk contents.
+     * @param length The length of the contents, in bytes.
+     * @param buffer Receives the compressed contents.  It must hold
+     * getCompressedBound(length) bytes.
+     *
+     * @return The length of the compressed contents.  Callers should
+     * store the chunk raw when this is not smaller than length.
+     */
+    static size_t compress(const unsigned char *contents, size_t length,
+                           unsigned char *buffer);
+
+    /**
+     * @brief Get the uncompressed length of compressed contents.
+     *
+     * @param contents The compressed contents.
+     * @param length Their stored length, in bytes.
+     *
+     * @return The uncompressed length, or 0 if the contents are too
+     * short to hold a preamble.
+     */
+    static size_t getUncompressedLength(const unsigned char *contents, size_t length);
+
+    /**
+     * @brief Get the largest uncompressed length compressed contents
+     * can decode to.
+     *
+     * No LZ4 sequence produces more than 255 bytes for each byte it
+     * takes, so a chunk whose preamble records more than this is
+     * damaged and need not be given a buffer.
+     *
+     * @param length The stored length of the contents, in bytes.
+     */
+    static size_t getUncompressedBound(size_t length)
+    { return 255 * length; }
+
+    /**
+     * @brief Decompress chunk contents.
+     *
+     * The block is checked against both buffers, so a damaged chunk
+     * cannot write or read out of bounds.
+     *
+     * @param contents The compressed contents, preamble included.
+     * @param length Their stored length, in bytes.
+     * @param buffer Receives the raw contents.  It must hold
+     * getUncompressedLength() bytes.
+     *
+     * @return TRUE if the block decoded to exactly the recorded length,
+     * FALSE if it is damaged.
+     */
+    static MlBoolean decompress(const unsigned char *contents, size_t length,
+                                unsigned char *buffer);
+};
+
+#endif /* __MLE_CHUNKCODEC_H_ */
@@ -0,0 +1,144 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleChunkMap.h
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __MLE_CHUNKMAP_H_
+#define __MLE_CHUNKMAP_H_
+
+// Include system header files.
+#include <stdio.h>
+#include <stddef.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlTypes.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleRuntime.h"
+
+/**
+ * MleChunkMap maps a playprint file into memory, read only.
+ *
+ * While a playprint is mapped its chunks are read in place: a TOC offset
+ * resolves to a pointer into the mapping, so loading a chunk neither
+ * seeks, reads nor allocates, and titles opening the same playprint
+ * share its pages through the operating system's page cache.  On
+ * platforms without file mapping map() fails and the loaders keep
+ * reading chunks through the file pointer.
+ */
+class MLE_RUNTIME_API MleChunkMap
+{
+  public:
+
+    MleChunkMap(void);
+
+    ~MleChunkMap(void);
+
+    /**
+     * @brief Map the whole of an open file.
+     *
+     * The file position is not changed.
+     *
+     * @return TRUE if the file was mapped, FALSE if mapping is not
+     * supported or failed.
+     */
+    MlBoolean map(FILE *fp);
+
+    /**
+     * @brief Release the mapping, if any.
+     */
+    void unmap(void);
+
+    /**
+     * @brief Determine whether a file is mapped.
+     */
+    MlBoolean isMapped(void) const
+    { return m_base != NULL; }
+
+    /**
+     * @brief Get the size of the mapping, in bytes.
+     */
+    size_t getSize(void) const
+    { return m_size; }
+
+    /**
+     * @brief Resolve a range of the file to its address in the mapping.
+     *
+     * @return A pointer to the first byte of the range, or NULL if the
+     * range is not wholly inside the mapping.  The memory is read only.
+     */
+    unsigned char *getAddress(size_t offset, size_t length) const
+    {
+        if (m_base == NULL || offset > m_size || length > m_size - offset)
+            return NULL;
+        return m_base + offset;
+    }
+
+    /**
+     * @brief Determine whether an address lies inside the mapping.
+     */
+    MlBoolean contains(const void *p) const
+    {
+        return (m_base != NULL) && ((const unsigned char *) p >= m_base) &&
+            ((const unsigned char *) p < m_base + m_size);
+    }
+
+    /**
+     * @brief Hint that a range of the file is about to be read.
+     *
+     * The pages are scheduled to be read ahead where the platform
+     * supports it; otherwise this does nothing.
+     */
+    void prefetch(size_t offset, size_t length) const;
+
+    // Override operator new.
+    void* operator new(size_t tSize);
+
+    // Override operator delete.
+    void  operator delete(void *p);
+
+  private:
+
+    unsigned char *m_base;
+    size_t m_size;
+#if defined(_WINDOWS)
+    void *m_mapping;        // file mapping object handle
+#endif
+};
+
+#endif /* __MLE_CHUNKMAP_H_ */
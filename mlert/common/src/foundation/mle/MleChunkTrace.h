@@ -0,0 +1,155 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleChunkTrace.h
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __MLE_CHUNKTRACE_H_
+#define __MLE_CHUNKTRACE_H_
+
+// Include system header files.
+#include <stdio.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlTypes.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleRuntime.h"
+
+/**
+ * The kinds of record written by the chunk parser.
+ */
+typedef enum
+{
+    MLE_TRACE_OPCODE,     // an opcode was dispatched
+    MLE_TRACE_INDEX,      // an index argument was read
+    MLE_TRACE_DATA        // a block of property data was copied
+} MleChunkTraceKind;
+
+// This is one record of the trace ring.  m_value holds the index for
+//   MLE_TRACE_INDEX records and the byte count for MLE_TRACE_DATA
+//   records; m_offset is the stream position at which the record was
+//   taken, relative to the start of the chunk.
+struct MLE_RUNTIME_API MleChunkTraceRecord
+{
+    unsigned char m_kind;
+    unsigned char m_opcode;
+    int m_value;
+    int m_offset;
+};
+
+/**
+ * MleChunkTrace records what the playprint chunk parser does.
+ *
+ * Tracing is off by default, in which case each trace point in the
+ * parser costs a single test of a static flag.  When enabled, records
+ * are written into a fixed size ring so that a long load keeps only the
+ * most recent activity and never blocks on output.  The ring may be
+ * dumped as readable opcode text whenever it is needed, for example
+ * after an assertion or a failed load.
+ */
+class MLE_RUNTIME_API MleChunkTrace
+{
+  public:
+
+    /**
+     * @brief Start tracing.
+     *
+     * Any previous records are discarded.
+     *
+     * @param capacity The number of records to keep.  It is rounded
+     * up to a power of two.
+     */
+    static void enable(int capacity = 4096);
+
+    /**
+     * @brief Stop tracing and release the ring.
+     */
+    static void disable(void);
+
+    /**
+     * @brief Discard the recorded entries, leaving tracing enabled.
+     */
+    static void clear(void);
+
+    /**
+     * @brief Determine whether tracing is enabled.
+     */
+    static MlBoolean isEnabled(void)
+    { return g_enabled; }
+
+    /**
+     * @brief Append a record, overwriting the oldest if the ring is full.
+     *
+     * Callers normally test isEnabled() first; recording while disabled
+     * is ignored.
+     */
+    static void record(MleChunkTraceKind kind, int opcode, int value, int offset);
+
+    /**
+     * @brief Get the number of records currently held.
+     */
+    static int getNumRecords(void);
+
+    /**
+     * @brief Get a record, where 0 is the oldest one held.
+     */
+    static const MleChunkTraceRecord *getRecord(int i);
+
+    /**
+     * @brief Get the name of a playprint opcode.
+     *
+     * @return The opcode name, or NULL if it is not a known opcode.
+     */
+    static const char *getOpcodeName(int opcode);
+
+    /**
+     * @brief Write the held records as text, oldest first.
+     */
+    static void dump(FILE *fp = stdout);
+
+    // Tested directly by the parser's trace points.
+    static MlBoolean g_enabled;
+
+  private:
+
+    static MleChunkTraceRecord *g_records;
+    static unsigned int g_mask;     // capacity - 1
+    static unsigned int g_count;    // total records written since clear()
+};
+
+#endif /* __MLE_CHUNKTRACE_H_ */
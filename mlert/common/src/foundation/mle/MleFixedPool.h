@@ -0,0 +1,339 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleFixedPool.h
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __MLE_FIXEDPOOL_H_
+#define __MLE_FIXEDPOOL_H_
+
+// Include system header files.
+#include <stddef.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlTypes.h"
+#include "mle/mlMalloc.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleRuntime.h"
+
+// The largest chunk, in items, that a pool grows by unless its
+// initial chunk is already bigger.
+#define MLE_FIXEDPOOL_MAX_CHUNK 4096
+
+// Usage statistics for a fixed-size object pool.
+struct MleFixedPoolStats
+{
+    unsigned int m_live;        // items currently handed out
+    unsigned int m_peak;        // highest value m_live has reached
+    unsigned int m_numChunks;   // chunks currently allocated
+    unsigned int m_numSlots;    // items the allocated chunks can hold
+    size_t m_numBytes;          // bytes held by the allocated chunks
+};
+
+// Header of a block of pool memory; the item slots follow it.
+struct MleFixedPoolChunk
+{
+    MleFixedPoolChunk *m_next;  // next chunk in the pool
+    char *m_slots;              // first item slot
+    unsigned int m_numSlots;    // number of item slots
+    unsigned int m_numFree;     // scratch count used by trim()
+};
+
+/**
+ * @brief MleFixedPool is a template for allocating objects of one type
+ * from chunked free lists.
+ *
+ * Items are carved out of chunks obtained with mlMalloc() and recycled
+ * through an intrusive free list, so get() and put() are a couple of
+ * pointer operations. When the pool runs dry it allocates a new chunk
+ * twice the size of the previous one (up to MLE_FIXEDPOOL_MAX_CHUNK
+ * items), so the number of growth stalls is logarithmic in the peak
+ * population. trim() hands chunks that are entirely free back to the
+ * heap, and getStats() reports live, peak and reserved counts so pool
+ * pressure can be monitored. A pool can be shared among multiple
+ * containers.
+ *
+ * ITEM must be plain data: the pool neither constructs nor destroys
+ * items, and overwrites the first pointer-sized word of an item while
+ * it is free. A pool may be declared, constructed and destroyed where
+ * ITEM is an incomplete type; the other operations need the full type.
+ */
+template <class ITEM> class MleFixedPool
+{
+  public:
+
+    /**
+     * @brief The constructor.
+     *
+     * @param chunkSize The number of items in the first chunk. Later
+     * chunks double in size. No memory is allocated until the first
+     * call to get().
+     */
+    MleFixedPool(int chunkSize = 64)
+      : m_chunks(NULL),
+        m_free(NULL),
+        m_chunkSize(chunkSize > 0 ? chunkSize : 1),
+        m_nextChunkSize(chunkSize > 0 ? chunkSize : 1),
+        m_live(0),
+        m_peak(0)
+    {};
+
+    /**
+     * @brief The destructor releases all chunks.
+     *
+     * Items still handed out become invalid.
+     */
+    ~MleFixedPool(void)
+    { freeChunks(m_chunks); };
+
+    /**
+     * @brief Take an item from the pool.
+     *
+     * @return An uninitialized item.
+     */
+    ITEM *get(void)
+    {
+        if ( m_free == NULL )
+            grow();
+
+        void *rval = m_free;
+        m_free = *(void **)m_free;
+
+        if ( ++m_live > m_peak )
+            m_peak = m_live;
+
+        return (ITEM *)rval;
+    };
+
+    /**
+     * @brief Return an item to the pool.
+     *
+     * @param item An item obtained from get() on this pool.
+     */
+    void put(ITEM *item)
+    {
+        *(void **)item = m_free;
+        m_free = item;
+        m_live--;
+    };
+
+    /**
+     * @brief Release chunks that have no items handed out.
+     *
+     * The cost is proportional to the number of free items times the
+     * number of chunks, so call it at quiet points such as after a
+     * scene is unloaded, not every frame. Once every chunk has been
+     * released, growth restarts from the initial chunk size.
+     *
+     * @return The number of chunks released.
+     */
+    int trim(void)
+    {
+        // Count the free slots in each chunk.
+        MleFixedPoolChunk *chunk;
+        void *slot;
+        for ( chunk = m_chunks; chunk != NULL; chunk = chunk->m_next )
+            chunk->m_numFree = 0;
+        for ( slot = m_free; slot != NULL; slot = *(void **)slot )
+            findChunk(slot)->m_numFree++;
+
+        // Unlink the chunks that are entirely free.
+        int released = 0;
+        MleFixedPoolChunk *empty = NULL;
+        MleFixedPoolChunk **link = &m_chunks;
+        while ( (chunk = *link) != NULL )
+        {
+            if ( chunk->m_numFree == chunk->m_numSlots )
+            {
+                *link = chunk->m_next;
+                chunk->m_next = empty;
+                empty = chunk;
+                released++;
+            }
+            else
+                link = &chunk->m_next;
+        }
+        if ( released == 0 )
+            return(0);
+
+        // Rebuild the free list from the slots of the remaining chunks.
+        void **tail = &m_free;
+        slot = m_free;
+        while ( slot != NULL )
+        {
+            void *next = *(void **)slot;
+            if ( findChunk(slot) != NULL )
+            {
+                *tail = slot;
+                tail = (void **)slot;
+            }
+            slot = next;
+        }
+        *tail = NULL;
+
+        freeChunks(empty);
+        if ( m_chunks == NULL )
+            m_nextChunkSize = m_chunkSize;
+
+        return(released);
+    };
+
+    /**
+     * @brief Get the pool usage statistics.
+     *
+     * @param stats The structure to fill in.
+     */
+    void getStats(MleFixedPoolStats &stats) const
+    {
+        stats.m_live = m_live;
+        stats.m_peak = m_peak;
+        stats.m_numChunks = 0;
+        stats.m_numSlots = 0;
+        stats.m_numBytes = 0;
+        for ( MleFixedPoolChunk *chunk = m_chunks; chunk != NULL; chunk = chunk->m_next )
+        {
+            stats.m_numChunks++;
+            stats.m_numSlots += chunk->m_numSlots;
+            stats.m_numBytes += chunkBytes(chunk->m_numSlots);
+        }
+    };
+
+    /**
+     * @brief Get the number of items currently handed out.
+     */
+    unsigned int getNumLive(void) const
+    { return m_live; }
+
+    /**
+     * Override operator new.
+     *
+     * @param tSize The size, in bytes, to allocate.
+     */
+    void* operator new(size_t tSize)
+    { return mlMalloc(tSize); }
+
+    /**
+     * Override operator delete.
+     *
+     * @param p A pointer to the memory to delete.
+     */
+    void  operator delete(void *p)
+    { mlFree(p); }
+
+  private:
+
+    MleFixedPoolChunk *m_chunks;    // list of allocated chunks
+    void *m_free;                   // free list, linked through the items
+    unsigned int m_chunkSize;       // items in the first chunk
+    unsigned int m_nextChunkSize;   // items in the next chunk to allocate
+    unsigned int m_live;            // items handed out
+    unsigned int m_peak;            // high water mark of m_live
+
+    // The size of an item slot, large enough for the free link and
+    // rounded up to keep items 8-byte aligned.
+    static size_t slotSize(void)
+    {
+        size_t size = (sizeof(ITEM) < sizeof(void *)) ? sizeof(void *) : sizeof(ITEM);
+        return (size + 7) & ~(size_t)7;
+    }
+
+    // The size of a chunk header, rounded up to keep the slots aligned.
+    static size_t headerSize(void)
+    { return (sizeof(MleFixedPoolChunk) + 15) & ~(size_t)15; }
+
+    static size_t chunkBytes(unsigned int numSlots)
+    { return headerSize() + numSlots * slotSize(); }
+
+    // Allocate the next chunk and put its slots on the free list.
+    void grow(void)
+    {
+        unsigned int numSlots = m_nextChunkSize;
+        size_t size = slotSize();
+
+        MleFixedPoolChunk *chunk = (MleFixedPoolChunk *)mlMalloc(chunkBytes(numSlots));
+        chunk->m_slots = (char *)chunk + headerSize();
+        chunk->m_numSlots = numSlots;
+        chunk->m_numFree = 0;
+        chunk->m_next = m_chunks;
+        m_chunks = chunk;
+
+        // Thread the slots in address order so early gets are adjacent.
+        char *slot = chunk->m_slots + (numSlots - 1) * size;
+        *(void **)slot = m_free;
+        while ( slot != chunk->m_slots )
+        {
+            slot -= size;
+            *(void **)slot = slot + size;
+        }
+        m_free = chunk->m_slots;
+
+        // Double the next chunk, up to the maximum.
+        unsigned int limit = (m_chunkSize > MLE_FIXEDPOOL_MAX_CHUNK) ?
+            m_chunkSize : MLE_FIXEDPOOL_MAX_CHUNK;
+        m_nextChunkSize = (numSlots * 2 > limit) ? limit : numSlots * 2;
+    }
+
+    // Find the chunk that holds a slot, or NULL.
+    MleFixedPoolChunk *findChunk(void *slot) const
+    {
+        size_t size = slotSize();
+        for ( MleFixedPoolChunk *chunk = m_chunks; chunk != NULL; chunk = chunk->m_next )
+        {
+            if ( ((char *)slot >= chunk->m_slots) &&
+                 ((char *)slot < chunk->m_slots + chunk->m_numSlots * size) )
+                return chunk;
+        }
+        return NULL;
+    }
+
+    static void freeChunks(MleFixedPoolChunk *chunk)
+    {
+        while ( chunk )
+        {
+            MleFixedPoolChunk *next = chunk->m_next;
+            mlFree(chunk);
+            chunk = next;
+        }
+    }
+
+    // Hide the copy constructor and assignment operator.
+    MleFixedPool(const MleFixedPool &);
+    void operator =(const MleFixedPool &);
+};
+
+#endif /* __MLE_FIXEDPOOL_H_ */
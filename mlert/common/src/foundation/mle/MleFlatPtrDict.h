@@ -0,0 +1,210 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleFlatPtrDict.h
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __MLE_FLATPTRDICT_H_
+#define __MLE_FLATPTRDICT_H_
+
+// Include Runtime Engine header files.
+#include "mle/MleRuntime.h"
+
+// This is the slot type of a flat dictionary.
+//   Its use is internal for the most part, but is made public for
+//   any exceptions.
+struct MLE_RUNTIME_API MleFlatPtrDictEntry
+{
+    void *m_key;
+    void *m_ptr;
+    unsigned int m_dist;    // probe distance plus one; 0 if the slot is empty
+};
+
+/**
+ * This is an open-addressing dictionary class that maps pointers
+ * to pointers.
+ *
+ * MleFlatPtrDict offers the find()/set()/remove() interface of
+ * MlePtrDict, but stores its entries directly in a single slot array
+ * using Robin Hood hashing instead of chaining them from a pool.
+ * No memory is allocated per entry, and the table doubles in size
+ * whenever it becomes 7/8 full, so probe sequences stay short no matter
+ * how many entries are added. Removal uses backward shifting, so no
+ * tombstones accumulate.
+ *
+ * As with MlePtrDict, the key pointer is used numerically as the
+ * input to a hashing function and the match test is pointer equality.
+ * Subclasses can override these protected member functions to do
+ * other mappings.
+ */
+class MLE_RUNTIME_API MleFlatPtrDict
+{
+  public:
+
+    /**
+     * The constructor.
+     *
+     * @param size The number of entries to make room for initially.
+     */
+    MleFlatPtrDict(int size = 16);
+
+    /**
+     * The destructor.
+     */
+    virtual ~MleFlatPtrDict();
+
+    // Dictionary operations.
+    //   find() takes the key and returns the corresponding
+    //   value pointer.  NULL is returned if the key is not
+    //   found (note that this is ambiguous if NULL is a legal
+    //   value).
+    //   set() associates a value with a key.  This adds a
+    //   new dictionary entry if there is no existing one for
+    //   the specified key, and simply changes the value if
+    //   the entries does already exist.
+    //   remove() removes the dictionary entry associated with
+    //   the specified key.
+    void *find(const void *key) const;
+
+    void set(const void *key,const void *value);
+
+    void remove(const void *key);
+
+    /**
+     * @brief Remove all entries, keeping the current capacity.
+     */
+    void clear(void);
+
+    /**
+     * @brief Get the number of entries in the dictionary.
+     */
+    inline int getNumEntries(void) const;
+
+    /**
+     * @brief Get the number of slots in the table.
+     */
+    inline int getCapacity(void) const;
+
+    // Iteration.
+    //   next() returns the index of the first occupied slot after
+    //   the specified one, or -1 if there is none; pass -1 to start.
+    //   getKey() and getValue() return the contents of an occupied
+    //   slot.  The dictionary must not be changed while iterating.
+    int next(int index) const;
+
+    inline void *getKey(int index) const;
+
+    inline void *getValue(int index) const;
+
+    /**
+     * Override operator new.
+     *
+     * @param tSize The size, in bytes, to allocate.
+     */
+    void* operator new(size_t tSize);
+
+    /**
+     * Override operator delete.
+     *
+     * @param p A pointer to the memory to delete.
+     */
+    void  operator delete(void *p);
+
+  protected:
+
+    /** The number of slots; always a power of two. */
+    unsigned int m_capacity;
+    /** The number of occupied slots. */
+    unsigned int m_numEntries;
+    /** The slot array. */
+    MleFlatPtrDictEntry *m_slots;
+
+    // Virtual key functions.
+    //   hash() takes the key and returns a well mixed hash value;
+    //   the table uses its low bits to choose the home slot.
+    //   match() determines the equality of two keys, returning
+    //   nonzero if the keys match.  In the implementation in this
+    //   class this is simply pointer equality.
+    virtual unsigned int hash(const void *key) const;
+    virtual int match(const void *key0,const void *key1) const;
+
+    /**
+     * @brief Resize the slot array and reinsert all entries.
+     *
+     * @param capacity The new number of slots; a power of two.
+     */
+    void rehash(unsigned int capacity);
+
+    /**
+     * @brief Find the slot holding a key.
+     *
+     * @return The slot index, or -1 if the key is not present.
+     */
+    int lookup(const void *key) const;
+
+  private:
+
+    // Hide the copy constructor and assignment operator.
+    MleFlatPtrDict(const MleFlatPtrDict &);
+    void operator =(const MleFlatPtrDict &);
+};
+
+
+// Define inline methods.
+
+inline int MleFlatPtrDict::getNumEntries(void) const
+{
+    return (int)m_numEntries;
+}
+
+inline int MleFlatPtrDict::getCapacity(void) const
+{
+    return (int)m_capacity;
+}
+
+inline void *MleFlatPtrDict::getKey(int index) const
+{
+    return m_slots[index].m_key;
+}
+
+inline void *MleFlatPtrDict::getValue(int index) const
+{
+    return m_slots[index].m_ptr;
+}
+
+
+#endif /* __MLE_FLATPTRDICT_H_ */
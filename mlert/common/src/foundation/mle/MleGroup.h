@@ -43,6 +43,7 @@
 
 // Include Magic Lantern header files.
 #include "mle/MleRuntime.h"
+#include "mle/MleTypeSymbol.h"
 #include "mle/MlePtrContainer.h"
 #include "mle/MleActor.h"
 
@@ -114,6 +115,33 @@ class MLE_RUNTIME_API MleGroup : public MlePtrContainer<MleActor*>
      */
     virtual void init(void);
 
+    /**
+     * @brief Duplicate the group.
+     *
+     * Each actor is copied with MleActor::clone(), taking its current
+     * property values, and given a new role bound to the same set as
+     * its original's.  The new roles are attached to their sets and the
+     * actors and the group are initialized, as when a group is loaded,
+     * but nothing is read from the workprint or playprint and no
+     * property setters are called.  The actors and roles are allocated
+     * together from one MleArena.
+     *
+     * A role the loader attached to another role of the group is
+     * attached to that role's copy; the other roles are attached to
+     * their sets.
+     *
+     * @return The new group, or NULL if one of the actors or roles
+     * cannot be cloned.
+     */
+    MleGroup *clone(void);
+
+    /**
+     * @brief Create an empty group of the same class, for clone().
+     *
+     * MLE_GROUP_HEADER() implements this for each group class.
+     */
+    virtual MleGroup *newInstance(void) const;
+
 	/**
 	 * Override operator new.
 	 *
@@ -136,6 +164,13 @@ class MLE_RUNTIME_API MleGroup : public MlePtrContainer<MleActor*>
     // Predicate returning true if the type of the group is the same as type -- rehearsal time only.
     virtual int isa(const char *type) const;
 
+    // Type symbols -- rehearsal time only.  isa(MleTypeId) is the
+    // constant time form of isa(const char *).
+    static MleTypeId classTypeId(void);
+    virtual MleTypeId getTypeId(void) const;
+    int isa(MleTypeId type) const
+    { return MleTypeSymbol::isa(getTypeId(),type); }
+
     // One time class initialization that sets up the constructor for this class.
     static void initClass(void);
  
@@ -149,6 +184,12 @@ class MLE_RUNTIME_API MleGroup : public MlePtrContainer<MleActor*>
     virtual void registerInstance(const char* name);
     virtual void unregisterInstance();
 
+    // Unregisters every actor in the group in a single pass, so the
+    // tools stop finding them while the group is still alive.  There is
+    // no need to call it before deleting the group; each actor
+    // unregisters itself when it is deleted.
+    void unregisterActors(void);
+
     // Load the group from the relevant item in the DWP.
     // Use different binding types depending on whether the DWP is 
     // a playprint or workprint.  In the workprint, we use the WP struct.
@@ -198,8 +239,10 @@ class MLE_RUNTIME_API MleGroup : public MlePtrContainer<MleActor*>
 // this macro switches subsequent declarations to public.
 #define MLE_GROUP_HEADER(C) \
   public: \
+    virtual MleGroup *newInstance(void) const { return new C; } \
     virtual const char *getTypeName(void) const; \
-    virtual int isa(const char *type) const; \
+    static MleTypeId classTypeId(void); \
+    virtual MleTypeId getTypeId(void) const; \
     static C *cast(MleGroup *group); \
     static void initClass(void)
 
@@ -208,12 +251,13 @@ class MLE_RUNTIME_API MleGroup : public MlePtrContainer<MleActor*>
 // The single argument is the unquoted class name.
 #define MLE_GROUP_SOURCE(C,S) \
     const char *C::getTypeName(void) const { return #C; } \
-    int C::isa(const char *type) const { \
-	if ( !strcmp(type,#C) ) return 1; \
-	else return S::isa(type); \
+    MleTypeId C::classTypeId(void) { \
+        static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+        return type; \
     } \
+    MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
     C *C::cast(MleGroup *group) { \
-	MLE_ASSERT(group->isa(#C)); \
+	MLE_ASSERT(group->isa(C::classTypeId())); \
 	return (C *)group; \
     } \
     MleGroup *_mlCreate##C(void); MleGroup *_mlCreate##C(void) { return new C; }
@@ -251,6 +295,8 @@ class MLE_RUNTIME_API MleGroup : public MlePtrContainer<MleActor*>
 
 // Need a statement so trailing semicolon will work.
 #define MLE_GROUP_HEADER(C) \
+  public: \
+    virtual MleGroup *newInstance(void) const { return new C; } \
 	friend class _mleDummy
 #define MLE_GROUP_SOURCE(C,S) \
 	MleGroup *_mlCreate##C(void) { return new C; }
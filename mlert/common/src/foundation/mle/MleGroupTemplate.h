@@ -0,0 +1,176 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleGroupTemplate.h
+ * @ingroup MleFoundation
+ *
+ * @brief A group chunk decoded for repeated instantiation.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __MLE_GROUPTEMPLATE_H_
+#define __MLE_GROUPTEMPLATE_H_
+
+// Include Magic Lantern header files.
+#include "mle/mlTypes.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleRuntime.h"
+#include "mle/MleTables.h"
+
+// Forward class declarations.
+struct MleLoadContext;
+
+
+/**
+ * The operations of a group template.
+ */
+typedef enum
+{
+    MLE_GROUP_CREATE_ACTOR,         // construct an actor
+    MLE_GROUP_BIND_ROLE,            // load a set and create the actor's role
+    MLE_GROUP_ATTACH_ROLE,          // attach a role to a parent role
+    MLE_GROUP_PROPERTY,             // set a fixed size property
+    MLE_GROUP_DYNAMIC_PROPERTY,     // set a variable size property
+    MLE_GROUP_ARRAY_PROPERTY,       // set an array property
+    MLE_GROUP_MEDIAREF              // set a media reference property
+} MleGroupOperation;
+
+/**
+ * One decoded instruction of a group template.  Which fields are used
+ * depends on m_operation.
+ */
+struct MleGroupInstruction
+{
+    MleGroupOperation m_operation;
+    int m_index;                    // class or set index, parent actor, media ref
+    int m_count;                    // child actor, or number of array elements
+    unsigned int m_value;           // offset of the value in the template
+    unsigned int m_length;          // value length, or array element length
+    MleRTPropertyEntry *m_property;
+    MleActor *(*m_createActor)(void);
+    MleRole *(*m_createRole)(MleActor *a);
+};
+
+
+/**
+ * MleGroupTemplate is a playprint group chunk decoded once, so that the
+ * group can be instantiated many times without interpreting its opcode
+ * stream again.
+ *
+ * Compiling resolves the class and property indices of the chunk against
+ * the runtime tables and copies the property values out of the chunk,
+ * each aligned for its type, so instantiate() only constructs objects
+ * and hands the values to their setters.  mlLoadGroup() keeps the
+ * templates of a playprint's groups, by TOC index, until the playprint
+ * is unloaded.
+ */
+class MLE_RUNTIME_API MleGroupTemplate
+{
+  public:
+
+    /**
+     * @brief Decode a group chunk.
+     *
+     * @param chunk The contents of the chunk.
+     * @param length The length of the chunk, in bytes.
+     *
+     * @return A new template.  It does not refer to the chunk once it
+     * has been compiled.
+     */
+    static MleGroupTemplate *compile(unsigned char *chunk, unsigned int length);
+
+    /**
+     * @brief The destructor.
+     */
+    virtual ~MleGroupTemplate(void);
+
+    /**
+     * @brief Create the group and its actors and roles.
+     *
+     * As with parsing the chunk, the roles are left unattached and the
+     * actors uninitialized.
+     *
+     * @param context Receives the actors, as from parseStream(); the
+     * caller releases it.
+     *
+     * @return The new group, or NULL if it could not be created.
+     */
+    MleGroup *instantiate(MleLoadContext *context) const;
+
+    /**
+     * @brief Get the number of actors in the group.
+     */
+    int getNumActors(void) const
+    { return m_numActors; }
+
+    /**
+     * @brief Get the number of decoded instructions.
+     */
+    int getNumInstructions(void) const
+    { return m_numInstructions; }
+
+    // Override operator new.
+    void* operator new(size_t tSize);
+
+    // Override operator delete.
+    void  operator delete(void *p);
+
+  private:
+
+    MleGroup *(*m_createGroup)(void);
+    int m_numActors;
+
+    MleGroupInstruction *m_instructions;
+    int m_numInstructions;
+    int m_maxInstructions;
+
+    unsigned char *m_values;        // property values, copied from the chunk
+    unsigned int m_valuesSize;
+    unsigned int m_maxValues;
+
+    // Builds templates, from compile().
+    friend class MleGroupCompiler;
+
+    MleGroupTemplate(void);
+
+    // Append an instruction, returning it for the caller to fill in.
+    MleGroupInstruction *addInstruction(MleGroupOperation operation);
+
+    // Copy a value into the template, returning its offset.
+    unsigned int addValue(const unsigned char *value, unsigned int length);
+};
+
+#endif /* __MLE_GROUPTEMPLATE_H_ */
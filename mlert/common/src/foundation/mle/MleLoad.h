@@ -84,6 +84,7 @@ class MleDwpScene;
 #endif /* MLE_DIGITAL_WORKPRINT */
 #ifdef MLE_DIGITAL_PLAYPRINT
 class MleDppInput;
+class MleGroupTemplate;
 #endif /* MLE_DIGITAL_PLAYPRINT */
 
 #ifdef MLE_DIGITAL_WORKPRINT
@@ -227,7 +228,14 @@ extern char *_mlGenRegistryKeyFromMedia(int id);
  *
  * @param A unique identifier specifying the scene to load.
  *
- * @return A pointer to the loaded scene is returned.
+ * The chunks of the scene's groups that have not been loaded before
+ * are decoded on worker threads (see mlSetGroupDecodeThreads()); the
+ * groups are then built and initialized one after another on the
+ * calling thread.
+ *
+ * @return A pointer to the loaded scene is returned, or NULL if its
+ * chunk could not be read.  Groups whose chunks could not be read are
+ * left out of the scene.
  */
 extern MLE_RUNTIME_API MleScene *mlLoadScene(const int id);
 
@@ -248,11 +256,28 @@ extern MLE_RUNTIME_API MleScene *mlLoadBootScene(void);
  *
  * @param A unique identifier specifying the group to load.
  *
- * @return A pointer to the loaded group is returned.
+ * @return A pointer to the loaded group is returned, or NULL if its
+ * chunk could not be read.
  */
 extern MLE_RUNTIME_API MleGroup *mlLoadGroup(const int id);
 
 
+/**
+ * @brief Load a group of actors from a decoded group chunk.
+ *
+ * This is the part of mlLoadGroup(const int) that follows decoding:
+ * the actors and roles are constructed, the roles attached and the
+ * actors and group initialized.  It lets a group be loaded from a
+ * template that did not come from the title's playprint, as the
+ * loader benchmark does.
+ *
+ * @param groupTemplate The decoded group chunk.
+ *
+ * @return A pointer to the loaded group is returned.
+ */
+extern MLE_RUNTIME_API MleGroup *mlLoadGroup(const MleGroupTemplate *groupTemplate);
+
+
 /**
  * @brief Load a media reference.
  *
@@ -269,14 +294,100 @@ extern MLE_RUNTIME_API MleMediaRef *mlLoadMediaRef(const int id, void *userData)
  *
  * @param A unique identifier specifying the set to load.
  *
- * @return A pointer to the loaded set is returned.
+ * @return A pointer to the loaded set is returned, or NULL if its
+ * chunk could not be read.
 */
 extern MLE_RUNTIME_API MleSet *mlLoadSet(const int id);
 
 
+/**
+ * @brief Get the contents of a playprint chunk.
+ *
+ * If the title's playprint is memory mapped the returned pointer is
+ * into the mapping, and is read only; otherwise the chunk is read from
+ * the playprint file into a new buffer.  A chunk stored compressed
+ * (see MleChunkCodec) is decoded into a new buffer.  Either way the
+ * chunk must be given back with mlReleasePlayprintChunk().
+ *
+ * @param indexToPpTOC The index of the chunk in the playprint TOC.
+ * @param length Returns the length of the chunk contents, in bytes,
+ * after any decompression.
+ *
+ * @return A pointer to the chunk contents, or NULL if the chunk is
+ * compressed and does not decode.
+ */
+extern MLE_RUNTIME_API unsigned char *mlGetPlayprintChunk(const int indexToPpTOC, unsigned int *length);
+
+
+/**
+ * @brief Release a chunk obtained from mlGetPlayprintChunk().
+ */
+extern MLE_RUNTIME_API void mlReleasePlayprintChunk(unsigned char *chunk);
+
+
+/**
+ * @brief Hint that a playprint chunk is about to be loaded.
+ *
+ * When the playprint is memory mapped the chunk's pages are read ahead
+ * in the background; otherwise this does nothing.
+ *
+ * @param indexToPpTOC The index of the chunk in the playprint TOC.
+ */
+extern MLE_RUNTIME_API void mlPrefetchPlayprintChunk(const int indexToPpTOC);
+
+
+/**
+ * A function that supplies playprint chunks, as mlGetPlayprintChunk()
+ * does.  The chunks remain owned by the source.
+ */
+typedef unsigned char *(*MlePlayprintChunkSource)(const int indexToPpTOC, unsigned int *length);
+
+
+/**
+ * @brief Read playprint chunks from a source instead of the title's
+ * playprint.
+ *
+ * This lets content be loaded without a mastered playprint, as in tests.
+ * While a source is set, mlReleasePlayprintChunk() and
+ * mlPrefetchPlayprintChunk() do nothing.  The decoded group chunks kept
+ * by mlLoadGroup() are discarded whenever the source changes.
+ *
+ * @param source The chunk source, or NULL to read the title's playprint.
+ */
+extern MLE_RUNTIME_API void mlSetPlayprintChunkSource(MlePlayprintChunkSource source);
+
+
+/**
+ * @brief Discard the decoded group chunks kept by mlLoadGroup().
+ *
+ * mlLoadGroup() decodes each group chunk the first time the group is
+ * loaded, and instantiates later loads from the decoded copy.  The
+ * copies are discarded when the playprint is unloaded; a title that
+ * will not load a playprint's groups again may free them sooner.
+ */
+extern MLE_RUNTIME_API void mlFlushGroupTemplates(void);
+
+
+/**
+ * @brief Set how many threads mlLoadScene() decodes group chunks on.
+ *
+ * Only decoding runs on the workers: the chunks are read, and the actors
+ * and roles constructed and initialized, on the thread that called
+ * mlLoadScene().  Chunk tracing (see MleChunkTrace) turns the workers off.
+ *
+ * @param numThreads The number of threads, the calling one included;
+ * 1 decodes on the calling thread alone and 0, the default, uses one
+ * thread per processor.
+ */
+extern MLE_RUNTIME_API void mlSetGroupDecodeThreads(int numThreads);
+
+
 /**
  * @brief Load a Digital Playprint from the specified file.
  *
+ * Where the platform supports it the playprint is also memory mapped,
+ * so that its chunks are loaded in place.
+ *
  * XXX - This should really be a byte stream.
  *
  * @param filename The name of the Digital Playprint to load.
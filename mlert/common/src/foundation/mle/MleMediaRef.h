@@ -49,6 +49,7 @@
 #include "mle/DwpStrKeyDict.h"
 
 #include "mle/MleRuntime.h"
+#include "mle/MleTypeSymbol.h"
 
 // Include Rehearsal Player/Tools header files.
 #include "mle/MleMediaRefClass.h"
@@ -67,7 +68,8 @@
 #define MLE_MEDIAREF_HEADER(C) \
   public: \
     virtual const char *getTypeName(void) const; \
-    virtual int isa(const char *type) const; \
+    static MleTypeId classTypeId(void); \
+    virtual MleTypeId getTypeId(void) const; \
     static void initClass(void)
 
 // This macro should be placed in the implementation of any subclass of
@@ -76,15 +78,17 @@
 #define MLE_MEDIAREF_SOURCE(C,S) \
     const char *C::getTypeName(void) const { return #C; } \
     MleMediaRef *_mlCreate##C(void); MleMediaRef *_mlCreate##C(void) { return new C; } \
-    int C::isa(const char *type) const { \
-        if ( !strcmp(type,#C) ) return 1; \
-        else return S::isa(type); \
+    MleTypeId C::classTypeId(void) { \
+        static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+        return type; \
     } \
+    MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
     void C::initClass(void) { \
 	static int _mlMediaRefClassInited = 0; \
         if ( _mlMediaRefClassInited ) return ; \
 	_mlMediaRefClassInited = 1; \
 	S::initClass(); \
+	C::classTypeId(); \
 	MleMediaRefClass::add(#C,_mlCreate##C); \
     }
 
@@ -237,6 +241,13 @@ class MLE_RUNTIME_API MleMediaRef
     virtual const char *getTypeName(void) const;
 	// isa() returns nonzero if the instance is of the specified class.
     virtual int isa(const char *type) const;
+	// classTypeId() and getTypeId() return the interned type symbols
+	// of the class and of an instance; isa(MleTypeId) is the
+	// constant time form of isa().
+    static MleTypeId classTypeId(void);
+    virtual MleTypeId getTypeId(void) const;
+    int isa(MleTypeId type) const
+    { return MleTypeSymbol::isa(getTypeId(),type); }
     
     // This is the registry for media refs at rehearsal.  When they
     // are created, they are entered into the registry with a
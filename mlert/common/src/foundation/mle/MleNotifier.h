@@ -43,71 +43,50 @@
 
 // Include Runtime Engine header files.
 #include "mle/MleRuntime.h"
-#include "mle/MlePtrDict.h"
+#include "mle/MleFlatPtrDict.h"
+#include "mle/MleFixedPool.h"
 
 // This is a typedef for the notifier callback function pointer.
 typedef void (*MleNotifierFunc)(const void *key,const void *client);
 
-// This is the struct managed by a notifier.
+// The number of callbacks a key can hold before its list is moved
+// to the heap.
+#define MLE_NOTIFIER_LOCAL_ENTRIES 2
+
+// This is a callback registered with a notifier.
 //   Its use is internal for the most part, but is made public for
 //   any exceptions.
 struct MLE_RUNTIME_API MleNotifierEntry
 {
-    void *m_key;
-    MleNotifierFunc m_func;
+    MleNotifierFunc m_func;     // NULL once removed during notification
     void *m_client;
-    
-    MleNotifierEntry *m_next;
 };
 
-class MLE_RUNTIME_API MleNotifierPool
+// This is the list of callbacks registered for one key.
+//   The entries are kept contiguous and in registration order.
+struct MLE_RUNTIME_API MleNotifierList
 {
-  public:
-
-    /**
-	 * The constructor.
-	 *
-     * @param poolsize The poolsize argument to the constructor determines the
-     * initial number of entries and the number added on every
-     * extension.
-	 */
-    MleNotifierPool(int poolsize);
-
-	/**
-	 * The destructor.
-	 */
-    ~MleNotifierPool();
-
-  	/**
-	 * Override operator new.
-	 *
-	 * @param tSize The size, in bytes, to allocate.
-	 */
-	void* operator new(size_t tSize);
-
-	/**
-	 * Override operator delete.
-	 *
-	 * @param p A pointer to the memory to delete.
-	 */
-    void  operator delete(void *p);
-
-  private:
-
-    friend class MleNotifier;
-    
-    // Pool expansion.
-    void makePool(void);
-    
-    // Allocation and deallocation.
-    MleNotifierEntry *get(void);
-    void put(MleNotifierEntry *);
-    
-    int m_poolsize;				// Allocation block size.
-    MleNotifierEntry *m_unused;	// Pointer to free list.
-    MleNotifierEntry *m_link;	// Pointer to first block.
+    MleNotifierEntry *m_entries;    // m_local or a heap array
+    unsigned int m_numEntries;      // entries in use, including removed ones
+    unsigned int m_maxEntries;      // capacity of m_entries
+    unsigned int m_numRemoved;      // entries removed during notification
+    unsigned int m_busy;            // nesting depth of notify() on this key
+    MleNotifierEntry m_local[MLE_NOTIFIER_LOCAL_ENTRIES];
 };
 
+// This is the allocation pool for notifier lists.
+//   A pool can be shared among multiple notifiers.
+typedef MleFixedPool<MleNotifierList> MleNotifierPool;
+
+/**
+ * MleNotifier calls back registered functions when a key is notified.
+ *
+ * Each key maps to a contiguous list of (function, client) pairs, so
+ * notification is a linear loop over that list. Callbacks are invoked
+ * in the order they were added. A callback may add or remove callbacks,
+ * including for the key being notified; callbacks added during a
+ * notification are not called until the next one.
+ */
 class MLE_RUNTIME_API MleNotifier
 {
   public:
@@ -131,6 +110,16 @@ class MLE_RUNTIME_API MleNotifier
     
     // callback invocation.
     void notify(const void *key) const;
+
+    /**
+     * @brief Notify a batch of keys.
+     *
+     * This is equivalent to calling notify() on each key in turn.
+     *
+     * @param keys The keys to notify.
+     * @param numKeys The number of keys.
+     */
+    void notify(const void **keys,int numKeys) const;
     
     MleNotifierPool *getPool(void) const { return m_pool; }
 
@@ -150,20 +139,24 @@ class MLE_RUNTIME_API MleNotifier
 
   protected:
 
-	/** The number of hash table entries. */
-    int m_nbuckets;
-	/** A pointer to the hash table. */
-    MleNotifierEntry **m_bucket;
-    
-    /**
-	 * Hash function.
-	 *
-	 * @param key The key for the hash.
-	 */
-    unsigned int hash(const void *key) const;
+	/** The map from key to callback list. */
+    MleFlatPtrDict *m_lists;
 
 	/** A pointer to the allocation pool. */
 	MleNotifierPool *m_pool;
+
+  private:
+
+    // Append a callback to a list, growing it if necessary.
+    static void append(MleNotifierList *list,
+		MleNotifierFunc func,const void *client);
+
+    // Drop the entries removed during notification, and the whole
+    // list if none are left.
+    void compact(const void *key,MleNotifierList *list) const;
+
+    // Return a list to the pool.
+    void release(const void *key,MleNotifierList *list) const;
 };
 
 #endif /* __MLE_NOTIFIER_H_ */
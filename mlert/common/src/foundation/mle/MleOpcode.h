@@ -34,7 +34,7 @@
 /**
  * @brief An enumeration for the Digital Playprint operational codes.
  */
-enum _MleDppOpcodes {
+typedef enum _MleDppOpcodes {
     beginActorSetOpcode = 0x80,   /**< Begin an Actor Set. */
     createActorOpcode,            /**< Create an Actor. */
     setSetOpcode,                 /**< Set the Set as current. */
@@ -0,0 +1,286 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MlePairingPq.h
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __MLE_PAIRINGPQ_H_
+#define __MLE_PAIRINGPQ_H_
+
+// Include Magic Lantern header files.
+#include "mle/mlTypes.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleRuntime.h"
+#include "mle/MlePq.h"
+#include "mle/MleFixedPool.h"
+
+// Node of a pairing heap.
+struct MlePairingPQNode;
+
+// A handle to an item in a pairing heap; NULL is never a valid handle.
+typedef MlePairingPQNode *MlePairingPQHandle;
+
+/**
+ * This is the allocation pool for MlePairingPQNode objects.
+ *
+ * A pool can be shared among multiple queues; queues sharing a pool
+ * can be joined in constant time.
+ */
+typedef MleFixedPool<MlePairingPQNode> MlePairingPQPool;
+
+/**
+ * MlePairingPQ is a mergeable priority queue.
+ *
+ * MlePairingPQ offers the same operations as MlePQ, built on a
+ * pairing heap of pooled nodes instead of an array heap. Insertion,
+ * increasing the priority of an item and joining two queues take
+ * constant time; removing the highest priority item, deleting an
+ * arbitrary item and decreasing a priority take amortized O(log n)
+ * time. Items are referenced by handles, which remain valid until the
+ * item leaves the queue.
+ *
+ * The two queues are used the same way. Where MlePQ takes the
+ * position of an item, MlePairingPQ takes its handle, and findHandle()
+ * maps a handle from insertWithHandle() to what peek(), changeItem()
+ * and destroyItem() take on either queue.
+ *
+ * Use MlePairingPQ instead of MlePQ when queues are frequently merged,
+ * for example when per-scene timer queues are folded into a global one.
+ */
+class MLE_RUNTIME_API MlePairingPQ
+{
+  // Declare member variables.
+
+  private:
+
+    MlePairingPQNode *m_root;    // highest priority node
+    unsigned int m_numItems;     // number of items in queue
+    MlePairingPQPool *m_pool;    // node allocation pool
+    MlBoolean m_ownPool;         // TRUE if the pool was created here
+
+  // Declare member functions.
+
+  public:
+
+    /**
+     * Constructor that creates a private pool.
+     *
+     * @param poolsize The number of nodes in each pool block.
+     */
+    MlePairingPQ(int poolsize = MLE_INC_QSIZE);
+
+    /**
+     * Constructor that uses an existing pool.
+     *
+     * @param pool The pool to allocate nodes from.
+     */
+    MlePairingPQ(MlePairingPQPool *pool);
+
+    /**
+     * The destructor.
+     */
+    virtual ~MlePairingPQ(void);
+
+    /**
+     * @brief Insert a new item.
+     *
+     * @param item The item to insert into the queue.
+     */
+    virtual void insert(MlePQItem &item);
+
+    /**
+     * @brief Insert a new item and return a handle to it.
+     *
+     * @param item The item to insert into the queue.
+     *
+     * @return A handle to the inserted item.
+     */
+    virtual MlePairingPQHandle insertWithHandle(MlePQItem &item);
+
+    /**
+     * @brief Remove the highest priority item.
+     *
+     * If the action is successful,
+     * "item" will contain the data referenced by the removed entry.
+     *
+     * @param item The item to remove from the queue.
+     *
+     * @return If the item is successfully removed, then TRUE will be
+     * returned. Otherwise, FALSE will be returned.
+     */
+    virtual MlBoolean remove(MlePQItem &item);
+
+    /**
+     * @brief Delete the highest priority item.
+     */
+    virtual void destroy(void);
+
+    /**
+     * @brief Delete an arbitrary item.
+     *
+     * @param handle The handle of the item to delete.
+     */
+    virtual void destroyItem(MlePairingPQHandle handle);
+
+    /**
+     * @brief Change the priority of an item.
+     *
+     * @param handle The handle of the item to change.
+     * @param priority The new priority.
+     *
+     * @return TRUE if the priority was changed.
+     */
+    virtual MlBoolean changeItem(MlePairingPQHandle handle,int priority);
+
+    /**
+     * @brief Peek at the highest priority item.
+     *
+     * @return FALSE if the queue is empty.
+     */
+    virtual MlBoolean peek(MlePQItem &item);
+
+    /**
+     * @brief Peek at the item referenced by a handle.
+     *
+     * @return FALSE if the handle is NULL.
+     */
+    virtual MlBoolean peek(MlePairingPQHandle handle,MlePQItem &item);
+
+    /**
+     * @brief Find the item referenced by a handle.
+     *
+     * A handle is already the position of its item, so this returns
+     * it unchanged; it exists so that code written for MlePQ works.
+     *
+     * @param handle A handle returned by insertWithHandle().
+     */
+    inline MlePairingPQHandle findHandle(MlePairingPQHandle handle);
+
+    /**
+     * @brief Find the first item accepted by a callback.
+     *
+     * @return The handle of the item, or NULL if there is no match.
+     */
+    virtual MlePairingPQHandle findItem(MlePQCallback func,void *clientData);
+
+    /**
+     * @brief Clear the queue.
+     */
+    virtual void clear(void);
+
+    /**
+     * @brief Join another queue into this one.
+     *
+     * All items are moved out of "queue", leaving it empty. If both
+     * queues allocate from the same pool, this takes constant time and
+     * handles into "queue" remain valid; otherwise the items are copied
+     * and their old handles become invalid.
+     *
+     * @param queue The queue to join into this one.
+     */
+    virtual void join(MlePairingPQ &queue);
+
+    /**
+     * @brief Get the number of items in the queue.
+     */
+    inline unsigned int getNumItems(void);
+
+    /**
+     * @brief Get the pool this queue allocates from.
+     */
+    inline MlePairingPQPool *getPool(void);
+
+    /**
+     * Override operator new.
+     *
+     * @param tSize The size, in bytes, to allocate.
+     */
+    void* operator new(size_t tSize);
+
+    /**
+     * Override operator delete.
+     *
+     * @param p A pointer to the memory to delete.
+     */
+    void  operator delete(void *p);
+
+  protected:
+
+    /**
+     * @brief Merge two heaps, returning the new root.
+     */
+    static MlePairingPQNode *meld(MlePairingPQNode *a,MlePairingPQNode *b);
+
+    /**
+     * @brief Merge a list of sibling heaps using the two-pass
+     * pairing rule, returning the new root.
+     */
+    static MlePairingPQNode *combineSiblings(MlePairingPQNode *first);
+
+    /**
+     * @brief Cut a non-root node, with its subtree, out of the heap.
+     */
+    static void detach(MlePairingPQNode *node);
+
+  private:
+
+    // Hide the copy constructor and assignment operator.
+    MlePairingPQ(const MlePairingPQ &);
+    void operator =(const MlePairingPQ &);
+};
+
+
+// Define inline methods.
+
+inline unsigned int MlePairingPQ::getNumItems(void)
+{
+    return(m_numItems);
+}
+
+inline MlePairingPQHandle MlePairingPQ::findHandle(MlePairingPQHandle handle)
+{
+    return(handle);
+}
+
+inline MlePairingPQPool *MlePairingPQ::getPool(void)
+{
+    return(m_pool);
+}
+
+
+#endif /* __MLE_PAIRINGPQ_H_ */
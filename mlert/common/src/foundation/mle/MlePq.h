@@ -62,9 +62,36 @@ typedef struct MLE_RUNTIME_API mlePQItem
 
 typedef MlBoolean (*MlePQCallback)(MlePQItem &item,void *clientData);
 
+// A handle to an item in an indexed queue.
+//   The low MLE_PQ_INDEX_BITS bits hold the index of the item's handle
+//   table entry and the remaining bits the generation of the entry when
+//   the item was inserted.  0 is never a valid handle.
+typedef unsigned int MlePQHandle;
+
+#define MLE_PQ_INDEX_BITS  20
+#define MLE_PQ_INDEX_MASK  ((1U << MLE_PQ_INDEX_BITS) - 1)
+#define MLE_PQ_MAX_GENERATION  (0xFFFFFFFFU >> MLE_PQ_INDEX_BITS)
+
+// Handle table entry for an indexed queue.
+struct MlePQIndexEntry;
+
 
 /**
  * MlePQ is a priority queue.
+ *
+ * An indexed queue additionally keeps a handle table tracking the
+ * heap position of every item, along with hash chains over item
+ * priorities and data. This makes item lookup by handle O(1), lookup
+ * by priority or item O(1) expected, and bulk removal by priority
+ * proportional to the number of items removed. The index costs
+ * some extra bookkeeping on every heap operation, so it is only
+ * maintained when requested at construction.
+ *
+ * Handle table entries are reused once their items leave the queue, so
+ * each entry counts the items it has held.  A handle records the count
+ * when its item was inserted, and findHandle() does not mistake a later
+ * item for it until the entry has been reused MLE_PQ_MAX_GENERATION
+ * times.  An indexed queue holds at most MLE_PQ_INDEX_MASK - 1 items.
  */
 class MLE_RUNTIME_API MlePQ
 {
@@ -76,6 +103,15 @@ class MLE_RUNTIME_API MlePQ
     unsigned int m_fpqSize;      // size of queue
     unsigned int m_fpqNumItems;  // number of items in queue
 
+    MlBoolean m_fpqIndexed;         // TRUE if the index is maintained
+    unsigned int *m_fpqHandles;     // handle of the item at each queue slot
+    MlePQIndexEntry *m_fpqIndex;    // handle table; entry 0 is unused
+    unsigned int m_fpqFreeHandle;   // head of the free handle list
+    unsigned int *m_fpqKeyBucket;   // hash chains over item priorities
+    unsigned int *m_fpqDataBucket;  // hash chains over item data
+    unsigned int m_fpqNumBuckets;   // number of hash chains (power of 2)
+    unsigned int m_fpqIndexSize;    // number of handle table entries
+
   // Declare member functions.
 
   public:
@@ -93,6 +129,27 @@ class MLE_RUNTIME_API MlePQ
      */
     MlePQ(unsigned int size);
 
+    /**
+     * Constructor that takes an initial size and selects whether
+     * the queue is indexed.
+     *
+     * @param size The initial size to set the queue to.
+     * @param indexed TRUE if the queue should maintain a handle index.
+     */
+    MlePQ(unsigned int size, MlBoolean indexed);
+
+    /**
+     * Constructor that bulk-loads an array of items.
+     *
+     * The queue is built bottom-up in O(n) time, which is considerably
+     * faster than inserting the items one at a time.
+     *
+     * @param items The items to load; the array is copied.
+     * @param numItems The number of items in the array.
+     * @param indexed TRUE if the queue should maintain a handle index.
+     */
+    MlePQ(const MlePQItem *items, unsigned int numItems, MlBoolean indexed = FALSE);
+
     /**
      * The destructor.
      */
@@ -109,6 +166,41 @@ class MLE_RUNTIME_API MlePQ
      */
     virtual void insert(MlePQItem &item);
 
+    /**
+     * @brief Insert a new item and return a handle to it.
+     *
+     * The handle remains valid until the item leaves the queue,
+     * independent of where the item moves within the heap.
+     *
+     * @param item The item to insert into the queue.
+     *
+     * @return A handle to the inserted item, or 0 if the queue
+     * is not indexed.
+     */
+    virtual MlePQHandle insertWithHandle(MlePQItem &item);
+
+    /**
+     * @brief Insert an array of items.
+     *
+     * The queue is grown at most once. When the number of new items is
+     * comparable to the number already queued, the heap is rebuilt
+     * bottom-up in O(n) time instead of sifting each item into place.
+     *
+     * @param items The items to insert; the array is copied.
+     * @param numItems The number of items in the array.
+     */
+    virtual void insertBulk(const MlePQItem *items, unsigned int numItems);
+
+    /**
+     * @brief Make room for at least the specified number of items.
+     *
+     * @param size The number of items the queue should hold without
+     * growing again.
+     *
+     * @return TRUE if the queue has the requested capacity.
+     */
+    MlBoolean reserve(unsigned int size);
+
     /**
      * @brief Remove the highest priority item.
      *
@@ -214,6 +306,30 @@ class MLE_RUNTIME_API MlePQ
 
     virtual unsigned int findItem(MlePQCallback func,void *clientData);
 
+    /**
+     * @brief Find the item referenced by a handle.
+     *
+     * @param handle A handle returned by insertWithHandle().
+     *
+     * @return The position of the item in the queue, or 0 if the
+     * handle does not reference an item, as when its item has left
+     * the queue.
+     */
+    unsigned int findHandle(MlePQHandle handle);
+
+    /**
+     * @brief Get the handle of the item at the specified position.
+     *
+     * @return The handle, or 0 if the queue is not indexed or the
+     * position is out of range.
+     */
+    MlePQHandle getHandle(unsigned int k);
+
+    /**
+     * @brief Determine whether the queue maintains a handle index.
+     */
+    inline MlBoolean isIndexed(void);
+
     /**
      * @brief Delete an arbitrary item.
      */
@@ -221,9 +337,19 @@ class MLE_RUNTIME_API MlePQ
 
     /**
      * @brief  Change the priority of an item.
+     *
+     * The item is moved up or down the heap in place, so this
+     * runs in O(log n) time.
      */
     virtual MlBoolean changeItem(unsigned int k,int priority);
 
+    /**
+     * @brief Peek at the highest priority item.
+     *
+     * @return FALSE if the queue is empty.
+     */
+    virtual MlBoolean peek(MlePQItem &item);
+
     /**
      * @brief Peek into queue for specified item.
      */
@@ -244,7 +370,8 @@ class MLE_RUNTIME_API MlePQ
      *
      * The resulting queue will be sorted from
      * lowest to highest priority (queue[0] = lowest priority item and
-     * queue[numItems] = highest priority item).
+     * queue[numItems] = highest priority item). The array is heap
+     * sorted in place, without allocating memory.
      */
     static void sort(MlePQItem *queue,int numItems);
 
@@ -271,6 +398,9 @@ class MLE_RUNTIME_API MlePQ
 
     /**
      * @brief Extend the queue.
+     *
+     * The default extension doubles the size of the queue, so a queue
+     * filled one item at a time is copied O(log n) times.
      */
     MlBoolean grow(void);
     MlBoolean grow(unsigned int size);
@@ -287,10 +417,34 @@ class MLE_RUNTIME_API MlePQ
      */
     void downHeap(unsigned int k);
 
+    /**
+     * @brief Restore the heap condition over the whole queue,
+     * bottom-up in O(n) time.
+     */
+    void heapify(void);
+
   private:
 
     MlBoolean _grow(unsigned int size);  // Grow queue by specified size.
 
+    // Index management; these are only called on indexed queues.
+    MlBoolean growIndex(void);
+    void resetIndex(void);
+    void linkHandle(unsigned int handle);
+    void unlinkHandle(unsigned int handle);
+    unsigned int allocHandle(void);
+    void freeHandle(unsigned int handle);
+    void bumpGeneration(unsigned int handle);
+
+    // Store an item (and its handle, if indexed) in a queue slot.
+    void setSlot(unsigned int k,const MlePQItem &item,unsigned int handle);
+
+    // Append items to the queue without restoring the heap condition.
+    void append(const MlePQItem *items,unsigned int numItems);
+
+    // Remove all items with matching priority in a single pass.
+    unsigned int removeMatching(int priority,MlePQItem *found);
+
 };
 
 
@@ -307,7 +461,7 @@ class MLE_RUNTIME_API MlePQ
 #endif /* __linux__ */
 #define MLE_MAX_QPRIORITY MAXINT         // maximum priority
 #define MLE_MIN_QPRIORITY ~MAXINT        // minimum priority
-#define MLE_INC_QSIZE     64             // defualt size queue grows by
+#define MLE_INC_QSIZE     64             // minimum size queue grows by
 
 
 // Define inline methods.
@@ -317,5 +471,10 @@ inline unsigned int MlePQ::getNumItems(void)
     return(m_fpqNumItems);
 }
 
+inline MlBoolean MlePQ::isIndexed(void)
+{
+    return(m_fpqIndexed);
+}
+
 
 #endif /* __MLE_PQ_H_ */
@@ -41,12 +41,47 @@
 #ifndef __MLE_PROPERTY_H_
 #define __MLE_PROPERTY_H_
 
+// Include system header files.
+#include <stddef.h>
+#include <type_traits>
+
+// Include Magic Lantern header files.
+#include "mle/mlTypes.h"
+
 // Include Magic Lantern Runtime Engine header files.
+#include "mle/MleRuntime.h"
 #include "mle/MleObject.h"
 
 
-#define MLE_PROPERTY_ENTRY(C,NAME) \
-    #NAME, C::getProperty, C::setProperty
+// Property descriptor flag: the property holds plain data and may be
+// copied with memcpy().  Dynamic and array properties own heap memory
+// and never carry this flag.
+#define MLE_PROPERTY_TRIVIAL 0x1
+
+// Declare the descriptor traits of a property; used by the
+// MLE_ACTOR_*, MLE_SET_* and MLE_STAGE_* property macros.
+#define MLE_PROPERTY_TRAITS(TYPE,NAME,FLAGS)                   \
+    static const char *NAME##PropertyType(void) {return #TYPE;} \
+    static unsigned int NAME##PropertyFlags(void) {return FLAGS;}
+
+// Declare the descriptor traits of a property held by value.
+#define MLE_PROPERTY_VALUE_TRAITS(TYPE,NAME)                  \
+    MLE_PROPERTY_TRAITS(TYPE,NAME,                            \
+        (std::is_trivially_copyable<TYPE>::value ? MLE_PROPERTY_TRIVIAL : 0))
+
+// Byte offset of property NAME of class C from the MleObject base.
+// A non-null dummy address is used so the base conversion is applied.
+#define MLE_PROPERTY_OFFSET(C,NAME)                           \
+    ((size_t)((char *)&((C *)0x1000)->NAME -                  \
+        (char *)(MleObject *)(C *)0x1000))
+
+#define MLE_PROPERTY_ENTRY(C,NAME)                            \
+    #NAME, C::getProperty, C::setProperty,                    \
+    mlPropertyHash(#NAME), C::NAME##PropertyType(),           \
+    MLE_PROPERTY_OFFSET(C,NAME), sizeof(((C *)0)->NAME),      \
+    C::NAME##PropertyFlags(),                                 \
+    [](MleObject *object, unsigned char *value, int count)    \
+        { ((C *)object)->NAME##AdoptProperty(value, count); }
 
 
 typedef void (*MlePropertyGetter)(MleObject *object, const char *name, unsigned char **value);
@@ -58,14 +93,112 @@ typedef void (*MlePropertySetter)(MleObject *object, const char *name, unsigned
 // Runtime Actor/Set Property Table Entry.
 typedef struct _MlePropertyEntry
 {
-    //unsigned int offset;                    /* offset */
     /** The name of the property. */
     const char *name;
     /** Get property callback function. */
     void (*getProperty)(MleObject *object, const char *name, unsigned char **value);
     /** Set property callback function. */
     void (*setProperty)(MleObject *object, const char *name, unsigned char *value);
+    /** The hash of the name, from mlPropertyHash(). */
+    unsigned int nameHash;
+    /** The declared type of the property, or NULL if unknown. */
+    const char *type;
+    /** The byte offset of the property from the MleObject base. */
+    size_t offset;
+    /** The size of the property, in bytes; 0 if unknown. */
+    size_t size;
+    /** Descriptor flags, such as MLE_PROPERTY_TRIVIAL. */
+    unsigned int flags;
+    /**
+     * Adopt property callback function, or NULL.  A dynamic property
+     * takes ownership of the mlMalloc()ed buffer value, of count bytes;
+     * an array property is loaded from the count elements stored at
+     * value; any other property is set from the value that value
+     * points to.
+     */
+    void (*adoptProperty)(MleObject *object, unsigned char *value, int count);
 } MlePropertyEntry;
 
 
+/**
+ * Hash a property name (FNV-1a).  This is a constant expression when
+ * name is a string literal.
+ */
+constexpr unsigned int mlPropertyHash(const char *name, unsigned int h = 2166136261u)
+{
+    return *name ? mlPropertyHash(name + 1, (h ^ (unsigned char)*name) * 16777619u) : h;
+}
+
+/**
+ * Exchange two property values by assignment.  The adopting array
+ * setters use this, so an MleArray's storage is only ever released
+ * by MleArray itself.
+ */
+template <class T> inline void mlSwapProperty(T &a, T &b)
+{
+    T t;
+    t = a;
+    a = b;
+    b = t;
+}
+
+/**
+ * Get the address of a property within an object.
+ */
+inline void *mlPropertyAddress(MleObject *object, const MlePropertyEntry *entry)
+{
+    return (char *)object + entry->offset;
+}
+
+/**
+ * Find a property in a table by name, comparing hashes first.
+ *
+ * @return The entry, or NULL if there is none.
+ */
+extern MLE_RUNTIME_API const MlePropertyEntry *mlFindProperty(
+    const MlePropertyEntry *entries, int numEntries, const char *name);
+
+/**
+ * Copy the trivial properties of a table from one object to another
+ * of the same class with memcpy().
+ *
+ * The copy bypasses the setters, so no dirty bits are set; a caller
+ * copying into an actor marks it with MleActor::markDirty().
+ *
+ * @return The number of properties copied.
+ */
+extern MLE_RUNTIME_API int mlCopyProperties(MleObject *dst, const MleObject *src,
+    const MlePropertyEntry *entries, int numEntries);
+
+/**
+ * Gather one trivial property from each of a population of objects
+ * into a packed array, numObjects * entry->size bytes long.
+ */
+extern MLE_RUNTIME_API void mlSnapshotProperty(const MlePropertyEntry *entry,
+    MleObject *const *objects, int numObjects, void *buffer);
+
+/**
+ * Scatter a packed array made by mlSnapshotProperty() back into
+ * the objects.
+ *
+ * Like mlCopyProperties(), this bypasses the setters and sets no dirty
+ * bits.  A caller restoring actors marks them with MleActor::markDirty(),
+ * and may use mlDiffProperty() first to find the ones that change.
+ */
+extern MLE_RUNTIME_API void mlRestoreProperty(const MlePropertyEntry *entry,
+    MleObject *const *objects, int numObjects, const void *buffer);
+
+/**
+ * Compare the objects against a packed array made by
+ * mlSnapshotProperty().
+ *
+ * @param changed If not NULL, receives the indices of the objects
+ * whose property differs from the snapshot.
+ *
+ * @return The number of objects that differ.
+ */
+extern MLE_RUNTIME_API int mlDiffProperty(const MlePropertyEntry *entry,
+    MleObject *const *objects, int numObjects, const void *buffer, int *changed);
+
+
 #endif /* __MLE_PROPERTY_H_ */
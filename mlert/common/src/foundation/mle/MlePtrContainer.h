@@ -46,12 +46,8 @@
 #endif /* NULL */
 
 #include "mle/MleRuntime.h"
-
-// Define the TEMPLATE macro so that MlePtrArray exposes its template 
-// parent class.
-
-#define TEMPLATE
-#include "mle/MlePtrArray.h"
+#include "mle/MleSlotMap.h"
+#include "mle/MleFlatPtrDict.h"
 
 #ifdef MLE_DIGITAL_WORKPRINT
 #if defined(__linux__) || defined(__APPLE__)
@@ -64,17 +60,18 @@
  * @brief MlePtrContainer is a template container class that serves as the
  * base class for scenes and groups.
  *
- * This container holds an array of pointers to objects of generic type.
- * The intended use of this template is to create a subclass container with
- * a specified item type.  This template provides inline wrappers for the
- * void* pointer manipulations of the MlePtrArray, so that you can localize
- * the type-specific API in one place, yet still reuse MlePtrArray.
+ * This container holds pointers to objects of generic type in a slot
+ * map, so adding and removing items take constant time no matter how
+ * large the container is. Items can be iterated densely with
+ * getSize() and operator[], but removal moves the last item into the
+ * hole, so positions are not stable across removals. Use the handle
+ * returned by add() to refer to an item durably; get() returns NULL
+ * once that item has been removed. Each item may be added only once.
  *
  * Note that this container holds item pointers of type ITEM, such as 
  * MleActor* and MleGroup*.
  */
-//template <class ITEM> class MLE_RUNTIME_API MlePtrContainer : public MleTPtrArray<ITEM>
-template <class ITEM> class MlePtrContainer : public MleTPtrArray<ITEM>
+template <class ITEM> class MlePtrContainer : public MleTSlotMap<ITEM>
 {
   // Declare member functions.
 
@@ -83,7 +80,7 @@ template <class ITEM> class MlePtrContainer : public MleTPtrArray<ITEM>
     /**
      * @brief Constructor of default array size eight (8).
      */
-    MlePtrContainer( void ) : MleTPtrArray<ITEM>(8)
+    MlePtrContainer( void ) : MleTSlotMap<ITEM>(8), m_handles(8)
     {};
 
 
@@ -92,7 +89,7 @@ template <class ITEM> class MlePtrContainer : public MleTPtrArray<ITEM>
      *
      * @param initSize The initial size of the array.
      */
-    MlePtrContainer(int initSize) : MleTPtrArray<ITEM>(initSize)
+    MlePtrContainer(int initSize) : MleTSlotMap<ITEM>(initSize), m_handles(initSize)
     {};
 
 
@@ -101,48 +98,74 @@ template <class ITEM> class MlePtrContainer : public MleTPtrArray<ITEM>
      */
     virtual ~MlePtrContainer( void )
     {};
-  
 
-    // ------------------------------------------------------------------
-    // Override the void*-based methods from MlePtrArray with
-    // methods that use our template type.
-    //
-    //  ITEM& operator[](int index) { return (ITEM)array[index]; }
-    //  void add(ITEM ptr) { ((MlePtrArray*)this)->add((void*)ptr); }
-    //  void remove(ITEM ptr) { ((MlePtrArray*)this)->remove((void*)ptr); }
-    // ------------------------------------------------------------------
+
+    /**
+     * @brief Add an item.
+     *
+     * @param ptr The item to add.
+     *
+     * @return A handle to the item.
+     */
+    MleSlotHandle add(ITEM ptr)
+    {
+        MleSlotHandle handle = MleTSlotMap<ITEM>::add(ptr);
+        m_handles.set((void *)ptr, (void *)(size_t)handle);
+        return handle;
+    }
+
+
+    /**
+     * @brief Remove an item by pointer value.
+     *
+     * @param ptr The item to remove.
+     */
+    void remove(ITEM ptr)
+    {
+        MleSlotHandle handle = getHandle(ptr);
+        if ( handle != MLE_SLOTMAP_INVALID_HANDLE ) {
+            m_handles.remove((void *)ptr);
+            MleSlotMap::remove(handle);
+        }
+    }
 
 
     /**
-     * @brief Clear the specified element from the array.
+     * @brief Remove an item by handle.
      *
-     * This function removes an element from the array without compressing
-     * out the empty location.  See remove().  We must provide clear() so
-     * that the dictionary lookup in find() continues to work after a pointer
-     * is dropped from the initial list.
+     * @param handle The handle returned when the item was added.
      *
-     * @param index The element to clear.
+     * @return TRUE if the item was removed, FALSE if the handle was stale.
+     */
+    MlBoolean remove(MleSlotHandle handle)
+    {
+        ITEM ptr = MleTSlotMap<ITEM>::get(handle);
+        if ( ptr == NULL )
+            return FALSE;
+        m_handles.remove((void *)ptr);
+        return MleSlotMap::remove(handle);
+    }
+
+
+    /**
+     * @brief Clear the specified element from the container.
+     *
+     * Lookups by name or load order remain valid for the other
+     * elements.
+     *
+     * @param index The position of the element to clear.
      */
     void clear( const int index )
-    { MlePtrArray::m_array[index] = NULL; }
+    { remove((*this)[index]); }
 
 
     /**
      * @brief Clear by pointer value.
      *
-     * Search through the array and clear the pointer if found.
-     *
      * @param ptr The pointer to clear.
      */
     void clear(ITEM ptr)
-    {
-        for ( int i = 0; i < MlePtrArray::m_n; i++ ) {
-            if ( MlePtrArray::m_array[i] == ptr ) {
-                clear(i);
-                return;
-            }
-        }
-    }
+    { remove(ptr); }
 
 
     /**
@@ -159,17 +182,25 @@ template <class ITEM> class MlePtrContainer : public MleTPtrArray<ITEM>
      *
      * @param pointer Given the pointer, find its index in the container.
      *
-     * @return The index of the element is returned.
+     * @return The current position of the element is returned, or -1
+     * if the element is not in the container.
      */
     int find( const ITEM ptr )
-    { 
-        for ( int i = 0; i < MlePtrArray::getSize(); i++ ) {
-            if ( MlePtrArray::m_array[i] == ptr ) {
-                return i;
-            }
-        }
-        return -1;
-    }
+    { return MleSlotMap::getIndex(getHandle(ptr)); }
+
+
+    /**
+     * @brief Get the handle of an element.
+     *
+     * @param ptr The element.
+     *
+     * @return The handle, or MLE_SLOTMAP_INVALID_HANDLE if the element
+     * is not in the container.
+     */
+    MleSlotHandle getHandle( const ITEM ptr ) const
+    { return (MleSlotHandle)(size_t)m_handles.find((void *)ptr); }
+
+    using MleSlotMap::getHandle;
 
 #ifdef MLE_DIGITAL_WORKPRINT
 
@@ -208,15 +239,12 @@ template <class ITEM> class MlePtrContainer : public MleTPtrArray<ITEM>
     // Note that these lookups are only valid until the group is removed,
     // but are never valid for groups that the programmer adds to the scene.
     ITEM find( const char *id )
-    { 
-        long index = -1 + (long) m_dictionary.find(id);
-        return (index >= 0) ? (*this)[index] : NULL;
-    }
+    { return MleTSlotMap<ITEM>::get((MleSlotHandle)(size_t)m_dictionary.find(id)); }
 
     // How to find groups in a scene at rehearsal time.
-    // The dictionary stores pairs of (string, 1+index) of the ITEM within
-    // its container. Index 0 is used to represent missing ITEM in 
-    // the dict() return value.
+    // The dictionary stores pairs of (string, handle) of the ITEM within
+    // its container. A missing name yields handle 0, which is never
+    // valid.
     MleDwpStrKeyDict m_dictionary;
 
     // Sub-class must define these methods in order to have workprint
@@ -230,10 +258,13 @@ template <class ITEM> class MlePtrContainer : public MleTPtrArray<ITEM>
      * @brief Find the element in the container.
      *
      * At runtime the MlePPGroup_* macro converts to int for us
-     * so we can lookup the element easily.
+     * so we can lookup the element easily.  The int is the load
+     * order of the element, which names the first item given its slot;
+     * NULL is returned once that element has been removed, even if
+     * another element has since reused the slot.
      */
     ITEM find( const int id )
-    { return (*this)[id]; }
+    { return MleTSlotMap<ITEM>::get(MleSlotMap::getFirstHandle(id)); }
 
     // Sub-class must define this method in order to support playprint
     // loading.  XXX
@@ -250,8 +281,10 @@ template <class ITEM> class MlePtrContainer : public MleTPtrArray<ITEM>
 
 #endif /* MLE_DIGITAL_WORKPRINT */
 
-};
+  private:
 
-#undef TEMPLATE
+    // Map from item to its handle.
+    MleFlatPtrDict m_handles;
+};
 
 #endif /* __MLE_PTRCONTAINER_H_ */
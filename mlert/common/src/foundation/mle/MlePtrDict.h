@@ -42,6 +42,7 @@
 #define __MLE_PTRDICT_H_
 
 #include "mle/MleRuntime.h"
+#include "mle/MleFixedPool.h"
 
 // This is the struct managed by a dictionary
 //   Its use is internal for the most part, but is made public for
@@ -55,67 +56,13 @@ struct MLE_RUNTIME_API MlePtrDictEntry
 
 /**
  * This is the manager for allocation of MlePtrDictEntry objects
- * from a pool. 
+ * from a pool.
  *
- * This is the manager for allocation of MlePtrDictEntry objects
- * from a pool.  The initial poolsize passed in with the constructor
- * determines the chunk size of the pool.  A pool can be shared
- * among multiple dictionaries.
+ * The initial poolsize passed in with the constructor determines
+ * the size of the first chunk of the pool; later chunks grow
+ * geometrically.  A pool can be shared among multiple dictionaries.
  */
-class MLE_RUNTIME_API MlePtrDictPool
-{
-  public:
-
-	/**
-	 * The constructor.
-	 *
-     * @param poolsize The poolsize argument to the constructor determines the
-     * initial number of entries and the number added on every
-     * extension.
-	 */
-    MlePtrDictPool(int poolsize);
-
-	/**
-	 * the destructor.
-	 */
-    ~MlePtrDictPool();
-    
-	/**
-	 * Override operator new.
-	 *
-	 * @param tSize The size, in bytes, to allocate.
-	 */
-	void* operator new(size_t tSize);
-
-	/**
-	 * Override operator delete.
-	 *
-	 * @param p A pointer to the memory to delete.
-	 */
-    void  operator delete(void *p);
-
-  private:
-
-    friend class MlePtrDict;
-    
-    /*
-	 * This method is called when the pool needs to be expanded,
-     * which is at least once (when the pool is constructed).
-     * The pool is increased by poolsize entries
-	 */
-    void makePool(void);
-    
-    // Allocation and deallocation.
-    //   get() takes an entry off the free list and returns a pointer.
-    MlePtrDictEntry *get(void);
-
-	//   put() takes an entry and adds it to the free list.
-    void put(MlePtrDictEntry *);
-    
-    int m_poolsize;				// Allocation block size.
-    MlePtrDictEntry *m_unused;	// Pointer to free list.
-	MlePtrDictEntry *m_link;	// Pointer to first block.
-};
+typedef MleFixedPool<MlePtrDictEntry> MlePtrDictPool;
 
 /**
  * This is a dictionary class that maps pointers to pointers.
@@ -44,6 +44,7 @@
 
 // Include Magic Lantern header files.
 #include "mle/MleRuntime.h"
+#include "mle/MleTypeSymbol.h"
 #include "mle/MleActor.h"
 #include "mle/MleSet.h"
 
@@ -131,6 +132,13 @@ class MLE_RUNTIME_API MleRole
 	 */
     MleSet *m_set;
 
+    /**
+     * Points to the role the loader attached this role to, or NULL if
+     * it was attached to its set directly.  MleGroup::clone() uses it
+     * to attach the copies the same way.
+	 */
+    MleRole *m_parent;
+
   private:
 
     // The role's actor.
@@ -151,10 +159,13 @@ class MLE_RUNTIME_API MleRole
 	 * with this role.
 	 */
     MleRole(MleActor* theActor) 
-      : m_actor(theActor)
+      : m_parent(NULL),
+        m_actor(theActor)
     {
-        m_actor->attachRole(this);
+        // The set comes first; attachRole() may file a dirty
+        // actor with it.
         m_set = MleSet::g_currentSet;
+        m_actor->attachRole(this);
     }
 
     /**
@@ -183,6 +194,41 @@ class MLE_RUNTIME_API MleRole
 	 */
     void  operator delete(void *p);
 
+	/**
+	 * Construct a role in storage, for clone().
+	 */
+	void* operator new(size_t /* tSize */, void *storage) { return storage; }
+
+	/**
+	 * Match the placement operator new; there is nothing to free.
+	 */
+    void  operator delete(void * /* p */, void * /* storage */) {}
+
+    /**
+	 * @brief Get the size of the storage clone() needs.
+	 *
+     * @return The size of the role's class, or 0 if it cannot be cloned.
+	 */
+    virtual size_t getCloneSize(void) const;
+
+    /**
+	 * @brief Create a role like this one for another actor.
+	 *
+     * A role's state comes from its actor and its set, so rather than
+     * being copied it is constructed afresh, as the loader would, for
+     * the clone of its actor.  MLE_ROLE_HEADER() implements this for
+     * each role class.  As with loading, the role constructor finds its
+     * set through MleSet::g_currentSet, which the caller sets.
+	 *
+	 * @param actor The actor the new role is for, which has no role.
+	 * @param storage getCloneSize() bytes in which to construct the
+	 * role, suitably aligned.  The role is deleted normally, so the
+	 * storage must come from operator new or an MleArena.
+	 *
+	 * @return The new role, or NULL if the role cannot be cloned.
+	 */
+    virtual MleRole *clone(MleActor *actor, void *storage) const;
+
 #ifdef MLE_DIGITAL_WORKPRINT
 	/**
 	 * Get the name of the role's class.
@@ -205,6 +251,31 @@ class MLE_RUNTIME_API MleRole
 	 */
     virtual int isa(const char *type) const;
 
+	/**
+	 * Get the interned type symbol of the role class.
+	 *
+     * Rehearsal-only function
+	 */
+    static MleTypeId classTypeId(void);
+
+	/**
+	 * Get the interned type symbol of the role's class.
+	 *
+     * Rehearsal-only function
+	 */
+    virtual MleTypeId getTypeId(void) const;
+
+	/**
+	 * Determine if role is a subclass of the specified superclass,
+	 * by type symbol.
+	 *
+     * Rehearsal-only function
+     *
+	 * @param type  The symbol of the candidate superclass.
+	 */
+    int isa(MleTypeId type) const
+    { return MleTypeSymbol::isa(getTypeId(),type); }
+
 	/**
 	 * Set the role's unique identifier.
 	 *
@@ -288,9 +359,25 @@ class MLE_RUNTIME_API MleRole
   private:
 
 	  // Hide the default constructor.
-	  MleRole() : m_actor(NULL) {};
+	  MleRole() : m_parent(NULL), m_actor(NULL) {};
 };
 
+// Construct a role in storage for MleRole::clone(); abstract classes,
+// and any without a constructor taking the actor, are not cloned.
+template <class C> inline MleRole *mlCloneRole(MleActor *actor, void *storage, std::true_type)
+{ return new (storage) C(actor); }
+template <class C> inline MleRole *mlCloneRole(MleActor *, void *, std::false_type)
+{ return NULL; }
+
+// MleRole macro.
+//
+// Declares the clone hooks of a role class; used by MLE_ROLE_HEADER().
+#define MLE_ROLE_CLONE(C) \
+    virtual size_t getCloneSize(void) const { \
+        return std::is_constructible<C, MleActor *>::value ? sizeof(C) : 0; } \
+    virtual MleRole *clone(MleActor *actor, void *storage) const { \
+        return mlCloneRole<C>(actor, storage, std::is_constructible<C, MleActor *>()); }
+
 #ifdef MLE_DIGITAL_WORKPRINT
 
 #include <string.h>
@@ -311,8 +398,10 @@ class MLE_RUNTIME_API MleRole
 // Note: This macro switches subsequent declarations to 'public.'
 #define MLE_ROLE_HEADER(C) \
 	public: \
+		MLE_ROLE_CLONE(C) \
 		virtual const char *getTypeName(void) const; \
-		virtual int isa(const char *type) const; \
+		static MleTypeId classTypeId(void); \
+		virtual MleTypeId getTypeId(void) const; \
 		static C *cast(MleRole *role); \
 		static void initClass(void) 
 
@@ -329,12 +418,13 @@ class MLE_RUNTIME_API MleRole
 //
 #define MLE_ROLE_ABSTRACT_SOURCE(C,S) \
     const char *C::getTypeName(void) const { return #C; } \
-	int C::isa(const char *type) const { \
-		if ( !strcmp(type,#C) ) return 1; \
-		else return S::isa(type); \
+	MleTypeId C::classTypeId(void) { \
+		static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+		return type; \
 	} \
+	MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
 	C *C::cast(MleRole *role) { \
-		MLE_ASSERT(role->isa(#C)); \
+		MLE_ASSERT(role->isa(C::classTypeId())); \
 		return (C *)role; \
 	} \
 	void C::initClass(void) { \
@@ -342,6 +432,7 @@ class MLE_RUNTIME_API MleRole
 		if ( mlRoleClassInited ) return; \
 		mlRoleClassInited = 1; \
 		S::initClass(); \
+		C::classTypeId(); \
 	}
 	
 // MleRole Rehearsal-only macro.
@@ -357,13 +448,14 @@ class MLE_RUNTIME_API MleRole
 #define MLE_ROLE_SOURCE(C,S) \
     const char *C::getTypeName(void) const { return #C; } \
 	MleRole *_mlCreate##C(MleActor *a); MleRole *_mlCreate##C(MleActor *a) { return new C(a); } \
-	int C::isa(const char *type) const { \
-		if ( !strcmp(type,#C) ) return 1; \
-		else return S::isa(type); \
+	MleTypeId C::classTypeId(void) { \
+		static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+		return type; \
 	} \
+	MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
 	C *C::cast(MleRole *role) { \
 		MLE_ASSERT(role); \
-		MLE_ASSERT(role->isa(#C)); \
+		MLE_ASSERT(role->isa(C::classTypeId())); \
 		return (C *)role; \
 	} \
 	void C::initClass(void) { \
@@ -371,6 +463,7 @@ class MLE_RUNTIME_API MleRole
 		if ( mlRoleClassInited ) return; \
 		mlRoleClassInited = 1; \
 		S::initClass(); \
+		C::classTypeId(); \
 		MleRoleClass::add(#C,_mlCreate##C); \
 	}
 
@@ -383,6 +476,7 @@ class MLE_RUNTIME_API MleRole
 
 #define MLE_ROLE_HEADER(C) \
     public: \
+        MLE_ROLE_CLONE(C) \
         static C *cast(MleRole *role) { return (C *)role; } \
         friend class _mleDummy
 #define MLE_ROLE_ABSTRACT_SOURCE(C,S)
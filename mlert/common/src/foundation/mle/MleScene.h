@@ -43,6 +43,7 @@
 
 // Include Magic Lantern header files.
 #include "mle/MleRuntime.h"
+#include "mle/MleTypeSymbol.h"
 #include "mle/MlePtrContainer.h"
 #include "mle/MleGroup.h"
 
@@ -59,7 +60,8 @@
 #define MLE_SCENE_HEADER(C) \
   public: \
     virtual const char *getTypeName(void) const; \
-    virtual int isa(const char *type) const; \
+    static MleTypeId classTypeId(void); \
+    virtual MleTypeId getTypeId(void) const; \
     static C *cast(MleScene *scene); \
     static void initClass(void)
 
@@ -68,12 +70,13 @@
 // The single argument is the unquoted class name.
 #define MLE_SCENE_SOURCE(C,S) \
     const char *C::getTypeName(void) const { return #C; } \
-    int C::isa(const char *type) const { \
-	if ( !strcmp(type,#C) ) return 1; \
-	else return S::isa(type); \
+    MleTypeId C::classTypeId(void) { \
+        static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+        return type; \
     } \
+    MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
     C *C::cast(MleScene *scene) { \
-	MLE_ASSERT(scene->isa(#C)); \
+	MLE_ASSERT(scene->isa(C::classTypeId())); \
 	return (C *)scene; \
     } \
     MleScene *_mlCreate##C(void); MleScene *_mlCreate##C(void) { return new C; }
@@ -209,6 +212,13 @@ class MLE_RUNTIME_API MleScene : public MlePtrContainer<MleGroup*>
     // Predicate returning true if the type of the scene is the same as type -- rehearsal time only.
     virtual int isa(const char *type) const;
 
+    // Type symbols -- rehearsal time only.  isa(MleTypeId) is the
+    // constant time form of isa(const char *).
+    static MleTypeId classTypeId(void);
+    virtual MleTypeId getTypeId(void) const;
+    int isa(MleTypeId type) const
+    { return MleTypeSymbol::isa(getTypeId(),type); }
+
     // One time class initialization that sets up the constructor for this class.
     static void initClass(void);
   
@@ -0,0 +1,222 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleSceneLoader.h
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __MLE_SCENELOADER_H_
+#define __MLE_SCENELOADER_H_
+
+// Include Magic Lantern header files.
+#include "mle/mlTypes.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleRuntime.h"
+
+// Forward class declarations.
+class MleScene;
+class MleGroup;
+struct MleLoadContext;
+struct MleSchedulerItem;
+struct MleSchedulerPhase;
+
+
+/**
+ * MleSceneLoader loads a playprint scene a little at a time.
+ *
+ * mlLoadScene() reads, parses and initializes a whole scene before it
+ * returns, stalling the title for as long as that takes.  A scene loader
+ * does the same work in stages, spread over as many calls to step() as
+ * the title cares to make:
+ * <ol>
+ *   <li>FETCH reads the scene chunk, creates the scene and asks for
+ *       its group chunks to be paged in ahead of use.</li>
+ *   <li>CONSTRUCT parses one group chunk per unit of work, creating
+ *       the group, its actors and their roles, detached from
+ *       everything but the sets they are bound to.</li>
+ *   <li>COMMIT makes the scene current, then attaches roles and runs
+ *       the actors' init() functions, one actor per unit of work, so
+ *       that actors register with the scheduler.</li>
+ * </ol>
+ * The loader is the handle to the load: it reports progress, and the
+ * load may be cancelled until the commit begins, since that replaces
+ * the current scene.
+ * <p>
+ * Nothing is loaded in the background.  step() does all of the work,
+ * reading and decompressing chunks included, on the calling thread;
+ * the only asynchronous part is the read-ahead that
+ * mlPrefetchPlayprintChunk() asks of a memory mapped playprint.  A unit
+ * of work is therefore as long as its largest piece: a CONSTRUCT step
+ * reads, decodes and builds a whole group, which for a group loaded
+ * for the first time costs as much as its mlLoadGroup().  Unlike
+ * mlLoadScene(), the loader decodes no groups on worker threads.
+ */
+class MLE_RUNTIME_API MleSceneLoader
+{
+  public:
+
+    /**
+     * The stages of a load.
+     */
+    typedef enum
+    {
+        FETCH,          // scene chunk not yet read
+        CONSTRUCT,      // parsing group chunks
+        COMMIT,         // initializing actors
+        DONE,           // the scene is loaded and current
+        CANCELLED,      // cancel() was called
+        FAILED          // the scene or a group could not be created
+    } Stage;
+
+    /**
+     * @brief Begin loading a scene.  No work is done until step().
+     *
+     * @param indexToPpTOC The index of the scene chunk in the playprint
+     * TOC, as for mlLoadScene().
+     */
+    MleSceneLoader(const int indexToPpTOC);
+
+    /**
+     * @brief The destructor.
+     *
+     * An unfinished load is cancelled, or run to completion if its
+     * commit has already begun.
+     */
+    virtual ~MleSceneLoader(void);
+
+    /**
+     * @brief Do some of the work of the load.
+     *
+     * @param budget The number of units of work to do: reading the
+     * scene chunk, parsing a group chunk, initializing an actor or
+     * finishing a group each count as one.
+     *
+     * @return TRUE if the load has finished, for whatever reason.
+     */
+    MlBoolean step(int budget = 1);
+
+    /**
+     * @brief Do all of the remaining work of the load.
+     */
+    void finish(void);
+
+    /**
+     * @brief Abandon the load, deleting everything created so far.
+     *
+     * Sets loaded for the scene's groups are kept, as they are shared.
+     *
+     * @return TRUE if the load was cancelled, FALSE if it had already
+     * finished or its commit had begun.
+     */
+    MlBoolean cancel(void);
+
+    /**
+     * @brief Step the load once every time a scheduler phase runs.
+     *
+     * The loader removes itself from the scheduler when the load
+     * finishes; it is not deleted.
+     *
+     * @param phase The phase to run in, such as g_thePostActorPhase.
+     * @param budget The units of work to do each time.
+     */
+    void schedule(MleSchedulerPhase *phase, int budget = 1);
+
+    /**
+     * @brief Get the current stage of the load.
+     */
+    Stage getStage(void) const
+    { return m_stage; }
+
+    /**
+     * @brief Determine whether the load has finished.
+     */
+    MlBoolean isFinished(void) const
+    { return (m_stage == DONE) || (m_stage == CANCELLED) || (m_stage == FAILED); }
+
+    /**
+     * @brief Estimate how much of the load has been done.
+     *
+     * @return A fraction from 0 to 1.
+     */
+    float getProgress(void) const;
+
+    /**
+     * @brief Get the loaded scene.
+     *
+     * @return The scene once the load is DONE, otherwise NULL.  The
+     * scene belongs to the scene management, as for mlLoadScene().
+     */
+    MleScene *getScene(void) const
+    { return (m_stage == DONE) ? m_scene : NULL; }
+
+    // Override operator new.
+    void* operator new(size_t tSize);
+
+    // Override operator delete.
+    void  operator delete(void *p);
+
+  private:
+
+    int m_indexToPpTOC;
+    Stage m_stage;
+    MleScene *m_scene;
+
+    int m_numGroups;
+    int *m_groupIndices;        // TOC indices of the scene's groups
+    MleGroup **m_groups;        // parsed groups, in scene order
+    MleLoadContext *m_contexts; // their actors, awaiting commit
+    int m_numParsed;            // groups parsed
+    int m_numCommitted;         // groups committed
+    int m_numInitialized;       // actors initialized in the group being committed
+    MlBoolean m_committing;     // the scene has been made current
+
+    MleSchedulerItem *m_item;
+    int m_budget;
+
+    // Each of these does one unit of work.
+    void fetch(void);
+    void construct(void);
+    void commit(void);
+
+    // Delete what has been created, leaving the loader in stage.
+    void discard(Stage stage);
+
+    // The scheduled function.
+    static void update(void *loader);
+};
+
+#endif /* __MLE_SCENELOADER_H_ */
@@ -46,6 +46,7 @@
 
 // Include Runtime Engine header files.
 #include "mle/MleRuntime.h"
+#include "mle/MleFixedPool.h"
 
 // Routine control block
 struct MleSchedulerItem;
@@ -78,13 +79,11 @@ class MLE_RUNTIME_API MleScheduler
   private:
 	
     MleSchedulerPhase** m_phaseArray;  // the phases
-    MleSchedulerItem* m_freeItem;      // pool of free items
     MleSchedulerItem* m_iterator;      // the iterator
     MleSchedulerItem* m_deleteItem;    // pool of deleted items
-    MleSchedulerItem* m_memLink;       // reference to memory
     unsigned int m_maxPhases;          // maximum number of phases
     unsigned int m_inUsePhases;        // number of items in use
-    int m_initSize;                    // initial itemMemory size
+    MleFixedPool<MleSchedulerItem> m_itemPool; // pool of items
   
 
   // Declare member functions.
@@ -258,11 +257,15 @@ class MLE_RUNTIME_API MleScheduler
      * dependent on their interval.
 	 */
     void goAll(void);
+
+    /**
+	 * @brief Get usage statistics for the scheduled item pool.
+	 *
+	 * @param stats The structure to fill in.
+	 */
+    void getItemPoolStats(MleFixedPoolStats &stats) const;
     
   private:
-  
-	// Allocate memory for an item.
-    void makeItemMemory(void);
 
 #ifdef MLE_REHEARSAL
     static void notify(void *key,MleScheduler *sched);
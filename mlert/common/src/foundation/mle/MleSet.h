@@ -46,14 +46,19 @@
 
 // Include Runtime Engine header files.
 #include "mle/MleRuntime.h"
+#include "mle/MleTypeSymbol.h"
 #include "mle/MleObject.h"
+#include "mle/MleProperty.h"
 
 // New Set Property definitions (to remove legacy offsetof implementation).
 #define MLE_SET_PROPERTY(TYPE,NAME,GETTER,SETTER)         \
   public:                                                 \
     TYPE NAME;                                            \
+    MLE_PROPERTY_VALUE_TRAITS(TYPE,NAME)                  \
     virtual TYPE GETTER() {return NAME;}                  \
     virtual void SETTER(TYPE NAME) {this->NAME = NAME;}   \
+    void NAME##AdoptProperty(unsigned char *value, int) { \
+        SETTER(*(TYPE *)value); }                         \
     int NAME##IsOfType(const char *type) {                \
         if (strcmp(#TYPE, type) == 0) return 1;           \
         else return 0; }
@@ -61,11 +66,17 @@
 #define MLE_SET_DYNAMIC_PROPERTY(TYPE,NAME,GETTER,SETTER) \
   public:                                                 \
     TYPE NAME;                                            \
+    MLE_PROPERTY_TRAITS(TYPE,NAME,0)                      \
     virtual const TYPE GETTER() {return NAME;}            \
     virtual void SETTER(const TYPE value, size_t size) {  \
         if (this->NAME != NULL) mlFree(this->NAME);       \
         this->NAME = (TYPE) mlMalloc(size);               \
         memcpy(this->NAME, value, size); }                \
+    virtual void NAME##Adopt(TYPE value) {                \
+        if (this->NAME != NULL) mlFree(this->NAME);       \
+        this->NAME = value; }                             \
+    void NAME##AdoptProperty(unsigned char *value, int) { \
+        NAME##Adopt((TYPE) value); }                      \
     int NAME##IsOfType(const char *type) {                \
         if (strcmp(#TYPE, type) == 0) return 1;           \
         else return 0; }
@@ -73,11 +84,19 @@
 #define MLE_SET_ARRAY_PROPERTY(TYPE,NAME,GETTER,SETTER)    \
   public:                                                  \
     MleArray<TYPE> NAME;                                   \
+    MLE_PROPERTY_TRAITS(MleArray<TYPE>,NAME,0)             \
     virtual const MleArray<TYPE> *GETTER() {return &NAME;} \
     virtual void SETTER(MleArray<TYPE> &value) {           \
         this->NAME.resize(value.size());                   \
         for (int i = 0; i < value.size(); i++)             \
             this->NAME[i] = value[i]; }                    \
+    virtual void NAME##Adopt(MleArray<TYPE> &value) {      \
+        mlSwapProperty(this->NAME, value); }               \
+    void NAME##AdoptProperty(unsigned char *value, int count) { \
+        MleArray<TYPE> elements(count);                    \
+        if (count > 0)                                     \
+            memcpy(&elements[0], value, count * sizeof(TYPE)); \
+        NAME##Adopt(elements); }                           \
     int NAME##IsOfArrayType(const char *type) {            \
         if (strcmp(#TYPE, type) == 0) return 1;            \
         else return 0; }
@@ -111,7 +130,8 @@ class MleDwpDataUnion;
 #define MLE_SET_HEADER(C) \
   public: \
     virtual const char *getTypeName(void) const; \
-    virtual int isa(const char *type) const; \
+    static MleTypeId classTypeId(void); \
+    virtual MleTypeId getTypeId(void) const; \
     static C *cast(MleSet *set); \
     static void initClass(void)
 
@@ -122,12 +142,13 @@ class MleDwpDataUnion;
 // The single argument is the unquoted class name.
 #define MLE_SET_SOURCE(C,S) \
     const char *C::getTypeName(void) const { return #C; } \
-    int C::isa(const char *type) const { \
-        if ( !strcmp(type,#C) ) return 1; \
-        else return S::isa(type); \
+    MleTypeId C::classTypeId(void) { \
+        static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+        return type; \
     } \
+    MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
     C *C::cast(MleSet *set) { \
-        MLE_ASSERT(set->isa(#C)); \
+        MLE_ASSERT(set->isa(C::classTypeId())); \
         return (C *)set; \
     } \
     MleSet *_mlCreate##C(void) { return new C; }
@@ -138,7 +159,8 @@ class MleDwpDataUnion;
 #define MLE_SET_ABSTRACT_HEADER(C) \
   public: \
     virtual const char *getTypeName(void) const = 0; \
-    virtual int isa(const char *type) const; \
+    static MleTypeId classTypeId(void); \
+    virtual MleTypeId getTypeId(void) const; \
     static C *cast(MleSet *set); \
     static void initClass(void)
 
@@ -146,12 +168,13 @@ class MleDwpDataUnion;
 //
 // This macro should be used instead of MLE_SET_SOURCE for abstract classes.
 #define MLE_SET_ABSTRACT_SOURCE(C,S) \
-    int C::isa(const char *type) const { \
-        if ( !strcmp(type,#C) ) return 1; \
-        else return S::isa(type); \
+    MleTypeId C::classTypeId(void) { \
+        static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+        return type; \
     } \
+    MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
     C *C::cast(MleSet *set) { \
-        MLE_ASSERT(set->isa(#C)); \
+        MLE_ASSERT(set->isa(C::classTypeId())); \
         return (C *)set; \
     } \
     MleSet *_mlCreate##C(void) { return NULL; }
@@ -177,6 +200,7 @@ class MleDwpDataUnion;
     if ( _mlSetClassInited ) return ; \
     _mlSetClassInited = 1; \
     SUPERCLASS::initClass(); \
+    SET::classTypeId(); \
     new MleSetClass(#SET,_mlCreate##SET,#SUPERCLASS)
 
 // MleSet Rehearsal-only macro.
@@ -188,6 +212,7 @@ class MleDwpDataUnion;
     if ( _mlSetClassInited ) return; \
     _mlSetClassInited = 1; \
     SUPERCLASS::initClass(); \
+    SET::classTypeId(); \
     new MleSetClass(#SET,_mlCreate##SET,#SUPERCLASS, #EDITOR, #CONTENT_EDITOR)
 
 // MleSet Rehearsal-only macro.
@@ -204,6 +229,11 @@ class MleDwpDataUnion;
 	entryFor##MEMBER->name = #MEMBER; \
 	entryFor##MEMBER->getProperty = SET::getProperty; \
 	entryFor##MEMBER->setProperty = SET::setProperty; \
+	entryFor##MEMBER->nameHash = mlPropertyHash(#MEMBER); \
+	entryFor##MEMBER->type = #TYPE; \
+	entryFor##MEMBER->offset = MLE_PROPERTY_OFFSET(SET,MEMBER); \
+	entryFor##MEMBER->size = sizeof(((SET *)0)->MEMBER); \
+	entryFor##MEMBER->flags = SET::MEMBER##PropertyFlags(); \
     MleSetClass::find(#SET)->addMember(#MEMBER,#TYPE,entryFor##MEMBER)
 #endif
 
@@ -213,27 +243,31 @@ class MleDwpDataUnion;
 // Make a dummy statement to avoid errors with the trailing semicolon.
 #define MLE_SET_HEADER(C) \
   public: \
-    virtual int isa(const char *type) const; \
+    static MleTypeId classTypeId(void); \
+    virtual MleTypeId getTypeId(void) const; \
     static C *cast(MleSet *set) { return (C *)set; } \
     friend class _mleDummy
 
 #define MLE_SET_ABSTRACT_HEADER(C) \
-	virtual int isa(const char *type) const; \
+	static MleTypeId classTypeId(void); \
+	virtual MleTypeId getTypeId(void) const; \
 	static C *cast(MleSet *set) { return (C *)set; } \
 	friend class _mleDummy
 
 #define MLE_SET_SOURCE(C,S) \
-    int C::isa(const char *type) const { \
-        if ( !strcmp(type,#C) ) return 1; \
-        else return S::isa(type); \
+    MleTypeId C::classTypeId(void) { \
+        static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+        return type; \
     } \
+    MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
     MleSet *_mlCreate##C(void) { return new C; }
 
 #define MLE_SET_ABSTRACT_SOURCE(C,S) \
-    int C::isa(const char *type) const { \
-        if ( !strcmp(type,#C) ) return 1; \
-        else return S::isa(type); \
+    MleTypeId C::classTypeId(void) { \
+        static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+        return type; \
     } \
+    MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
 	MleSet *_mlCreate##C(void) { return new C; }
 
 #endif /* MLE_DIGITAL_PLAYPRINT */
@@ -329,6 +363,46 @@ class MLE_RUNTIME_API MleSet : public MleObject
 	 */
     virtual void attach(MleRole* parent, MleRole* child);
 
+	/**
+	 * @brief Get the first actor in the set's dirty actor list.
+	 *
+     * An actor whose role belongs to this set is appended to the list
+     * when its dirty mask goes from clear to non-zero, and leaves it
+     * when the mask is cleared again or the actor is deleted.  Walk
+     * the list with MleActor::getNextDirtyActor().
+	 *
+	 * @return The first dirty actor, or NULL if there are none.
+	 */
+    MleActor *getDirtyActors(void) const { return m_dirtyActors; }
+
+	/**
+	 * @brief Get the number of actors in the dirty actor list.
+	 */
+    int getNumDirtyActors(void) const { return m_numDirtyActors; }
+
+	/**
+	 * @brief Clear the dirty mask of every actor in the list,
+	 * which empties the list.
+	 */
+    void clearDirtyActors(void);
+
+	/**
+	 * @brief Append an actor to the dirty actor list.
+	 *
+     * Called by MleActor::markDirty(); the actor must not
+     * already be in a dirty actor list.
+	 *
+	 * @param actor The actor to append.
+	 */
+    void addDirtyActor(MleActor *actor);
+
+	/**
+	 * @brief Remove an actor from the dirty actor list.
+	 *
+	 * @param actor The actor to remove; it must be in this set's list.
+	 */
+    void removeDirtyActor(MleActor *actor);
+
 #ifdef MLE_DIGITAL_WORKPRINT
   public:
 
@@ -338,6 +412,13 @@ class MLE_RUNTIME_API MleSet : public MleObject
     virtual const char *getTypeName(void) const;
 	// isa() returns nonzero if the instance is of the specified class.
     virtual int isa(const char *type) const;
+	// classTypeId() and getTypeId() return the interned type symbols
+	// of the class and of an instance; isa(MleTypeId) is the
+	// constant time form of isa().
+    static MleTypeId classTypeId(void);
+    virtual MleTypeId getTypeId(void) const;
+    int isa(MleTypeId type) const
+    { return MleTypeSymbol::isa(getTypeId(),type); }
     static void initClass(void);
 
     // Get the set class.
@@ -423,8 +504,22 @@ class MLE_RUNTIME_API MleSet : public MleObject
 
 	// isa() returns nonzero if the instance is of the specified class.
     virtual int isa(const char *type) const;
+	// classTypeId() and getTypeId() return the interned type symbols
+	// of the class and of an instance; isa(MleTypeId) is the
+	// constant time form of isa().
+    static MleTypeId classTypeId(void);
+    virtual MleTypeId getTypeId(void) const;
+    int isa(MleTypeId type) const
+    { return MleTypeSymbol::isa(getTypeId(),type); }
 
 #endif /* MLE_DIGITAL_PLAYPRINT */
+
+  private:
+
+    // The dirty actor list, in the order the actors became dirty.
+    MleActor *m_dirtyActors;
+    MleActor *m_lastDirtyActor;
+    int m_numDirtyActors;
 };
 
 #endif /* __MLE_SET_H_ */
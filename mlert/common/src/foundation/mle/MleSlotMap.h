@@ -0,0 +1,246 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleSlotMap.h
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __MLE_SLOTMAP_H_
+#define __MLE_SLOTMAP_H_
+
+// Include Magic Lantern header files.
+#include "mle/mlTypes.h"
+#include "mle/mlAssert.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleRuntime.h"
+
+// A handle to an item in a slot map.
+//   The low MLE_SLOTMAP_INDEX_BITS bits hold the slot index and the
+//   remaining bits the generation of the slot when the item was added.
+//   0 is never a valid handle.
+typedef unsigned int MleSlotHandle;
+
+#define MLE_SLOTMAP_INDEX_BITS  20
+#define MLE_SLOTMAP_INDEX_MASK  ((1U << MLE_SLOTMAP_INDEX_BITS) - 1)
+#define MLE_SLOTMAP_MAX_GENERATION  (0xFFFFFFFFU >> MLE_SLOTMAP_INDEX_BITS)
+#define MLE_SLOTMAP_INVALID_HANDLE  0
+
+// A slot of a slot map; its use is internal.
+struct MleSlotMapSlot;
+
+/**
+ * MleSlotMap is a pointer container with stable handles.
+ *
+ * Items are stored densely, so iterating over [0, getSize()) with
+ * operator[] touches only live items. Each item also occupies a slot
+ * whose index never changes while the item is in the map; add()
+ * returns a handle naming that slot and the generation it had. Adding
+ * and removing are constant time: removal moves the last item into
+ * the hole, so dense positions are not preserved across removals.
+ *
+ * Removing an item bumps the generation of its slot, so get() returns
+ * NULL for handles that refer to removed items instead of returning
+ * whatever reused the slot. Freed slots are reused oldest first, and
+ * a handle can only be mistaken after its slot has been reused
+ * MLE_SLOTMAP_MAX_GENERATION times.
+ *
+ * Slots are numbered from 0 in the order items are added until the
+ * first removal, and a slot starts at generation 1, so the item added
+ * n-th to a fresh map has the handle getFirstHandle(n). That handle
+ * goes stale like any other once the item is removed; a later item
+ * reusing the slot does not answer to it.
+ */
+class MLE_RUNTIME_API MleSlotMap
+{
+  // Declare member variables.
+
+  protected:
+
+    int m_n;                    // number of items
+    int m_allocSize;            // number of dense entries allocated
+    void **m_array;             // dense items
+    unsigned int *m_slotOf;     // slot index of each dense item
+    MleSlotMapSlot *m_slots;    // slot table
+    unsigned int m_numSlots;    // slots in use or on the free list
+    unsigned int m_maxSlots;    // slots allocated
+    int m_freeHead;             // oldest free slot, or -1
+    int m_freeTail;             // newest free slot, or -1
+
+  // Declare member functions.
+
+  public:
+
+    /**
+     * @brief A constructor.
+     *
+     * @param initSize The initial allocation size of the map.
+     */
+    MleSlotMap(int initSize);
+
+    /**
+     * @brief The destructor.
+     */
+    ~MleSlotMap();
+
+    /**
+     * @brief Get the number of items in the map.
+     */
+    int getSize(void) const { return m_n; }
+
+    /**
+     * @brief Access an item by dense position, 0 to getSize()-1.
+     */
+    void *& operator[](int index) { return m_array[index]; }
+
+    /**
+     * @brief Add an item.
+     *
+     * @param ptr The item to add.
+     *
+     * @return A handle to the item.
+     */
+    MleSlotHandle add(void *ptr);
+
+    /**
+     * @brief Remove an item.
+     *
+     * The last item is moved into the dense position of the removed one.
+     *
+     * @param handle The handle returned when the item was added.
+     *
+     * @return TRUE if the item was removed, FALSE if the handle was stale.
+     */
+    MlBoolean remove(MleSlotHandle handle);
+
+    /**
+     * @brief Remove all items.
+     *
+     * All outstanding handles become stale.
+     */
+    void removeAll(void);
+
+    /**
+     * @brief Look up an item.
+     *
+     * @return The item, or NULL if the handle is stale.
+     */
+    void *get(MleSlotHandle handle) const;
+
+    /**
+     * @brief Determine whether a handle still refers to an item.
+     */
+    MlBoolean isValid(MleSlotHandle handle) const;
+
+    /**
+     * @brief Get the handle of an item by dense position.
+     */
+    MleSlotHandle getHandle(int index) const;
+
+    /**
+     * @brief Get the dense position of an item.
+     *
+     * @return The position, or -1 if the handle is stale.
+     */
+    int getIndex(MleSlotHandle handle) const;
+
+    /**
+     * @brief Get the handle of the first item added to a slot.
+     *
+     * @param slot The slot index.
+     */
+    static MleSlotHandle getFirstHandle(int slot)
+    {
+        MLE_ASSERT(slot >= 0 && (unsigned int)slot <= MLE_SLOTMAP_INDEX_MASK);
+        return (1U << MLE_SLOTMAP_INDEX_BITS) | (unsigned int)slot;
+    }
+
+    /**
+     * @brief Get the slot index of a handle.
+     */
+    static int getSlotIndex(MleSlotHandle handle)
+    { return (int)(handle & MLE_SLOTMAP_INDEX_MASK); }
+
+    /**
+     * Override operator new.
+     *
+     * @param tSize The size, in bytes, to allocate.
+     */
+    void* operator new(size_t tSize);
+
+    /**
+     * Override operator delete.
+     *
+     * @param p A pointer to the memory to delete.
+     */
+    void  operator delete(void *p);
+
+  private:
+
+    // Take a slot off the free list, or append a new one.
+    unsigned int allocSlot(void);
+
+    // Hide the copy constructor and assignment operator.
+    MleSlotMap(const MleSlotMap &);
+    void operator =(const MleSlotMap &);
+};
+
+
+/**
+ * @brief MleTSlotMap is a template that can be used to create type-safe
+ * subclasses of the slot map.
+ *
+ * A pointer (not a type) is the template argument.
+ */
+template<class T> class MleTSlotMap : public MleSlotMap
+{
+
+  public:
+
+    //////////
+    MleTSlotMap(int initSize) : MleSlotMap(initSize) {}
+
+    //////////
+    T& operator[](int index) { return *(T *)&m_array[index]; }
+
+    //////////
+    MleSlotHandle add(T ptr) { return MleSlotMap::add((void *)ptr); }
+
+    //////////
+    T get(MleSlotHandle handle) const { return (T)MleSlotMap::get(handle); }
+};
+
+#endif /* __MLE_SLOTMAP_H_ */
@@ -83,6 +83,7 @@ class MleDwpDataUnion;
 
 // Include Magic Lantern Runtime Engine header files.
 #include "mle/MleRuntime.h"
+#include "mle/MleTypeSymbol.h"
 #include "mle/MleProperty.h"
 #include "mle/MleObject.h"
 
@@ -158,6 +159,12 @@ class MLE_RUNTIME_API MleStage : public MleObject
 
     virtual int isa(const char *type) const;
 
+    // Interned type symbols; isa(MleTypeId) needs no string compares.
+    static MleTypeId classTypeId(void);
+    virtual MleTypeId getTypeId(void) const;
+    int isa(MleTypeId type) const
+    { return MleTypeSymbol::isa(getTypeId(),type); }
+
     // Class initialization for base class.
     static void initClass(void);
 
@@ -484,8 +491,11 @@ class MLE_RUNTIME_API MleStage : public MleObject
 #define MLE_STAGE_PROPERTY(TYPE,NAME,GETTER,SETTER)         \
   public:                                                   \
     TYPE NAME;                                              \
+    MLE_PROPERTY_VALUE_TRAITS(TYPE,NAME)                    \
     virtual TYPE GETTER() {return NAME;}                    \
     virtual void SETTER(TYPE value) {this->NAME = value;}   \
+    void NAME##AdoptProperty(unsigned char *value, int) {   \
+        SETTER(*(TYPE *)value); }                           \
     int NAME##IsOfType(const char *type) {                  \
         if (strcmp(#TYPE, type) == 0) return 1;             \
         else return 0; }
@@ -493,11 +503,17 @@ class MLE_RUNTIME_API MleStage : public MleObject
 #define MLE_STAGE_DYNAMIC_PROPERTY(TYPE,NAME,GETTER,SETTER) \
   public:                                                   \
     TYPE NAME;                                              \
+    MLE_PROPERTY_TRAITS(TYPE,NAME,0)                        \
     virtual const TYPE GETTER() {return NAME;}              \
     virtual void SETTER(const TYPE value, size_t size) {    \
         if (this->NAME != NULL) mlFree(this->NAME);         \
         this->NAME = (TYPE) mlMalloc(size);                 \
         memcpy(this->NAME, value, size); }                  \
+    virtual void NAME##Adopt(TYPE value) {                  \
+        if (this->NAME != NULL) mlFree(this->NAME);         \
+        this->NAME = value; }                               \
+    void NAME##AdoptProperty(unsigned char *value, int) {   \
+        NAME##Adopt((TYPE) value); }                        \
     int NAME##IsOfType(const char *type) {                  \
         if (strcmp(#TYPE, type) == 0) return 1;             \
         else return 0; }
@@ -505,11 +521,19 @@ class MLE_RUNTIME_API MleStage : public MleObject
 #define MLE_STAGE_ARRAY_PROPERTY(TYPE,NAME,GETTER,SETTER)   \
   public:                                                   \
     MleArray<TYPE> NAME;                                    \
+    MLE_PROPERTY_TRAITS(MleArray<TYPE>,NAME,0)              \
     virtual const MleArray<TYPE> *GETTER() {return &NAME;}  \
     virtual void SETTER(MleArray<TYPE> &value) {            \
         this->NAME.resize(value.size());                    \
         for (int i = 0; i < value.size(); i++)              \
             this->NAME[i] = value[i]; }                     \
+    virtual void NAME##Adopt(MleArray<TYPE> &value) {       \
+        mlSwapProperty(this->NAME, value); }                \
+    void NAME##AdoptProperty(unsigned char *value, int count) { \
+        MleArray<TYPE> elements(count);                     \
+        if (count > 0)                                      \
+            memcpy(&elements[0], value, count * sizeof(TYPE)); \
+        NAME##Adopt(elements); }                            \
     int NAME##IsOfArrayType(const char *type) {             \
         if (strcmp(#TYPE, type) == 0) return 1;             \
         else return 0; }
@@ -534,7 +558,8 @@ class MLE_RUNTIME_API MleStage : public MleObject
 #define MLE_STAGE_HEADER(C) \
   public: \
     virtual const char *getTypeName(void) const; \
-    virtual int isa(const char *type) const; \
+    static MleTypeId classTypeId(void); \
+    virtual MleTypeId getTypeId(void) const; \
     static C *cast(MleStage *stage); \
     static void initClass(void)
 
@@ -543,12 +568,13 @@ class MLE_RUNTIME_API MleStage : public MleObject
 // The single argument is the unquoted class name.
 #define MLE_STAGE_SOURCE(C,S) \
     const char *C::getTypeName(void) const { return #C; } \
-    int C::isa(const char *type) const { \
-    if ( !strcmp(type,#C) ) return 1; \
-    else return S::isa(type); \
+    MleTypeId C::classTypeId(void) { \
+        static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+        return type; \
     } \
+    MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
     C *C::cast(MleStage *stage) { \
-        MLE_ASSERT(stage->isa(#C)); \
+        MLE_ASSERT(stage->isa(C::classTypeId())); \
         return (C *)stage; \
     } \
     MleStage *_mlCreate##C(void) { return new C; }
@@ -557,18 +583,20 @@ class MLE_RUNTIME_API MleStage : public MleObject
 #define MLE_STAGE_ABSTRACT_HEADER(C) \
   public: \
     virtual const char *getTypeName(void) const = 0; \
-    virtual int isa(const char *type) const; \
+    static MleTypeId classTypeId(void); \
+    virtual MleTypeId getTypeId(void) const; \
     static C *cast(MleStage *stage); \
     static void initClass(void)
 
 // This macro should be used instead of MLE_STAGE_SOURCE for abstract classes.
 #define MLE_STAGE_ABSTRACT_SOURCE(C,S) \
-    int C::isa(const char *type) const { \
-        if ( !strcmp(type,#C) ) return 1; \
-        else return S::isa(type); \
+    MleTypeId C::classTypeId(void) { \
+        static MleTypeId type = MleTypeSymbol::intern(#C,S::classTypeId()); \
+        return type; \
     } \
+    MleTypeId C::getTypeId(void) const { return C::classTypeId(); } \
     C *C::cast(MleStage *stage) { \
-        MLE_ASSERT(stage->isa(#C)); \
+        MLE_ASSERT(stage->isa(C::classTypeId())); \
         return (C *)stage; \
     } \
     MleStage *_mlCreate##C(void) { return NULL; }
@@ -591,6 +619,7 @@ class MLE_RUNTIME_API MleStage : public MleObject
     if ( _mlStageClassInited ) return ; \
     _mlStageClassInited = 1; \
     SUPERCLASS::initClass(); \
+    STAGE::classTypeId(); \
     new MleStageClass(#STAGE,_mlCreate##STAGE,#SUPERCLASS)
 
 // This macro takes the unquoted stage class name, the unquoted member
@@ -605,6 +634,11 @@ class MLE_RUNTIME_API MleStage : public MleObject
     entryFor##MEMBER->name = #MEMBER; \
     entryFor##MEMBER->getProperty = STAGE::getProperty; \
     entryFor##MEMBER->setProperty = STAGE::setProperty; \
+    entryFor##MEMBER->nameHash = mlPropertyHash(#MEMBER); \
+    entryFor##MEMBER->type = #TYPE; \
+    entryFor##MEMBER->offset = MLE_PROPERTY_OFFSET(STAGE,MEMBER); \
+    entryFor##MEMBER->size = sizeof(((STAGE *)0)->MEMBER); \
+    entryFor##MEMBER->flags = STAGE::MEMBER##PropertyFlags(); \
     MleStageClass::find(#STAGE)->addMember(#MEMBER,#TYPE,entryFor##MEMBER)
 #endif /* 0 */
 
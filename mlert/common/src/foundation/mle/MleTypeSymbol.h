@@ -0,0 +1,174 @@
+/** @defgroup MleFoundation Magic Lantern Runtime Engine Foundation Library API */
+
+/**
+ * @file MleTypeSymbol.h
+ * @ingroup MleFoundation
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __MLE_TYPESYMBOL_H_
+#define __MLE_TYPESYMBOL_H_
+
+// Include Magic Lantern header files.
+#include "mle/mlTypes.h"
+
+// Include Runtime Engine header files.
+#include "mle/MleRuntime.h"
+
+/**
+ * An interned class name.  Zero is never a valid symbol.
+ */
+typedef int MleTypeId;
+
+#define MLE_TYPE_NONE 0
+
+// The name table of a hierarchy; its use is internal.
+class MleTypeSymbolDict;
+
+// This is the per-symbol record of the type symbol table.
+//   m_enter and m_exit bracket the pre-order numbers of the symbol's
+//   subtree, so a symbol is derived from another exactly when its
+//   m_enter falls within the other's range.
+struct MLE_RUNTIME_API MleTypeSymbolEntry
+{
+    char *m_name;           // interned class name
+    MleTypeId m_parent;     // superclass symbol, or MLE_TYPE_NONE
+    MleTypeId m_child;      // first subclass symbol
+    MleTypeId m_sibling;    // next subclass of m_parent
+    MleTypeId m_root;       // root class of the hierarchy
+    int m_enter;            // pre-order number
+    int m_exit;             // largest pre-order number in the subtree
+    MleTypeSymbolDict *m_names; // a root's name table, otherwise NULL
+};
+
+/**
+ * MleTypeSymbol is the table of interned class names of the actor,
+ * role, set, stage, scene, group and media reference class hierarchies.
+ *
+ * Each class interns its name, together with its superclass symbol,
+ * when it is initialized.  Every root class has a name table of its
+ * own, so a name is only looked up within the hierarchy it belongs to:
+ * an actor class and a role class of the same name get different
+ * symbols, and neither lands in the other's tree.  The symbols
+ * themselves are numbered in one array, so a class is never derived
+ * from a class of another hierarchy.  The table numbers the resulting class forest
+ * in pre-order, recording for every class the range of numbers its
+ * subclasses occupy, so testing whether one class is derived from
+ * another costs two integer compares regardless of the depth of the
+ * hierarchy.  The table is renumbered whenever a class is added, which
+ * only happens while classes are being initialized.
+ */
+class MLE_RUNTIME_API MleTypeSymbol
+{
+  public:
+
+    /**
+     * @brief Intern a class name.
+     *
+     * If the name has already been interned in the parent's hierarchy,
+     * or as a root class when parent is MLE_TYPE_NONE, its existing
+     * symbol is returned.
+     *
+     * @param name The class name.
+     * @param parent The symbol of the superclass, or MLE_TYPE_NONE
+     * for a root class.
+     *
+     * @return The symbol for the name.
+     */
+    static MleTypeId intern(const char *name, MleTypeId parent);
+
+    /**
+     * @brief Look up a class name.
+     *
+     * @param name The class name.
+     * @param hierarchy The symbol of any class of the hierarchy to
+     * search, or MLE_TYPE_NONE to search the root classes.
+     *
+     * @return The symbol for the name, or MLE_TYPE_NONE if it has
+     * not been interned there.
+     */
+    static MleTypeId find(const char *name, MleTypeId hierarchy = MLE_TYPE_NONE);
+
+    /**
+     * @brief Get the name of a symbol.
+     */
+    static const char *getName(MleTypeId type);
+
+    /**
+     * @brief Get the superclass symbol of a symbol.
+     */
+    static MleTypeId getParent(MleTypeId type);
+
+    /**
+     * @brief Get the number of interned symbols.
+     */
+    static int getNumSymbols(void);
+
+    /**
+     * @brief Determine whether a class is, or is derived from, another.
+     *
+     * Either argument may be MLE_TYPE_NONE, in which case the result is
+     * FALSE.
+     *
+     * @param type The symbol of the class being tested.
+     * @param ancestor The symbol of the candidate superclass.
+     */
+    static inline MlBoolean isa(MleTypeId type, MleTypeId ancestor);
+
+  private:
+
+    // The symbol array, indexed by MleTypeId.  Entry 0 is a sentinel
+    // whose range is empty.
+    static MleTypeSymbolEntry *g_symbols;
+    static int g_numSymbols;
+    static int g_maxSymbols;
+
+    // Recompute the pre-order ranges of every symbol.
+    static void renumber(void);
+};
+
+
+// Define inline methods.
+
+inline MlBoolean MleTypeSymbol::isa(MleTypeId type, MleTypeId ancestor)
+{
+    // The sentinel's m_enter is larger than any m_exit and its m_exit
+    // smaller than any m_enter, so MLE_TYPE_NONE never matches.
+    int enter = g_symbols[type].m_enter;
+    return (g_symbols[ancestor].m_enter <= enter) &&
+        (enter <= g_symbols[ancestor].m_exit);
+}
+
+#endif /* __MLE_TYPESYMBOL_H_ */
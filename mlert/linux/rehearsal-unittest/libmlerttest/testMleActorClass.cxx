@@ -39,6 +39,7 @@
 
 // Include Magic Lantern header files.
 #include "mle/MleActor.h"
+#include "mle/DwpDataUnion.h"
 #include "mle/DwpInt.h"
 #include "mle/DwpString.h"
 #include "mle/DwpIntArray.h"
@@ -235,3 +236,142 @@ TEST(MleActorClassTest, RegisterActorClass) {
 	const MleActorMember *idMember = tActorClass->findMember("id");
 	ASSERT_TRUE(idMember == NULL); // id Property is not registered by TestActor initClass()
 }
+
+TEST(MleActorClassTest, InheritMember) {
+    // This test is named "InheritMember", and belongs to the "MleActorClassTest"
+    // test case.
+
+    // The classes are owned by the registry once constructed.
+    TestActorClass *baseClass = new TestActorClass("TestInheritBase", _mlCreateTestActor, "MleActor");
+    TestActorClass *derivedClass = new TestActorClass("TestInheritDerived", _mlCreateTestActor, "TestInheritBase");
+    ASSERT_TRUE(derivedClass->getSuperclass() == baseClass);
+
+    MlePropertyEntry *idEntry = new MlePropertyEntry();
+    idEntry->name = "id";
+    baseClass->addMember("id", "int", idEntry);
+    MlePropertyEntry *textEntry = new MlePropertyEntry();
+    textEntry->name = "text";
+    derivedClass->addMember("text", "string", textEntry);
+
+    // Inherited members are shared with the superclass, not copied.
+    const MleActorMember *idMember = derivedClass->findMember("id");
+    ASSERT_TRUE(idMember != NULL);
+    EXPECT_EQ(baseClass->findMember("id"), idMember);
+    EXPECT_TRUE(baseClass->findMember("text") == NULL);
+    EXPECT_TRUE(derivedClass->findMember("missing") == NULL);
+
+    // Members added to the superclass later are still seen.
+    MlePropertyEntry *ageEntry = new MlePropertyEntry();
+    ageEntry->name = "age";
+    baseClass->addMember("age", "IntArray", ageEntry);
+    ASSERT_TRUE(derivedClass->findMember("age") != NULL);
+    EXPECT_EQ(ageEntry, derivedClass->findMember("age")->getEntry());
+
+    // A local member overrides an inherited one of the same name.
+    MlePropertyEntry *overrideEntry = new MlePropertyEntry();
+    overrideEntry->name = "id";
+    derivedClass->addMember("id", "int", overrideEntry);
+    EXPECT_EQ(overrideEntry, derivedClass->findMember("id")->getEntry());
+    EXPECT_EQ(idEntry, baseClass->findMember("id")->getEntry());
+
+    // Iteration covers local and inherited members once each.
+    int count = 0;
+    MleActorMemberIter iter(derivedClass);
+    while (iter.getMember() != NULL) {
+        EXPECT_EQ(derivedClass->findMember(iter.getName()), iter.getMember());
+        count++;
+        iter.next();
+    }
+    EXPECT_EQ(3, count);
+}
+
+TEST(MleActorClassTest, TransformMembers) {
+    // This test is named "TransformMembers", and belongs to the "MleActorClassTest"
+    // test case.
+
+	TestActor *tActor = (TestActor *)_mlCreateTestActor();
+	ASSERT_TRUE(tActor != NULL);
+	tActor->initClass();
+	const MleActorClass *tActorClass = tActor->getClass();
+	ASSERT_TRUE(tActorClass != NULL);
+
+	// The well-known members are resolved against their datatypes.
+	const MleActorTransformMembers *tm = tActorClass->getTransformMembers();
+	ASSERT_TRUE(tm != NULL);
+	EXPECT_EQ(tActorClass->findMember("position"), tm->m_position3);
+	EXPECT_TRUE(tm->m_position2 == NULL);
+	EXPECT_EQ(tActorClass->findMember("orientation"), tm->m_orientation);
+	EXPECT_TRUE(tm->m_transform == NULL);
+	EXPECT_TRUE(tm->m_capabilities & MLE_ACTOR_TRANSLATION);
+	EXPECT_TRUE(tm->m_capabilities & MLE_ACTOR_ROTATION);
+	EXPECT_EQ(tm->m_capabilities, tActor->hasTransform());
+
+	// The cached members are reused until members change.
+	EXPECT_EQ(tm, tActorClass->getTransformMembers());
+	EXPECT_EQ(tm->m_position3, tActorClass->getTransformMembers()->m_position3);
+}
+
+TEST(MleActorClassTest, PropertyPlans) {
+    // This test is named "PropertyPlans", and belongs to the "MleActorClassTest"
+    // test case.
+
+    TestActorClass *actorClass = new TestActorClass("TestPlanActor", _mlCreateTestActor, "MleActor");
+    MlePropertyEntry *idEntry = new MlePropertyEntry();
+    idEntry->name = "id";
+    idEntry->getProperty = TestActor::getProperty;
+    idEntry->setProperty = TestActor::setProperty;
+    actorClass->addMember("id", "int", idEntry);
+
+    // Two templates setting the same property to different values;
+    // they are only used as keys.
+    int firstTemplate, secondTemplate;
+    const MleDwpInt *intType = (const MleDwpInt *) actorClass->findMember("id")->getType();
+    MleDwpDataUnion firstValue, secondValue;
+    int value = 7;
+    intType->set(&firstValue, &value);
+    value = 8;
+    intType->set(&secondValue, &value);
+
+    EXPECT_TRUE(actorClass->findPlan(&firstTemplate) == NULL);
+    MleActorPlan *firstPlan = new MleActorPlan(actorClass, 2);
+    EXPECT_EQ(0, firstPlan->addProperty("id", &firstValue));
+    EXPECT_NE(0, firstPlan->addProperty("missing", &firstValue));
+    EXPECT_EQ(1, firstPlan->getNumSteps());
+    actorClass->addPlan(&firstTemplate, firstPlan);
+    MleActorPlan *secondPlan = new MleActorPlan(actorClass, 1);
+    EXPECT_EQ(0, secondPlan->addProperty("id", &secondValue));
+    actorClass->addPlan(&secondTemplate, secondPlan);
+
+    // The plans are reused, and keep their own copies of the values.
+    value = 9;
+    intType->set(&firstValue, &value);
+    TestActor *tActor = (TestActor *) actorClass->createInstance();
+    ASSERT_TRUE(tActor != NULL);
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(firstPlan, actorClass->findPlan(&firstTemplate));
+        actorClass->findPlan(&firstTemplate)->apply(tActor);
+        EXPECT_EQ(7, tActor->id);
+        EXPECT_EQ(secondPlan, actorClass->findPlan(&secondTemplate));
+        actorClass->findPlan(&secondTemplate)->apply(tActor);
+        EXPECT_EQ(8, tActor->id);
+    }
+
+    // Releasing or fetching a workprint invalidates every plan.
+    MleActorClass::invalidatePlans();
+    EXPECT_TRUE(actorClass->findPlan(&firstTemplate) == NULL);
+    EXPECT_TRUE(actorClass->findPlan(&secondTemplate) == NULL);
+
+    // So does a change to the members of any Actor class.
+    firstPlan = new MleActorPlan(actorClass, 1);
+    EXPECT_EQ(0, firstPlan->addProperty("id", &firstValue));
+    actorClass->addPlan(&firstTemplate, firstPlan);
+    EXPECT_EQ(firstPlan, actorClass->findPlan(&firstTemplate));
+    MlePropertyEntry *textEntry = new MlePropertyEntry();
+    textEntry->name = "text";
+    textEntry->getProperty = TestActor::getProperty;
+    textEntry->setProperty = TestActor::setProperty;
+    actorClass->addMember("text", "string", textEntry);
+    EXPECT_TRUE(actorClass->findPlan(&firstTemplate) == NULL);
+
+    delete tActor;
+}
@@ -65,6 +65,11 @@ class TestActor : public MleActor
   public:
 
     TestActor();
+
+    // Copy the actor for clone(), duplicating its text.
+    TestActor(const TestActor &actor);
+    MLE_ACTOR_COPIES_DYNAMIC_PROPERTIES(TestActor)
+
     virtual ~TestActor();
 };
 
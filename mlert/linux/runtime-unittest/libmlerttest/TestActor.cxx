@@ -61,6 +61,24 @@ TestActor::TestActor()
 }
 
 
+TestActor::TestActor(const TestActor &actor)
+  : MleActor(actor),
+    id(actor.id),
+    text(NULL),
+    age(actor.age),
+    length(actor.length),
+    position(actor.position),
+    orientation(actor.orientation)
+{
+	if (actor.text != NULL)
+	{
+		size_t size = strlen(actor.text) + 1;
+		text = (char *)mlMalloc(size);
+		memcpy(text, actor.text, size);
+	}
+}
+
+
 TestActor::~TestActor()
 {}
 
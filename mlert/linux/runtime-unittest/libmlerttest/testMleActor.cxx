@@ -33,6 +33,7 @@
 
 // Include system header files.
 #include <iostream>
+#include <stdio.h>
 
 // Include Google Test header files.
 #include "gtest/gtest.h"
@@ -40,6 +41,7 @@
 // Include Magic Lantern header files.
 #include "mle/MleActor.h"
 #include "mle/MleRole.h"
+#include "mle/MleSet.h"
 #include "mle/MleTables.h"
 
 // Include Magic Lantern Runtime unit test header files.
@@ -50,6 +52,29 @@ extern MleActor *_mlCreateTestActor(void);
 using namespace std;
 
 
+// Two subclasses of TestActor, for the dirty bits.
+class TestActorA : public TestActor
+{
+    MLE_ACTOR_HEADER(TestActorA);
+
+  public:
+
+    MLE_ACTOR_PROPERTY(int, weight, getWeightProperty, setWeightProperty)
+};
+
+class TestActorB : public TestActor
+{
+    MLE_ACTOR_HEADER(TestActorB);
+
+  public:
+
+    MLE_ACTOR_PROPERTY(int, height, getHeightProperty, setHeightProperty)
+};
+
+MLE_ACTOR_SOURCE(TestActorA, TestActor);
+MLE_ACTOR_SOURCE(TestActorB, TestActor);
+
+
 TEST(MleActorTest, DefaultConstructor) {
     // This test is named "DefaultConstructor", and belongs to the "MleActorTest"
     // test case.
@@ -242,3 +267,164 @@ TEST(MleActorTest, TestActorProperties) {
     EXPECT_FLOAT_EQ(1.0f, pos[1]);
     EXPECT_FLOAT_EQ(0.5f, pos[2]);
 }
+
+
+TEST(MleActorTest, DirtyMask) {
+    // This test is named "DirtyMask", and belongs to the "MleActorTest"
+    // test case.
+
+	TestActor *tActor = new TestActor();
+    ASSERT_TRUE(tActor != NULL);
+    EXPECT_FALSE(tActor->isDirty());
+
+    // Each property of a class has its own bit.
+    EXPECT_NE(TestActor::idDirtyMask(), TestActor::textDirtyMask());
+    EXPECT_NE(TestActor::idDirtyMask(), TestActor::ageDirtyMask());
+    EXPECT_EQ(TestActor::idDirtyMask(),
+        MleActor::getPropertyDirtyMask(TestActor::dirtyClass(), "id"));
+
+    tActor->setIdProperty(5);
+    tActor->setTextProperty("Hello World!", 13);
+    EXPECT_EQ(TestActor::idDirtyMask() | TestActor::textDirtyMask(),
+        tActor->getDirtyMask());
+    EXPECT_TRUE(tActor->isDirty(TestActor::textDirtyMask()));
+    EXPECT_FALSE(tActor->isDirty(TestActor::ageDirtyMask()));
+
+    // Clearing returns the bits that were dirty.
+    EXPECT_EQ(TestActor::idDirtyMask(), tActor->clearDirty(TestActor::idDirtyMask()));
+    EXPECT_EQ(TestActor::textDirtyMask(), tActor->getDirtyMask());
+    tActor->clearDirty();
+    EXPECT_FALSE(tActor->isDirty());
+
+    delete tActor;
+}
+
+TEST(MleActorTest, DirtyMaskPerClass) {
+    // This test is named "DirtyMaskPerClass", and belongs to the "MleActorTest"
+    // test case.
+
+    // A subclass's properties take bits its superclass does not use.
+    MleDirtyMask weight = TestActorA::weightDirtyMask();
+    MleDirtyMask inherited = TestActor::idDirtyMask() |
+        TestActor::textDirtyMask() | TestActor::ageDirtyMask();
+    EXPECT_EQ(0u, weight & inherited);
+
+    // Classes that are not related may share bits.
+    MleDirtyMask height = TestActorB::heightDirtyMask();
+    EXPECT_EQ(0u, height & inherited);
+    EXPECT_EQ(weight, height);
+
+    // A class has MLE_DIRTY_BITS bits to give out.  The names are kept,
+    // so they must stay put.
+    static MleDirtyClass record(NULL);
+    static char names[MLE_DIRTY_BITS][8];
+    MleDirtyMask all = 0;
+    for (int i = 0; i < (int) MLE_DIRTY_BITS; i++)
+    {
+        sprintf(names[i], "p%d", i);
+        MleDirtyMask mask = MleActor::getPropertyDirtyMask(&record, names[i]);
+        EXPECT_EQ(0u, mask & all);
+        all |= mask;
+    }
+    EXPECT_EQ(MLE_DIRTY_ALL, all);
+    EXPECT_EQ(1u, MleActor::getPropertyDirtyMask(&record, "p0"));
+
+    // TestActorA still has its own bit.
+    EXPECT_EQ(weight, MleActor::getPropertyDirtyMask(TestActorA::dirtyClass(), "weight"));
+}
+
+
+TEST(MleActorTest, DirtyActors) {
+    // This test is named "DirtyActors", and belongs to the "MleActorTest"
+    // test case.
+
+	MleSet *set = new MleSet();
+	MleSet::g_currentSet = set;
+
+	TestActor *actor0 = new TestActor();
+	TestActor *actor1 = new TestActor();
+	TestActor *actor2 = new TestActor();
+
+	// A property set before the role exists is picked up by attachRole().
+	actor0->setIdProperty(1);
+	new MleRole(actor0);
+	new MleRole(actor1);
+	new MleRole(actor2);
+	EXPECT_EQ(1, set->getNumDirtyActors());
+
+	// Actors are listed once, in the order they became dirty.
+	actor2->setIdProperty(2);
+	actor1->setIdProperty(3);
+	actor1->setTextProperty("Hello World!", 13);
+	EXPECT_EQ(3, set->getNumDirtyActors());
+	EXPECT_EQ(actor0, set->getDirtyActors());
+	EXPECT_EQ(actor2, actor0->getNextDirtyActor());
+	EXPECT_EQ(actor1, actor2->getNextDirtyActor());
+	EXPECT_TRUE(actor1->getNextDirtyActor() == NULL);
+
+	// Deleting or fully cleaning an actor unlinks it.
+	delete actor2;
+	EXPECT_EQ(2, set->getNumDirtyActors());
+	EXPECT_EQ(actor1, actor0->getNextDirtyActor());
+	actor1->clearDirty(TestActor::idDirtyMask());
+	EXPECT_EQ(2, set->getNumDirtyActors());
+	actor0->clearDirty();
+	EXPECT_EQ(1, set->getNumDirtyActors());
+	EXPECT_EQ(actor1, set->getDirtyActors());
+
+	set->clearDirtyActors();
+	EXPECT_EQ(0, set->getNumDirtyActors());
+	EXPECT_TRUE(set->getDirtyActors() == NULL);
+	EXPECT_FALSE(actor1->isDirty());
+
+	MleSet::g_currentSet = NULL;
+	delete actor0;
+	delete actor1;
+	delete set;
+}
+
+
+TEST(MleActorTest, AdoptProperties) {
+    // This test is named "AdoptProperties", and belongs to the "MleActorTest"
+    // test case.
+
+	TestActor *tActor = new TestActor();
+    ASSERT_TRUE(tActor != NULL);
+
+    // A dynamic property takes the buffer itself.
+    char *text = (char *)mlMalloc(13);
+    strcpy(text, "Hello World!");
+    tActor->textAdopt(text);
+    EXPECT_EQ(text, tActor->text);
+    EXPECT_TRUE(tActor->isDirty(TestActor::textDirtyMask()));
+
+    // An array property swaps contents with its argument.
+    MleArray<int> birthdays(2);
+    birthdays[0] = 15;
+    birthdays[1] = 19;
+    int size = tActor->age.size();
+    tActor->ageAdopt(birthdays);
+    EXPECT_EQ(2, tActor->age.size());
+    EXPECT_EQ(19, tActor->age[1]);
+    EXPECT_EQ(size, birthdays.size());
+
+    // The loader hands buffers over through the table entries.
+    MleRTPropertyEntry *textEntry = &mlRTActorProperties[1];
+    ASSERT_TRUE(textEntry->adoptProperty != NULL);
+    text = (char *)mlMalloc(16);
+    strcpy(text, "Hello Colorado!");
+    textEntry->adoptProperty(tActor, (unsigned char *)text, 16);
+    EXPECT_EQ(text, tActor->getTextProperty());
+
+    // An array property is handed its elements, which it copies into
+    // an array of its own.
+    MleRTPropertyEntry *ageEntry = &mlRTActorProperties[2];
+    ASSERT_TRUE(ageEntry->adoptProperty != NULL);
+    int elements[3] = { 15, 19, 51 };
+    ageEntry->adoptProperty(tActor, (unsigned char *)elements, 3);
+    elements[2] = 0;
+    EXPECT_EQ(3, tActor->age.size());
+    EXPECT_EQ(51, tActor->age[2]);
+
+    delete tActor;
+}
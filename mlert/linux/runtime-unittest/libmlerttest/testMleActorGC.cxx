@@ -0,0 +1,284 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <iostream>
+#include <string.h>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleActorGC.h"
+#include "mle/MleOpcode.h"
+#include "mle/MleRole.h"
+#include "mle/MleSet.h"
+#include "mle/MleTables.h"
+
+// Include Magic Lantern Runtime unit test header files.
+#include "TestActor.h"
+
+using namespace std;
+
+
+// Defined by MLE_ACTOR_SOURCE.
+extern MleActor *_mlCreateTestActor(void);
+
+static MleRole *createTestRole(MleActor *actor)
+{
+    return new MleRole(actor);
+}
+
+// A set that remembers the attachments made to it.
+class TestAttachSet : public MleSet
+{
+  public:
+
+    TestAttachSet(void) : m_numAttached(0), m_numChildren(0),
+        m_lastParent(NULL), m_lastChild(NULL) {}
+
+    virtual void attach(MleRole *parent, MleRole *child)
+    {
+        if (parent)
+        {
+            m_numChildren++;
+            m_lastParent = parent;
+            m_lastChild = child;
+        }
+        else
+            m_numAttached++;
+    }
+
+    int m_numAttached;
+    int m_numChildren;
+    MleRole *m_lastParent;
+    MleRole *m_lastChild;
+};
+
+// A visitor that records what the decoder hands it.
+class TestRecordingVisitor : public MleChunkVisitor
+{
+  public:
+
+    TestRecordingVisitor(void) : m_numActors(0), m_numRoles(0),
+        m_parent(-1), m_child(-1), m_property(NULL), m_value(NULL),
+        m_length(0), m_numElements(0), m_mediaRef(-1) {}
+
+    virtual void createActor(int /*classIndex*/) { m_numActors++; }
+    virtual void bindRole(int setIndex, int /*roleIndex*/)
+    { m_numRoles++; m_setIndex = setIndex; }
+    virtual void attachRole(int parentIndex, int childIndex)
+    { m_parent = parentIndex; m_child = childIndex; }
+    virtual void setProperty(MlePropertyEntry *propertyEntry,
+        unsigned char *value, int length)
+    { m_property = propertyEntry; m_value = value; m_length = length; }
+    virtual void setDynamicProperty(MlePropertyEntry *, unsigned char *, int) {}
+    virtual void setArrayProperty(MlePropertyEntry *, unsigned char *,
+        int numElements, int elementLength)
+    { m_numElements = numElements; m_length = elementLength; }
+    virtual void setMediaRef(MlePropertyEntry *, int mrefIndex) { m_mediaRef = mrefIndex; }
+
+    int m_numActors;
+    int m_numRoles;
+    int m_setIndex;
+    int m_parent;
+    int m_child;
+    MlePropertyEntry *m_property;
+    unsigned char *m_value;
+    int m_length;
+    int m_numElements;
+    int m_mediaRef;
+};
+
+// Append an index: 7-bit groups, most significant first.
+static unsigned char *putIndex(unsigned char *p, int value)
+{
+    int shift = 28;
+    while ((shift > 0) && ((value >> shift) == 0))
+        shift -= 7;
+    for (; shift >= 0; shift -= 7)
+        *p++ = (unsigned char) ((value >> shift) & 0x7f);
+    return p;
+}
+
+
+TEST(MleActorGCTest, ReadIndex) {
+    // This test is named "ReadIndex", and belongs to the "MleActorGCTest"
+    // test case.
+
+    // Each index is ended by the following opcode byte.
+    const int values[] = { 0, 1, 127, 128, 129, 300, 16383, 16384, 1 << 20, 0x7fffffff };
+    const int numValues = sizeof(values) / sizeof(values[0]);
+
+    unsigned char stream[128];
+    unsigned char *p = stream;
+    for (int i = 0; i < numValues; i++)
+    {
+        p = putIndex(p, values[i]);
+        *p++ = endActorGroupOpcode;
+    }
+    unsigned char *end = p;
+
+    p = stream;
+    for (int i = 0; i < numValues; i++)
+    {
+        EXPECT_EQ(values[i], readIndex(p, stream, end));
+
+        // The opcode is left for the caller.
+        EXPECT_EQ(endActorGroupOpcode, *p);
+        p++;
+    }
+    EXPECT_EQ(end, p);
+}
+
+TEST(MleActorGCTest, DecodeStream) {
+    // This test is named "DecodeStream", and belongs to the "MleActorGCTest"
+    // test case.
+
+    mlRTActorClassLength = 1;
+    mlRTRoleClassLength = 1;
+
+    // Two actors with roles on set 3, the second's role a child of the
+    // first's, then a property, an array and a media reference.
+    int value = 42;
+    unsigned char chunk[64];
+    unsigned char *p = chunk;
+    for (int i = 0; i < 2; i++)
+    {
+        *p++ = createActorOpcode; *p++ = 0;
+        *p++ = setSetOpcode; *p++ = 3;
+        *p++ = bindRoleOpcode; *p++ = 0;
+    }
+    *p++ = parentRoleOpcode; *p++ = 0;
+    *p++ = childRoleOpcode; *p++ = 1;
+    *p++ = setPropertyOffsetOpcode; *p++ = 0;
+    *p++ = setPropertyLengthOpcode; *p++ = sizeof(int);
+    *p++ = copyPropertyOpcode;
+    unsigned char *valuePtr = p;
+    memcpy(p, &value, sizeof(int)); p += sizeof(int);
+    int numElements = 2;
+    *p++ = copyArrayPropertyOpcode;
+    memcpy(p, &numElements, sizeof(int)); p += sizeof(int);
+    memcpy(p, &value, sizeof(int)); p += sizeof(int);
+    memcpy(p, &value, sizeof(int)); p += sizeof(int);
+    *p++ = copyMediaRefOpcode; *p++ = 5;
+    *p++ = endActorGroupOpcode;
+
+    TestRecordingVisitor visitor;
+    unsigned char *streamPtr = chunk;
+    decodeStream(&visitor, streamPtr, chunk, p, MLE_CHUNK_GROUP);
+    EXPECT_EQ(p, streamPtr);
+
+    EXPECT_EQ(2, visitor.m_numActors);
+    EXPECT_EQ(2, visitor.m_numRoles);
+    EXPECT_EQ(3, visitor.m_setIndex);
+    EXPECT_EQ(0, visitor.m_parent);
+    EXPECT_EQ(1, visitor.m_child);
+
+    // Values are handed over in place in the chunk.
+    EXPECT_EQ(&mlRTActorProperties[0], visitor.m_property);
+    EXPECT_EQ(valuePtr, visitor.m_value);
+    EXPECT_EQ(2, visitor.m_numElements);
+    EXPECT_EQ((int) sizeof(int), visitor.m_length);
+    EXPECT_EQ(5, visitor.m_mediaRef);
+
+    mlRTActorClassLength = 0;
+    mlRTRoleClassLength = 0;
+}
+
+TEST(MleActorGCTest, ChildRoleAttachment) {
+    // This test is named "ChildRoleAttachment", and belongs to the "MleActorGCTest"
+    // test case.
+
+    // Borrow the first actor, role and set entries.
+    TestAttachSet *set = new TestAttachSet();
+    mlRTActorClass[0].constructor = _mlCreateTestActor;
+    mlRTActorClassLength = 1;
+    mlRTRoleClass[0].constructor = createTestRole;
+    mlRTRoleClassLength = 1;
+    mlRTSet[0].ptr = set;
+    mlRTSetLength = 1;
+
+    // A group of 130 actors, each with a role on the set.  The second
+    // actor's role is a child of the first, and, so that the indices
+    // take more than one byte, the last actor's role is a child of the
+    // one before it.
+    const int numActors = 130;
+    unsigned char chunk[1024];
+    unsigned char *p = chunk;
+    for (int i = 0; i < numActors; i++)
+    {
+        *p++ = createActorOpcode; *p++ = 0;
+        *p++ = setSetOpcode; *p++ = 0;
+        *p++ = bindRoleOpcode; *p++ = 0;
+        if ((i == 1) || (i == numActors - 1))
+        {
+            *p++ = parentRoleOpcode; p = putIndex(p, i - 1);
+            *p++ = childRoleOpcode; p = putIndex(p, i);
+        }
+    }
+    *p++ = endActorGroupOpcode;
+
+    MleLoadContext context;
+    chunkInitialization(&context, numActors);
+    unsigned char *streamPtr = chunk;
+    parseStream(&context, streamPtr, chunk, p, MLE_CHUNK_GROUP);
+    ASSERT_EQ(numActors, context.m_numActors);
+
+    // The child roles were attached to their parents as they were read.
+    EXPECT_EQ(2, set->m_numChildren);
+    EXPECT_EQ(0, set->m_numAttached);
+    EXPECT_EQ(context.m_registry[numActors - 2].m_actor->getRole(), set->m_lastParent);
+    EXPECT_EQ(context.m_registry[numActors - 1].m_actor->getRole(), set->m_lastChild);
+    EXPECT_EQ(set->m_lastParent, set->m_lastChild->m_parent);
+    EXPECT_NE(0, context.m_attached[1]);
+    EXPECT_NE(0, context.m_attached[numActors - 1]);
+
+    // The rest are left for the caller to put on the set.
+    for (int i = 0; i < numActors; i++)
+        attachGroupRole(&context, i);
+    EXPECT_EQ(numActors - 2, set->m_numAttached);
+    EXPECT_EQ(2, set->m_numChildren);
+
+    for (int i = 0; i < numActors; i++)
+        delete context.m_registry[i].m_actor;
+    releaseLoadContext(&context);
+
+    mlRTActorClass[0].constructor = NULL;
+    mlRTActorClassLength = 0;
+    mlRTRoleClass[0].constructor = NULL;
+    mlRTRoleClassLength = 0;
+    mlRTSet[0].ptr = NULL;
+    mlRTSetLength = 0;
+    delete set;
+}
@@ -0,0 +1,101 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+#include "mle/MleArena.h"
+
+using namespace std;
+
+
+TEST(MleArenaTest, AllocateAndFree) {
+    // This test is named "AllocateAndFree", and belongs to the "MleArenaTest"
+    // test case.
+
+    MleArena *arena = new MleArena(3 * MleArena::align(24));
+
+    void *a = arena->allocate(24);
+    void *b = arena->allocate(20);
+    void *c = arena->allocate(17);
+    ASSERT_TRUE(a != NULL && b != NULL && c != NULL);
+    EXPECT_EQ(0u, (size_t) a % MLE_ARENA_ALIGNMENT);
+    EXPECT_EQ(0u, (size_t) b % MLE_ARENA_ALIGNMENT);
+    EXPECT_EQ(MleArena::align(24), (size_t) ((char *) b - (char *) a));
+
+    // The arena is full.
+    EXPECT_TRUE(arena->allocate(1) == NULL);
+
+    // Other memory is left to the caller.
+    void *heap = mlMalloc(16);
+    EXPECT_FALSE(MleArena::free(heap));
+    mlFree(heap);
+
+    // The arena outlives release() until its allocations are freed,
+    // in any order.
+    arena->release();
+    EXPECT_TRUE(MleArena::free(b));
+    EXPECT_TRUE(MleArena::free(a));
+    EXPECT_TRUE(MleArena::free(c));
+}
+
+
+TEST(MleArenaTest, ManyArenas) {
+    // This test is named "ManyArenas", and belongs to the "MleArenaTest"
+    // test case.
+
+    // Each allocation is found in its own arena.
+    MleArena *arenas[32];
+    void *items[32];
+    for (int i = 0; i < 32; i++)
+    {
+        arenas[i] = new MleArena(64);
+        items[i] = arenas[i]->allocate(64);
+        ASSERT_TRUE(items[i] != NULL);
+        arenas[i]->release();
+    }
+
+    for (int i = 0; i < 32; i += 2)
+        EXPECT_TRUE(MleArena::free(items[i]));
+    for (int i = 31; i > 0; i -= 2)
+        EXPECT_TRUE(MleArena::free(items[i]));
+
+    // An arena with nothing allocated goes on release().
+    MleArena *empty = new MleArena(64);
+    empty->release();
+}
@@ -0,0 +1,126 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <stdlib.h>
+#include <string.h>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleChunkCodec.h"
+
+using namespace std;
+
+
+TEST(MleChunkCodecTest, RoundTrip) {
+    // This test is named "RoundTrip", and belongs to the "MleChunkCodecTest"
+    // test case.
+
+    // Repetitive contents, like a group of similar actors.
+    const size_t length = 4096;
+    unsigned char *contents = new unsigned char[length];
+    for (size_t i = 0; i < length; i++)
+        contents[i] = (unsigned char) ((i % 24) < 16 ? i % 7 : i);
+
+    unsigned char *packed = new unsigned char[MleChunkCodec::getCompressedBound(length)];
+    size_t packedLength = MleChunkCodec::compress(contents, length, packed);
+    EXPECT_LT(packedLength, length / 2);
+    EXPECT_EQ(length, MleChunkCodec::getUncompressedLength(packed, packedLength));
+    EXPECT_LE(length, MleChunkCodec::getUncompressedBound(packedLength));
+
+    unsigned char *unpacked = new unsigned char[length];
+    EXPECT_TRUE(MleChunkCodec::decompress(packed, packedLength, unpacked));
+    EXPECT_EQ(0, memcmp(contents, unpacked, length));
+
+    delete [] unpacked;
+    delete [] packed;
+    delete [] contents;
+}
+
+
+TEST(MleChunkCodecTest, Incompressible) {
+    // This test is named "Incompressible", and belongs to the "MleChunkCodecTest"
+    // test case.
+
+    unsigned char contents[1000];
+    srand(1);
+    for (size_t i = 0; i < sizeof(contents); i++)
+        contents[i] = (unsigned char) rand();
+
+    // Random contents grow a little, but stay within the bound.
+    unsigned char packed[sizeof(contents) + 64];
+    ASSERT_LE(MleChunkCodec::getCompressedBound(sizeof(contents)), sizeof(packed));
+    size_t packedLength = MleChunkCodec::compress(contents, sizeof(contents), packed);
+    EXPECT_LE(packedLength, MleChunkCodec::getCompressedBound(sizeof(contents)));
+
+    unsigned char unpacked[sizeof(contents)];
+    EXPECT_TRUE(MleChunkCodec::decompress(packed, packedLength, unpacked));
+    EXPECT_EQ(0, memcmp(contents, unpacked, sizeof(contents)));
+
+    // Short contents are all literals.
+    packedLength = MleChunkCodec::compress((const unsigned char *) "abcd", 4, packed);
+    EXPECT_TRUE(MleChunkCodec::decompress(packed, packedLength, unpacked));
+    EXPECT_EQ(0, memcmp("abcd", unpacked, 4));
+}
+
+
+TEST(MleChunkCodecTest, Damaged) {
+    // This test is named "Damaged", and belongs to the "MleChunkCodecTest"
+    // test case.
+
+    unsigned char contents[256];
+    memset(contents, 'x', sizeof(contents));
+    unsigned char packed[sizeof(contents) + 64];
+    size_t packedLength = MleChunkCodec::compress(contents, sizeof(contents), packed);
+
+    unsigned char unpacked[sizeof(contents)];
+
+    // Truncated blocks and preambles are rejected.
+    EXPECT_FALSE(MleChunkCodec::decompress(packed, packedLength - 1, unpacked));
+    EXPECT_FALSE(MleChunkCodec::decompress(packed, 3, unpacked));
+    EXPECT_EQ(0u, MleChunkCodec::getUncompressedLength(packed, 3));
+
+    // So is a block that decodes to less than the recorded length.
+    unsigned int longer = sizeof(contents) + 1;
+    memcpy(packed, &longer, sizeof(longer));
+    EXPECT_FALSE(MleChunkCodec::decompress(packed, packedLength, unpacked));
+
+    // A preamble can record more than any block could decode to; the
+    // loader checks the bound before allocating.
+    unsigned int huge = 0x7fffffff;
+    memcpy(packed, &huge, sizeof(huge));
+    EXPECT_GT(MleChunkCodec::getUncompressedLength(packed, packedLength),
+        MleChunkCodec::getUncompressedBound(packedLength));
+}
@@ -0,0 +1,94 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include <stdio.h>
+#include <string.h>
+
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleChunkMap.h"
+
+using namespace std;
+
+
+TEST(MleChunkMapTest, MapFile) {
+    // This test is named "MapFile", and belongs to the "MleChunkMapTest"
+    // test case.
+
+    const char contents[] = "tag len chunk contents";
+    FILE *fp = tmpfile();
+    ASSERT_TRUE(fp != NULL);
+    fwrite(contents, 1, sizeof(contents), fp);
+    fflush(fp);
+    fseek(fp, 4, SEEK_SET);
+
+    MleChunkMap *map = new MleChunkMap();
+    EXPECT_FALSE(map->isMapped());
+    EXPECT_TRUE(map->getAddress(0, 1) == NULL);
+
+    if (! map->map(fp))
+    {
+        // Mapping is unsupported here; the loaders read instead.
+        delete map;
+        fclose(fp);
+        return;
+    }
+
+    // Mapping leaves the file position alone.
+    EXPECT_EQ(4, ftell(fp));
+    EXPECT_EQ(sizeof(contents), map->getSize());
+
+    unsigned char *chunk = map->getAddress(8, 5);
+    ASSERT_TRUE(chunk != NULL);
+    EXPECT_EQ(0, memcmp(chunk, "chunk", 5));
+    EXPECT_TRUE(map->contains(chunk));
+    EXPECT_FALSE(map->contains(contents));
+
+    // Ranges must lie wholly inside the file.
+    EXPECT_TRUE(map->getAddress(8, sizeof(contents)) == NULL);
+    EXPECT_TRUE(map->getAddress(sizeof(contents) + 1, 0) == NULL);
+
+    map->prefetch(8, 5);
+
+    map->unmap();
+    EXPECT_FALSE(map->isMapped());
+    EXPECT_TRUE(map->getAddress(8, 5) == NULL);
+
+    delete map;
+    fclose(fp);
+}
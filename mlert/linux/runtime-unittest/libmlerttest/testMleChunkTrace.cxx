@@ -0,0 +1,96 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleChunkTrace.h"
+#include "mle/MleOpcode.h"
+
+using namespace std;
+
+
+TEST(MleChunkTraceTest, Disabled) {
+    // This test is named "Disabled", and belongs to the "MleChunkTraceTest"
+    // test case.
+
+    EXPECT_FALSE(MleChunkTrace::isEnabled());
+    MleChunkTrace::record(MLE_TRACE_OPCODE, createActorOpcode, 0, 0);
+    EXPECT_EQ(0, MleChunkTrace::getNumRecords());
+    EXPECT_TRUE(MleChunkTrace::getRecord(0) == NULL);
+}
+
+
+TEST(MleChunkTraceTest, Ring) {
+    // This test is named "Ring", and belongs to the "MleChunkTraceTest"
+    // test case.
+
+    // The capacity is rounded up to four records.
+    MleChunkTrace::enable(3);
+    EXPECT_TRUE(MleChunkTrace::isEnabled());
+
+    for (int i = 0; i < 6; i++)
+        MleChunkTrace::record(MLE_TRACE_INDEX, 0, i, i * 2);
+    ASSERT_EQ(4, MleChunkTrace::getNumRecords());
+
+    // The oldest records have been overwritten.
+    const MleChunkTraceRecord *r = MleChunkTrace::getRecord(0);
+    EXPECT_EQ(MLE_TRACE_INDEX, r->m_kind);
+    EXPECT_EQ(2, r->m_value);
+    EXPECT_EQ(4, r->m_offset);
+    EXPECT_EQ(5, MleChunkTrace::getRecord(3)->m_value);
+
+    MleChunkTrace::clear();
+    EXPECT_EQ(0, MleChunkTrace::getNumRecords());
+    EXPECT_TRUE(MleChunkTrace::isEnabled());
+
+    MleChunkTrace::disable();
+    EXPECT_FALSE(MleChunkTrace::isEnabled());
+    EXPECT_EQ(0, MleChunkTrace::getNumRecords());
+}
+
+
+TEST(MleChunkTraceTest, OpcodeNames) {
+    // This test is named "OpcodeNames", and belongs to the "MleChunkTraceTest"
+    // test case.
+
+    EXPECT_STREQ("beginActorSetOpcode", MleChunkTrace::getOpcodeName(beginActorSetOpcode));
+    EXPECT_STREQ("copyArrayPropertyOpcode", MleChunkTrace::getOpcodeName(copyArrayPropertyOpcode));
+    EXPECT_STREQ("endSetOpcode", MleChunkTrace::getOpcodeName(endSetOpcode));
+    EXPECT_TRUE(MleChunkTrace::getOpcodeName(endSetOpcode + 1) == NULL);
+    EXPECT_TRUE(MleChunkTrace::getOpcodeName(0) == NULL);
+}
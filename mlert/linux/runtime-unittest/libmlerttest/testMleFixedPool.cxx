@@ -0,0 +1,147 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleFixedPool.h"
+
+using namespace std;
+
+struct TestPoolItem
+{
+    int m_value;
+    TestPoolItem *m_next;
+};
+
+TEST(MleFixedPoolTest, GetPut) {
+    // This test is named "GetPut", and belongs to the "MleFixedPoolTest"
+    // test case.
+
+    MleFixedPool<TestPoolItem> *pool = new MleFixedPool<TestPoolItem>(4);
+    MleFixedPoolStats stats;
+
+    // Nothing is allocated until the first item is requested.
+    pool->getStats(stats);
+    EXPECT_EQ(stats.m_numChunks, 0);
+    EXPECT_EQ(stats.m_numBytes, 0);
+
+    TestPoolItem *a = pool->get();
+    TestPoolItem *b = pool->get();
+    EXPECT_TRUE(a != NULL);
+    EXPECT_TRUE(b != NULL);
+    EXPECT_NE(a, b);
+    a->m_value = 1;
+    b->m_value = 2;
+    EXPECT_EQ(pool->getNumLive(), 2);
+
+    // A returned item is handed out again first.
+    pool->put(a);
+    EXPECT_EQ(pool->get(), a);
+
+    pool->put(a);
+    pool->put(b);
+    pool->getStats(stats);
+    EXPECT_EQ(stats.m_live, 0);
+    EXPECT_EQ(stats.m_peak, 2);
+    EXPECT_EQ(stats.m_numChunks, 1);
+    EXPECT_EQ(stats.m_numSlots, 4);
+    EXPECT_GE(stats.m_numBytes, 4 * sizeof(TestPoolItem));
+
+    delete pool;
+}
+
+TEST(MleFixedPoolTest, GeometricGrowth) {
+    // This test is named "GeometricGrowth", and belongs to the "MleFixedPoolTest"
+    // test case.
+
+    MleFixedPool<TestPoolItem> pool(4);
+    MleFixedPoolStats stats;
+    TestPoolItem *items[1000];
+
+    for (int i = 0; i < 1000; i++) {
+        items[i] = pool.get();
+        items[i]->m_value = i;
+    }
+
+    // Chunks of 4, 8, 16, ... 512 hold 1020 items.
+    pool.getStats(stats);
+    EXPECT_EQ(stats.m_live, 1000);
+    EXPECT_EQ(stats.m_numChunks, 8);
+    EXPECT_EQ(stats.m_numSlots, 1020);
+
+    for (int i = 0; i < 1000; i++)
+        EXPECT_EQ(items[i]->m_value, i);
+    for (int i = 0; i < 1000; i++)
+        pool.put(items[i]);
+}
+
+TEST(MleFixedPoolTest, Trim) {
+    // This test is named "Trim", and belongs to the "MleFixedPoolTest"
+    // test case.
+
+    MleFixedPool<TestPoolItem> pool(4);
+    MleFixedPoolStats stats;
+    TestPoolItem *items[28];
+
+    // Fill chunks of 4, 8 and 16 items.
+    for (int i = 0; i < 28; i++)
+        items[i] = pool.get();
+
+    // Nothing can be released while every chunk is in use.
+    EXPECT_EQ(pool.trim(), 0);
+
+    // Keep one item from the first chunk; the others become empty.
+    for (int i = 1; i < 28; i++)
+        pool.put(items[i]);
+    EXPECT_EQ(pool.trim(), 2);
+    pool.getStats(stats);
+    EXPECT_EQ(stats.m_live, 1);
+    EXPECT_EQ(stats.m_numChunks, 1);
+    EXPECT_EQ(stats.m_numSlots, 4);
+
+    // The free list only holds slots from the remaining chunk.
+    for (int i = 1; i < 4; i++) {
+        TestPoolItem *item = pool.get();
+        EXPECT_TRUE((item >= items[0] - 3) && (item <= items[0] + 3));
+    }
+
+    pool.put(items[0]);
+    pool.getStats(stats);
+    EXPECT_EQ(stats.m_live, 3);
+}
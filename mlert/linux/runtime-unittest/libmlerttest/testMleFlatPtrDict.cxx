@@ -0,0 +1,138 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleFlatPtrDict.h"
+
+using namespace std;
+
+// Keys are taken from this array so they look like real object pointers.
+static int g_keys[4096];
+
+TEST(MleFlatPtrDictTest, SetFindRemove) {
+    // This test is named "SetFindRemove", and belongs to the "MleFlatPtrDictTest"
+    // test case.
+
+    MleFlatPtrDict *dict = new MleFlatPtrDict();
+    EXPECT_EQ(dict->getNumEntries(), 0);
+    EXPECT_TRUE(dict->find(&g_keys[0]) == NULL);
+
+    dict->set(&g_keys[0], &g_keys[1]);
+    dict->set(&g_keys[1], &g_keys[2]);
+    EXPECT_EQ(dict->getNumEntries(), 2);
+    EXPECT_EQ(dict->find(&g_keys[0]), &g_keys[1]);
+    EXPECT_EQ(dict->find(&g_keys[1]), &g_keys[2]);
+
+    // Setting an existing key changes its value.
+    dict->set(&g_keys[0], &g_keys[3]);
+    EXPECT_EQ(dict->getNumEntries(), 2);
+    EXPECT_EQ(dict->find(&g_keys[0]), &g_keys[3]);
+
+    dict->remove(&g_keys[0]);
+    EXPECT_EQ(dict->getNumEntries(), 1);
+    EXPECT_TRUE(dict->find(&g_keys[0]) == NULL);
+    EXPECT_EQ(dict->find(&g_keys[1]), &g_keys[2]);
+
+    // Removing a missing key is harmless.
+    dict->remove(&g_keys[0]);
+    EXPECT_EQ(dict->getNumEntries(), 1);
+
+    dict->clear();
+    EXPECT_EQ(dict->getNumEntries(), 0);
+    EXPECT_TRUE(dict->find(&g_keys[1]) == NULL);
+
+    delete dict;
+}
+
+TEST(MleFlatPtrDictTest, GrowAndShrink) {
+    // This test is named "GrowAndShrink", and belongs to the "MleFlatPtrDictTest"
+    // test case.
+
+    MleFlatPtrDict dict(4);
+    int initial = dict.getCapacity();
+
+    for (int i = 0; i < 4096; i++)
+        dict.set(&g_keys[i], &g_keys[4095 - i]);
+    EXPECT_EQ(dict.getNumEntries(), 4096);
+    EXPECT_GT(dict.getCapacity(), initial);
+    EXPECT_LE(dict.getNumEntries() * 8, dict.getCapacity() * 7);
+
+    // Remove every other key and check the survivors are still reachable.
+    for (int i = 0; i < 4096; i += 2)
+        dict.remove(&g_keys[i]);
+    EXPECT_EQ(dict.getNumEntries(), 2048);
+    for (int i = 0; i < 4096; i++) {
+        if (i & 1)
+            EXPECT_EQ(dict.find(&g_keys[i]), &g_keys[4095 - i]);
+        else
+            EXPECT_TRUE(dict.find(&g_keys[i]) == NULL);
+    }
+
+    // Reinsert into the holes left by backward shifting.
+    for (int i = 0; i < 4096; i += 2)
+        dict.set(&g_keys[i], &g_keys[i]);
+    for (int i = 0; i < 4096; i++)
+        EXPECT_EQ(dict.find(&g_keys[i]), (i & 1) ? &g_keys[4095 - i] : &g_keys[i]);
+}
+
+// A dictionary whose keys all land in the same home slot.
+class CollidingDict : public MleFlatPtrDict
+{
+  protected:
+    virtual unsigned int hash(const void *) const { return 0; }
+};
+
+TEST(MleFlatPtrDictTest, Collisions) {
+    // This test is named "Collisions", and belongs to the "MleFlatPtrDictTest"
+    // test case.
+
+    CollidingDict dict;
+
+    for (int i = 0; i < 100; i++)
+        dict.set(&g_keys[i], &g_keys[i + 1]);
+    for (int i = 0; i < 100; i += 3)
+        dict.remove(&g_keys[i]);
+    for (int i = 0; i < 100; i++) {
+        if (i % 3 == 0)
+            EXPECT_TRUE(dict.find(&g_keys[i]) == NULL);
+        else
+            EXPECT_EQ(dict.find(&g_keys[i]), &g_keys[i + 1]);
+    }
+}
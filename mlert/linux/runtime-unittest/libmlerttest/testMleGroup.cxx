@@ -0,0 +1,197 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleGroup.h"
+#include "mle/MleRole.h"
+#include "mle/MleSet.h"
+
+// Include Magic Lantern Runtime unit test header files.
+#include "TestActor.h"
+
+using namespace std;
+
+
+// An actor with a dynamic property and no copy constructor.
+class NoCopyActor : public MleActor
+{
+    MLE_ACTOR_HEADER(NoCopyActor);
+
+  public:
+
+    MLE_ACTOR_DYNAMIC_PROPERTY(char *, name, getNameProperty, setNameProperty)
+
+    NoCopyActor(void) : name(NULL) {}
+    virtual ~NoCopyActor(void) { if (name != NULL) mlFree(name); }
+};
+
+MLE_ACTOR_SOURCE(NoCopyActor, MleActor);
+
+// A set that remembers the last attachment of each of a few roles.
+class TestParentSet : public MleSet
+{
+  public:
+
+    TestParentSet(void) : m_numAttached(0) {}
+
+    virtual void attach(MleRole *parent, MleRole *child)
+    {
+        m_children[m_numAttached] = child;
+        m_parents[m_numAttached] = parent;
+        m_numAttached++;
+    }
+
+    MleRole *getParent(MleRole *child)
+    {
+        for (int i = 0; i < m_numAttached; i++)
+            if (m_children[i] == child)
+                return m_parents[i];
+        return (MleRole *) this;
+    }
+
+    int m_numAttached;
+    MleRole *m_children[8];
+    MleRole *m_parents[8];
+};
+
+
+TEST(MleGroupTest, Clone) {
+    // This test is named "Clone", and belongs to the "MleGroupTest"
+    // test case.
+
+    MleGroup *group = new MleGroup();
+    TestActor *first = new TestActor();
+    first->setIdProperty(7);
+    first->setTextProperty("Hello World!", 13);
+    TestActor *second = new TestActor();
+    second->setIdProperty(8);
+    group->add(first);
+    group->add(second);
+
+    MleGroup *clone = group->clone();
+    ASSERT_TRUE(clone != NULL);
+    ASSERT_EQ(2, clone->getSize());
+
+    // The actors are copies, with their own text.
+    TestActor *firstClone = (TestActor *) (*clone)[0];
+    TestActor *secondClone = (TestActor *) (*clone)[1];
+    EXPECT_NE(first, firstClone);
+    EXPECT_EQ(7, firstClone->id);
+    EXPECT_EQ(8, secondClone->id);
+    EXPECT_STREQ("Hello World!", firstClone->text);
+    EXPECT_NE(first->text, firstClone->text);
+    EXPECT_TRUE(firstClone->getRole() == NULL);
+
+    // Every property of a copy is dirty.
+    EXPECT_TRUE(firstClone->isDirty(TestActor::idDirtyMask()));
+
+    // The original and the copy are independent.
+    delete group;
+    firstClone->setIdProperty(9);
+    EXPECT_EQ(9, firstClone->id);
+    delete clone;
+}
+
+TEST(MleGroupTest, CloneNeedsCopyConstructor) {
+    // This test is named "CloneNeedsCopyConstructor", and belongs to the "MleGroupTest"
+    // test case.
+
+    // Copied memberwise, the actors would share their names.
+    NoCopyActor *actor = new NoCopyActor();
+    actor->setNameProperty("Hello World!", 13);
+    EXPECT_EQ(0u, actor->getCloneSize());
+
+    // The dynamic property leaves the class copyable and adds no members.
+    EXPECT_TRUE(std::is_copy_constructible<NoCopyActor>::value);
+    EXPECT_TRUE(MleHasDynamicProperties<NoCopyActor>::value);
+    EXPECT_FALSE(MleCloneable<NoCopyActor>::value);
+    EXPECT_EQ(sizeof(MleActor) + sizeof(char *), sizeof(NoCopyActor));
+    EXPECT_FALSE(MleHasDynamicProperties<MleActor>::value);
+
+    MleGroup *group = new MleGroup();
+    group->add(new TestActor());
+    group->add(actor);
+    EXPECT_TRUE(group->clone() == NULL);
+
+    // TestActor copies its text in its copy constructor.
+    EXPECT_TRUE(MleCloneable<TestActor>::value);
+    EXPECT_NE(0u, (*group)[0]->getCloneSize());
+    delete group;
+}
+
+TEST(MleGroupTest, CloneRoleParents) {
+    // This test is named "CloneRoleParents", and belongs to the "MleGroupTest"
+    // test case.
+
+    // Three roles on one set: the third a child of the first.
+    TestParentSet *set = new TestParentSet();
+    MleSet *previousSet = MleSet::g_currentSet;
+    MleSet::g_currentSet = set;
+    MleGroup *group = new MleGroup();
+    for (int i = 0; i < 3; i++)
+    {
+        TestActor *actor = new TestActor();
+        new MleRole(actor);
+        group->add(actor);
+    }
+    MleSet::g_currentSet = previousSet;
+
+    MleRole *parent = (*group)[0]->getRole();
+    MleRole *child = (*group)[2]->getRole();
+    set->attach(parent, child);
+    child->m_parent = parent;
+    set->attach(NULL, parent);
+    set->attach(NULL, (*group)[1]->getRole());
+
+    MleGroup *clone = group->clone();
+    ASSERT_TRUE(clone != NULL);
+    EXPECT_EQ(6, set->m_numAttached);
+
+    // The copy of the child is attached to the copy of its parent.
+    MleRole *newParent = (*clone)[0]->getRole();
+    MleRole *newChild = (*clone)[2]->getRole();
+    EXPECT_TRUE(set->getParent(newChild) == newParent);
+    EXPECT_TRUE(newChild->m_parent == newParent);
+    EXPECT_TRUE(set->getParent(newParent) == NULL);
+    EXPECT_TRUE(set->getParent((*clone)[1]->getRole()) == NULL);
+
+    delete clone;
+    delete group;
+    delete set;
+}
@@ -0,0 +1,134 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleActorGC.h"
+#include "mle/MleGroup.h"
+#include "mle/MleGroupTemplate.h"
+#include "mle/MleOpcode.h"
+#include "mle/MleTables.h"
+
+// Include Magic Lantern Runtime unit test header files.
+#include "TestActor.h"
+
+using namespace std;
+
+
+// Defined by MLE_ACTOR_SOURCE.
+extern MleActor *_mlCreateTestActor(void);
+
+static MleGroup *createTestGroup(void)
+{
+    return new MleGroup();
+}
+
+static unsigned char *putInt(unsigned char *p, int value)
+{
+    memcpy(p, &value, sizeof(int));
+    return p + sizeof(int);
+}
+
+
+TEST(MleGroupTemplateTest, CompileAndInstantiate) {
+    // This test is named "CompileAndInstantiate", and belongs to the "MleGroupTemplateTest"
+    // test case.
+
+    // Borrow the first actor and group classes for TestActor.
+    mlRTActorClass[0].constructor = _mlCreateTestActor;
+    mlRTActorClassLength = 1;
+    mlRTGroupClass[0].constructor = createTestGroup;
+
+    // A group of two actors: the first with id, text and age
+    // properties, the second with just an id.
+    unsigned char chunk[128];
+    unsigned char *p = putInt(chunk, 0);
+    *p++ = 2;
+    *p++ = createActorOpcode; *p++ = 0;
+    *p++ = setPropertyOffsetOpcode; *p++ = 0;
+    *p++ = setPropertyLengthOpcode; *p++ = sizeof(int);
+    *p++ = copyPropertyOpcode; p = putInt(p, 7);
+    *p++ = setPropertyOffsetOpcode; *p++ = 1;
+    *p++ = copyDynamicPropertyOpcode; p = putInt(p, 6);
+    memcpy(p, "hello", 6); p += 6;
+    *p++ = setPropertyOffsetOpcode; *p++ = 2;
+    *p++ = setPropertyLengthOpcode; *p++ = sizeof(int);
+    *p++ = copyArrayPropertyOpcode; p = putInt(p, 3);
+    p = putInt(p, 15); p = putInt(p, 19); p = putInt(p, 51);
+    *p++ = createActorOpcode; *p++ = 0;
+    *p++ = setPropertyOffsetOpcode; *p++ = 0;
+    *p++ = setPropertyLengthOpcode; *p++ = sizeof(int);
+    *p++ = copyPropertyOpcode; p = putInt(p, 8);
+    *p++ = endActorGroupOpcode;
+
+    MleGroupTemplate *groupTemplate = MleGroupTemplate::compile(chunk, (unsigned int) (p - chunk));
+    ASSERT_TRUE(groupTemplate != NULL);
+    EXPECT_EQ(2, groupTemplate->getNumActors());
+    EXPECT_EQ(6, groupTemplate->getNumInstructions());
+
+    // The template keeps its own copy of the values.
+    memset(chunk, 0, sizeof(chunk));
+
+    for (int i = 0; i < 2; i++)
+    {
+        MleLoadContext context;
+        MleGroup *group = groupTemplate->instantiate(&context);
+        ASSERT_TRUE(group != NULL);
+        ASSERT_EQ(2, context.m_numActors);
+
+        TestActor *first = (TestActor *) context.m_registry[0].m_actor;
+        TestActor *second = (TestActor *) context.m_registry[1].m_actor;
+        EXPECT_NE(first, second);
+        EXPECT_EQ(7, first->id);
+        EXPECT_STREQ("hello", first->text);
+        EXPECT_EQ(3, first->age.size());
+        EXPECT_EQ(51, first->age[2]);
+        EXPECT_EQ(8, second->id);
+        EXPECT_TRUE(second->text == NULL);
+
+        delete first;
+        delete second;
+        delete group;
+        releaseLoadContext(&context);
+    }
+
+    delete groupTemplate;
+    mlRTActorClass[0].constructor = NULL;
+    mlRTActorClassLength = 0;
+    mlRTGroupClass[0].constructor = NULL;
+}
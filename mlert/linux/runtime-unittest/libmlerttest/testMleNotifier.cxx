@@ -0,0 +1,179 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleNotifier.h"
+
+using namespace std;
+
+// Records the clients called back, in order.
+static int g_calls[64];
+static int g_numCalls = 0;
+
+static void recordCallback(const void *, const void *client)
+{
+    g_calls[g_numCalls++] = *(const int *)client;
+}
+
+static int g_clients[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+static int g_keys[4];
+
+TEST(MleNotifierTest, NotifyOrder) {
+    // This test is named "NotifyOrder", and belongs to the "MleNotifierTest"
+    // test case.
+
+    MleNotifier notifier(16, 16);
+
+    // Callbacks are made in registration order, only for the notified key.
+    for (int i = 0; i < 5; i++)
+        notifier.addCallback(&g_keys[0], recordCallback, &g_clients[i]);
+    notifier.addCallback(&g_keys[1], recordCallback, &g_clients[7]);
+
+    g_numCalls = 0;
+    notifier.notify(&g_keys[0]);
+    EXPECT_EQ(g_numCalls, 5);
+    for (int i = 0; i < 5; i++)
+        EXPECT_EQ(g_calls[i], i);
+
+    // Removing one callback keeps the order of the rest.
+    notifier.removeCallback(&g_keys[0], recordCallback, &g_clients[2]);
+    g_numCalls = 0;
+    notifier.notify(&g_keys[0]);
+    EXPECT_EQ(g_numCalls, 4);
+    EXPECT_EQ(g_calls[0], 0);
+    EXPECT_EQ(g_calls[1], 1);
+    EXPECT_EQ(g_calls[2], 3);
+    EXPECT_EQ(g_calls[3], 4);
+
+    notifier.removeCallbacks(&g_keys[0]);
+    g_numCalls = 0;
+    notifier.notify(&g_keys[0]);
+    EXPECT_EQ(g_numCalls, 0);
+
+    // Notifying an unknown key does nothing.
+    notifier.notify(&g_keys[2]);
+    EXPECT_EQ(g_numCalls, 0);
+}
+
+TEST(MleNotifierTest, BatchNotify) {
+    // This test is named "BatchNotify", and belongs to the "MleNotifierTest"
+    // test case.
+
+    MleNotifier notifier(16, 16);
+    notifier.addCallback(&g_keys[0], recordCallback, &g_clients[0]);
+    notifier.addCallback(&g_keys[1], recordCallback, &g_clients[1]);
+    notifier.addCallback(&g_keys[2], recordCallback, &g_clients[2]);
+
+    const void *keys[3] = { &g_keys[2], &g_keys[3], &g_keys[0] };
+    g_numCalls = 0;
+    notifier.notify(keys, 3);
+    EXPECT_EQ(g_numCalls, 2);
+    EXPECT_EQ(g_calls[0], 2);
+    EXPECT_EQ(g_calls[1], 0);
+}
+
+static MleNotifier *g_notifier = NULL;
+
+// Removes every callback on its key, then adds a new one.
+static void removingCallback(const void *key, const void *client)
+{
+    g_calls[g_numCalls++] = *(const int *)client;
+    g_notifier->removeCallbacks(key);
+    g_notifier->addCallback(key, recordCallback, &g_clients[6]);
+}
+
+TEST(MleNotifierTest, ChangeDuringNotify) {
+    // This test is named "ChangeDuringNotify", and belongs to the "MleNotifierTest"
+    // test case.
+
+    MleNotifier notifier(16, 16);
+    g_notifier = &notifier;
+    notifier.addCallback(&g_keys[0], recordCallback, &g_clients[0]);
+    notifier.addCallback(&g_keys[0], removingCallback, &g_clients[1]);
+    notifier.addCallback(&g_keys[0], recordCallback, &g_clients[2]);
+
+    // The callbacks after the removing one are skipped, and the one
+    // added during notification is not called yet.
+    g_numCalls = 0;
+    notifier.notify(&g_keys[0]);
+    EXPECT_EQ(g_numCalls, 2);
+    EXPECT_EQ(g_calls[0], 0);
+    EXPECT_EQ(g_calls[1], 1);
+
+    g_numCalls = 0;
+    notifier.notify(&g_keys[0]);
+    EXPECT_EQ(g_numCalls, 1);
+    EXPECT_EQ(g_calls[0], 6);
+    g_notifier = NULL;
+}
+
+static int g_count = 0;
+
+static void countCallback(const void *, const void *)
+{
+    g_count++;
+}
+
+TEST(MleNotifierTest, ManyCallbacks) {
+    // This test is named "ManyCallbacks", and belongs to the "MleNotifierTest"
+    // test case.
+
+    // A long list on one key is walked without recursion.
+    MleNotifier *notifier = new MleNotifier(16, 16);
+    for (int i = 0; i < 100000; i++)
+        notifier->addCallback(&g_keys[0], countCallback, &g_clients[i & 7]);
+
+    g_count = 0;
+    notifier->notify(&g_keys[0]);
+    EXPECT_EQ(g_count, 100000);
+
+    // Many keys share a pool.
+    static int keys[1000];
+    MleNotifier *other = new MleNotifier(16, notifier->getPool());
+    for (int i = 0; i < 1000; i++)
+        other->addCallback(&keys[i], countCallback, NULL);
+    g_count = 0;
+    for (int i = 0; i < 1000; i++)
+        other->notify(&keys[i]);
+    EXPECT_EQ(g_count, 1000);
+
+    delete other;
+    delete notifier;
+}
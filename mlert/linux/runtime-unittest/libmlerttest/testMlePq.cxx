@@ -0,0 +1,451 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MlePq.h"
+#include "mle/MlePairingPq.h"
+
+using namespace std;
+
+// Verify that the queue drains in non-increasing priority order.
+static void checkOrder(MlePQ &queue)
+{
+    MlePQItem item;
+    int lastKey = MLE_MAX_QPRIORITY;
+
+    while (queue.remove(item)) {
+        EXPECT_LE(item.m_key, lastKey);
+        lastKey = item.m_key;
+    }
+    EXPECT_EQ(queue.getNumItems(), 0);
+}
+
+TEST(MlePQTest, InsertRemove) {
+    // This test is named "InsertRemove", and belongs to the "MlePQTest"
+    // test case.
+
+    MlePQ *queue = new MlePQ();
+    EXPECT_TRUE(queue != NULL);
+    EXPECT_FALSE(queue->isIndexed());
+
+    MlePQItem item;
+    for (int i = 0; i < 200; i++) {
+        item.m_key = (i * 37) % 101;
+        item.m_data = (void *)(size_t)i;
+        queue->insert(item);
+    }
+    EXPECT_EQ(queue->getNumItems(), 200);
+
+    checkOrder(*queue);
+
+    delete queue;
+}
+
+TEST(MlePQTest, ChangeItem) {
+    // This test is named "ChangeItem", and belongs to the "MlePQTest"
+    // test case.
+
+    MlePQ queue(16);
+    MlePQItem item;
+    for (int i = 0; i < 100; i++) {
+        item.m_key = i;
+        item.m_data = (void *)(size_t)i;
+        queue.insert(item);
+    }
+
+    // Demote the ten highest priority items to priority 0.
+    for (int i = 99; i >= 90; i--) {
+        unsigned int k = queue.findItem(i);
+        EXPECT_NE(k, 0);
+        EXPECT_TRUE(queue.changeItem(k, 0));
+    }
+    EXPECT_EQ(queue.getNumItems(), 100);
+
+    queue.remove(item);
+    EXPECT_EQ(item.m_key, 89);
+    checkOrder(queue);
+}
+
+TEST(MlePQTest, IndexedHandles) {
+    // This test is named "IndexedHandles", and belongs to the "MlePQTest"
+    // test case.
+
+    MlePQ queue(0, TRUE);
+    EXPECT_TRUE(queue.isIndexed());
+
+    MlePQHandle handles[500];
+    MlePQItem item;
+    for (int i = 0; i < 500; i++) {
+        item.m_key = (i * 7919) % 1000;
+        item.m_data = (void *)(size_t)(i + 1);
+        handles[i] = queue.insertWithHandle(item);
+        EXPECT_NE(handles[i], 0);
+    }
+
+    // Every handle resolves to the item it was issued for.
+    for (int i = 0; i < 500; i++) {
+        unsigned int k = queue.findHandle(handles[i]);
+        EXPECT_NE(k, 0);
+        EXPECT_EQ(queue.getHandle(k), handles[i]);
+        queue.peek(k, item);
+        EXPECT_EQ(item.m_data, (void *)(size_t)(i + 1));
+    }
+
+    // Change priorities through handles and destroy every third item.
+    for (int i = 0; i < 500; i++) {
+        unsigned int k = queue.findHandle(handles[i]);
+        if ((i % 3) == 0)
+            queue.destroyItem(k);
+        else
+            queue.changeItem(k, i);
+    }
+    for (int i = 0; i < 500; i++) {
+        unsigned int k = queue.findHandle(handles[i]);
+        if ((i % 3) == 0) {
+            EXPECT_EQ(k, 0);
+        } else {
+            queue.peek(k, item);
+            EXPECT_EQ(item.m_key, i);
+            EXPECT_EQ(item.m_data, (void *)(size_t)(i + 1));
+        }
+    }
+
+    checkOrder(queue);
+}
+
+TEST(MlePQTest, StaleHandles) {
+    // This test is named "StaleHandles", and belongs to the "MlePQTest"
+    // test case.
+
+    MlePQ queue(4, TRUE);
+    MlePQItem item;
+    item.m_key = 1;
+    item.m_data = (void *)(size_t)1;
+    MlePQHandle first = queue.insertWithHandle(item);
+
+    // The freed entry is reused by the next insertion, but the old
+    // handle does not find the new item.
+    EXPECT_TRUE(queue.remove(item));
+    item.m_data = (void *)(size_t)2;
+    MlePQHandle second = queue.insertWithHandle(item);
+    EXPECT_EQ(first & MLE_PQ_INDEX_MASK, second & MLE_PQ_INDEX_MASK);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(queue.findHandle(first), 0);
+    EXPECT_EQ(queue.findHandle(second), 1);
+
+    // Nor does a handle from before the queue was cleared.
+    queue.clear();
+    second = queue.insertWithHandle(item);
+    EXPECT_EQ(queue.findHandle(second), 1);
+    queue.clear();
+    EXPECT_EQ(queue.findHandle(second), 0);
+    EXPECT_NE(queue.insertWithHandle(item), second);
+}
+
+TEST(MlePQTest, IndexedFindAndRemoveByPriority) {
+    // This test is named "IndexedFindAndRemoveByPriority", and belongs to
+    // the "MlePQTest" test case.
+
+    MlePQ queue(64, TRUE);
+    MlePQItem item;
+    for (int i = 0; i < 1000; i++) {
+        item.m_key = i / 5;
+        item.m_data = (void *)(size_t)i;
+        queue.insert(item);
+    }
+
+    EXPECT_TRUE(queue.inQueue(100));
+    EXPECT_FALSE(queue.inQueue(1000));
+
+    item.m_key = 42;
+    item.m_data = (void *)(size_t)212;
+    EXPECT_TRUE(queue.inQueue(item));
+    item.m_data = (void *)(size_t)300;
+    EXPECT_FALSE(queue.inQueue(item));
+
+    MlePQItem *found;
+    unsigned int numFound;
+    EXPECT_TRUE(queue.remove(100, &found, &numFound));
+    EXPECT_EQ(numFound, 5);
+    for (unsigned int i = 0; i < numFound; i++)
+        EXPECT_EQ(found[i].m_key, 100);
+    delete [] found;
+    EXPECT_FALSE(queue.inQueue(100));
+    EXPECT_FALSE(queue.remove(100, &found, &numFound));
+
+    queue.destroy(50);
+    EXPECT_FALSE(queue.inQueue(50));
+    EXPECT_EQ(queue.getNumItems(), 990);
+
+    // Replacing the top item keeps the index consistent.
+    item.m_key = 7;
+    item.m_data = (void *)(size_t)5000;
+    EXPECT_TRUE(queue.replace(item));
+    EXPECT_TRUE(queue.inQueue(item));
+    EXPECT_EQ(queue.getNumItems(), 990);
+    EXPECT_TRUE(queue.remove(199, &found, &numFound));
+    EXPECT_EQ(numFound, 4);
+    delete [] found;
+
+    checkOrder(queue);
+
+    queue.clear();
+    item.m_key = 1;
+    EXPECT_NE(queue.insertWithHandle(item), 0);
+    EXPECT_EQ(queue.getNumItems(), 1);
+}
+
+TEST(MlePQTest, BulkLoad) {
+    // This test is named "BulkLoad", and belongs to the "MlePQTest"
+    // test case.
+
+    MlePQItem items[1000];
+    for (int i = 0; i < 1000; i++) {
+        items[i].m_key = (i * 7919) % 997;
+        items[i].m_data = (void *)(size_t)i;
+    }
+
+    MlePQ loaded(items, 1000);
+    EXPECT_EQ(loaded.getNumItems(), 1000);
+    checkOrder(loaded);
+
+    MlePQ indexed(items, 500, TRUE);
+    indexed.insertBulk(&items[500], 100);
+    indexed.insertBulk(&items[600], 400);
+    EXPECT_EQ(indexed.getNumItems(), 1000);
+    EXPECT_TRUE(indexed.inQueue(items[999]));
+    checkOrder(indexed);
+}
+
+TEST(MlePQTest, SortAndJoin) {
+    // This test is named "SortAndJoin", and belongs to the "MlePQTest"
+    // test case.
+
+    MlePQItem items[257];
+    for (int i = 0; i < 257; i++) {
+        items[i].m_key = (i * 31) % 64;
+        items[i].m_data = (void *)(size_t)i;
+    }
+    MlePQ::sort(items, 257);
+    for (int i = 1; i < 257; i++)
+        EXPECT_LE(items[i - 1].m_key, items[i].m_key);
+
+    MlePQ first(items, 100);
+    MlePQ second(&items[100], 157);
+    MlePQ *joint = MlePQ::join(first, second);
+    EXPECT_TRUE(joint != NULL);
+    EXPECT_EQ(joint->getNumItems(), 257);
+
+    MlePQ copy;
+    copy = *joint;
+    EXPECT_EQ(copy.getNumItems(), 257);
+    checkOrder(copy);
+    checkOrder(*joint);
+
+    // Removing by priority from a plain queue keeps it ordered.
+    first.destroy(items[50].m_key);
+    EXPECT_FALSE(first.inQueue(items[50].m_key));
+    checkOrder(first);
+
+    delete joint;
+}
+
+// Verify that the pairing heap drains in non-increasing priority order.
+static void checkOrder(MlePairingPQ &queue)
+{
+    MlePQItem item;
+    int lastKey = MLE_MAX_QPRIORITY;
+    unsigned int numItems = queue.getNumItems();
+
+    while (queue.remove(item)) {
+        EXPECT_LE(item.m_key, lastKey);
+        lastKey = item.m_key;
+        numItems--;
+    }
+    EXPECT_EQ(numItems, 0);
+    EXPECT_EQ(queue.getNumItems(), 0);
+}
+
+static MlBoolean matchData(MlePQItem &item, void *clientData)
+{
+    return (item.m_data == clientData);
+}
+
+TEST(MlePairingPQTest, InsertRemove) {
+    // This test is named "InsertRemove", and belongs to the "MlePairingPQTest"
+    // test case.
+
+    MlePairingPQ *queue = new MlePairingPQ();
+    EXPECT_TRUE(queue != NULL);
+
+    MlePQItem item;
+    EXPECT_FALSE(queue->remove(item));
+    for (int i = 0; i < 1000; i++) {
+        item.m_key = (i * 7919) % 997;
+        item.m_data = (void *)(size_t)i;
+        EXPECT_TRUE(queue->insertWithHandle(item) != NULL);
+    }
+    EXPECT_EQ(queue->getNumItems(), 1000);
+
+    checkOrder(*queue);
+
+    delete queue;
+}
+
+TEST(MlePairingPQTest, ChangeAndDestroyItem) {
+    // This test is named "ChangeAndDestroyItem", and belongs to the
+    // "MlePairingPQTest" test case.
+
+    MlePairingPQ queue(16);
+    MlePairingPQHandle handles[300];
+    MlePQItem item;
+    for (int i = 0; i < 300; i++) {
+        item.m_key = i;
+        item.m_data = (void *)(size_t)(i + 1);
+        handles[i] = queue.insertWithHandle(item);
+    }
+
+    // Settle the heap so that items have children and siblings.
+    queue.remove(item);
+    EXPECT_EQ(item.m_key, 299);
+
+    for (int i = 0; i < 299; i++) {
+        if ((i % 4) == 0) {
+            queue.destroyItem(handles[i]);
+        } else if ((i % 4) == 1) {
+            EXPECT_TRUE(queue.changeItem(handles[i], i + 1000));
+        } else if ((i % 4) == 2) {
+            EXPECT_TRUE(queue.changeItem(handles[i], -i));
+        }
+    }
+
+    EXPECT_TRUE(queue.peek(handles[5], item));
+    EXPECT_EQ(item.m_key, 1005);
+    EXPECT_EQ(queue.findItem(matchData, (void *)(size_t)7), handles[6]);
+    EXPECT_TRUE(queue.findItem(matchData, (void *)(size_t)5000) == NULL);
+
+    queue.peek(item);
+    EXPECT_EQ(item.m_key, 1297);
+    checkOrder(queue);
+}
+
+TEST(MlePairingPQTest, Join) {
+    // This test is named "Join", and belongs to the "MlePairingPQTest"
+    // test case.
+
+    MlePairingPQPool *pool = new MlePairingPQPool(32);
+    {
+        MlePairingPQ global(pool);
+        MlePairingPQ scene(pool);
+        MlePairingPQ other;
+
+        MlePQItem item;
+        for (int i = 0; i < 100; i++) {
+            item.m_key = i;
+            item.m_data = NULL;
+            global.insert(item);
+            item.m_key = i * 2;
+            scene.insert(item);
+            item.m_key = i * 3;
+            other.insert(item);
+        }
+
+        global.join(scene);
+        EXPECT_EQ(global.getNumItems(), 200);
+        EXPECT_EQ(scene.getNumItems(), 0);
+
+        global.join(other);
+        EXPECT_EQ(global.getNumItems(), 300);
+        EXPECT_EQ(other.getNumItems(), 0);
+
+        global.peek(item);
+        EXPECT_EQ(item.m_key, 297);
+        checkOrder(global);
+    }
+
+    delete pool;
+}
+
+// Exercise a queue through the operations MlePQ and MlePairingPQ share.
+template <class QUEUE, class HANDLE> static void checkSwappable(QUEUE &queue)
+{
+    MlePQItem item;
+    HANDLE handles[50];
+
+    EXPECT_FALSE(queue.peek(item));
+    EXPECT_EQ(item.m_key, MLE_MIN_QPRIORITY);
+    for (int i = 0; i < 50; i++) {
+        item.m_key = i;
+        item.m_data = (void *)(size_t)(i + 1);
+        if (i & 1)
+            handles[i] = queue.insertWithHandle(item);
+        else
+            queue.insert(item);
+    }
+
+    EXPECT_TRUE(queue.peek(item));
+    EXPECT_EQ(item.m_key, 49);
+    EXPECT_TRUE(queue.changeItem(queue.findHandle(handles[5]), 100));
+    EXPECT_TRUE(queue.peek(queue.findHandle(handles[5]), item));
+    EXPECT_EQ(item.m_key, 100);
+    queue.destroyItem(queue.findHandle(handles[7]));
+    EXPECT_EQ(queue.getNumItems(), 49);
+
+    EXPECT_TRUE(queue.remove(item));
+    EXPECT_EQ(item.m_key, 100);
+    EXPECT_EQ(item.m_data, (void *)(size_t)6);
+    queue.destroy();
+    EXPECT_TRUE(queue.peek(item));
+    EXPECT_EQ(item.m_key, 48);
+
+    queue.clear();
+    EXPECT_FALSE(queue.remove(item));
+    EXPECT_EQ(item.m_data, (void *)NULL);
+}
+
+TEST(MlePairingPQTest, Swappable) {
+    // This test is named "Swappable", and belongs to the "MlePairingPQTest"
+    // test case.
+
+    MlePQ indexed(8, TRUE);
+    checkSwappable<MlePQ, MlePQHandle>(indexed);
+
+    MlePairingPQ pairing;
+    checkSwappable<MlePairingPQ, MlePairingPQHandle>(pairing);
+}
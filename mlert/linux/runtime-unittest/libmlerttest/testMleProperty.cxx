@@ -0,0 +1,117 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleProperty.h"
+#include "mle/MleTables.h"
+
+// Include Magic Lantern Runtime unit test header files.
+#include "TestActor.h"
+
+using namespace std;
+
+
+TEST(MlePropertyTest, Descriptors) {
+    // This test is named "Descriptors", and belongs to the "MlePropertyTest"
+    // test case.
+
+    const MlePropertyEntry *idEntry = mlFindProperty(mlRTActorProperties, mlRTActorPropertyLength, "id");
+    ASSERT_TRUE(idEntry != NULL);
+    EXPECT_EQ(&mlRTActorProperties[0], idEntry);
+    EXPECT_EQ(mlPropertyHash("id"), idEntry->nameHash);
+    EXPECT_STREQ("int", idEntry->type);
+    EXPECT_EQ(sizeof(int), idEntry->size);
+    EXPECT_TRUE(idEntry->flags & MLE_PROPERTY_TRIVIAL);
+
+    // Dynamic properties own their memory, so they are never trivial.
+    const MlePropertyEntry *textEntry = mlFindProperty(mlRTActorProperties, mlRTActorPropertyLength, "text");
+    ASSERT_TRUE(textEntry != NULL);
+    EXPECT_STREQ("char *", textEntry->type);
+    EXPECT_FALSE(textEntry->flags & MLE_PROPERTY_TRIVIAL);
+
+    EXPECT_TRUE(mlFindProperty(mlRTActorProperties, mlRTActorPropertyLength, "missing") == NULL);
+
+    TestActor *tActor = new TestActor();
+    tActor->setIdProperty(42);
+    EXPECT_EQ(&tActor->id, mlPropertyAddress(tActor, idEntry));
+
+    delete tActor;
+}
+
+
+TEST(MlePropertyTest, SnapshotRestore) {
+    // This test is named "SnapshotRestore", and belongs to the "MlePropertyTest"
+    // test case.
+
+    const MlePropertyEntry *idEntry = mlFindProperty(mlRTActorProperties, mlRTActorPropertyLength, "id");
+    ASSERT_TRUE(idEntry != NULL);
+
+    MleObject *actors[3];
+    for (int i = 0; i < 3; i++)
+    {
+        TestActor *tActor = new TestActor();
+        tActor->setIdProperty(i + 1);
+        actors[i] = tActor;
+    }
+
+    int ids[3];
+    mlSnapshotProperty(idEntry, actors, 3, ids);
+    EXPECT_EQ(1, ids[0]);
+    EXPECT_EQ(2, ids[1]);
+    EXPECT_EQ(3, ids[2]);
+
+    ((TestActor *)actors[1])->setIdProperty(20);
+    int changed[3];
+    EXPECT_EQ(1, mlDiffProperty(idEntry, actors, 3, ids, changed));
+    EXPECT_EQ(1, changed[0]);
+
+    mlRestoreProperty(idEntry, actors, 3, ids);
+    EXPECT_EQ(2, ((TestActor *)actors[1])->id);
+    EXPECT_EQ(0, mlDiffProperty(idEntry, actors, 3, ids, NULL));
+
+    // Copying takes the trivial properties only.
+    TestActor *copy = new TestActor();
+    mlCopyProperties(copy, actors[2], mlRTActorProperties, mlRTActorPropertyLength);
+    EXPECT_EQ(3, copy->id);
+    EXPECT_TRUE(copy->text == NULL);
+
+    delete copy;
+    for (int i = 0; i < 3; i++)
+        delete actors[i];
+}
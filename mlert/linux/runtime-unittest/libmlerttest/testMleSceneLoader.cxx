@@ -0,0 +1,382 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleSceneLoader.h"
+#include "mle/MleScene.h"
+#include "mle/MleGroup.h"
+#include "mle/MleLoad.h"
+#include "mle/MleOpcode.h"
+#include "mle/MleTables.h"
+#include "mle/MleDirector.h"
+#include "mle/MleScheduler.h"
+
+// Include Magic Lantern Runtime unit test header files.
+#include "TestActor.h"
+
+using namespace std;
+
+
+// Defined by MLE_ACTOR_SOURCE.
+extern MleActor *_mlCreateTestActor(void);
+
+static MleScene *createTestScene(void)
+{
+    return new MleScene();
+}
+
+static MleGroup *createTestGroup(void)
+{
+    return new MleGroup();
+}
+
+static unsigned char *putInt(unsigned char *p, int value)
+{
+    memcpy(p, &value, sizeof(int));
+    return p + sizeof(int);
+}
+
+// A synthetic playprint: chunk 0 is a scene of the two groups in
+//   chunks 1 and 2, each of two actors with ids from 10 * the chunk index.
+static unsigned char g_chunks[3][64];
+static unsigned int g_chunkLengths[3];
+static int g_numFetches;
+
+// A chunk that reads as damaged, as a compressed chunk that does not
+//   decode does, or -1.
+static int g_damagedChunk;
+
+static unsigned char *getTestChunk(const int indexToPpTOC, unsigned int *length)
+{
+    EXPECT_TRUE(indexToPpTOC >= 0 && indexToPpTOC < 3);
+    g_numFetches++;
+    if (indexToPpTOC == g_damagedChunk)
+    {
+        *length = 0;
+        return NULL;
+    }
+    *length = g_chunkLengths[indexToPpTOC];
+    return g_chunks[indexToPpTOC];
+}
+
+static void buildTestPlayprint(void)
+{
+    unsigned char *p = putInt(g_chunks[0], 0);
+    p = putInt(p, 2);
+    p = putInt(p, 1);
+    p = putInt(p, 2);
+    g_chunkLengths[0] = (unsigned int) (p - g_chunks[0]);
+
+    for (int i = 1; i < 3; i++)
+    {
+        p = putInt(g_chunks[i], 0);
+        *p++ = 2;
+        for (int j = 0; j < 2; j++)
+        {
+            *p++ = createActorOpcode; *p++ = 0;
+            *p++ = setPropertyOffsetOpcode; *p++ = 0;
+            *p++ = setPropertyLengthOpcode; *p++ = sizeof(int);
+            *p++ = copyPropertyOpcode; p = putInt(p, 10 * i + j);
+        }
+        *p++ = endActorGroupOpcode;
+        g_chunkLengths[i] = (unsigned int) (p - g_chunks[i]);
+    }
+}
+
+// Borrow the runtime tables, the title and the playprint for a test.
+static MleDirector g_testTitle;
+static MleDirector *g_savedTitle;
+
+static void beginTestLoad(void)
+{
+    mlRTActorClass[0].constructor = _mlCreateTestActor;
+    mlRTActorClassLength = 1;
+    mlRTGroupClass[0].constructor = createTestGroup;
+    mlRTSceneClass[0].constructor = createTestScene;
+
+    memset(&g_testTitle, 0, sizeof(g_testTitle));
+    g_testTitle.m_theScheduler = new MleScheduler();
+    g_savedTitle = g_theTitle;
+    g_theTitle = &g_testTitle;
+
+    buildTestPlayprint();
+    g_numFetches = 0;
+    g_damagedChunk = -1;
+    mlSetPlayprintChunkSource(getTestChunk);
+}
+
+static void endTestLoad(void)
+{
+    mlSetPlayprintChunkSource(NULL);
+    MleScene::deleteCurrentScene();
+
+    delete g_testTitle.m_theScheduler;
+    g_theTitle = g_savedTitle;
+
+    mlRTActorClass[0].constructor = NULL;
+    mlRTActorClassLength = 0;
+    mlRTGroupClass[0].constructor = NULL;
+    mlRTSceneClass[0].constructor = NULL;
+}
+
+
+TEST(MleSceneLoaderTest, CancelBeforeStep) {
+    // This test is named "CancelBeforeStep", and belongs to the "MleSceneLoaderTest"
+    // test case.
+
+    // No work, and so no playprint access, is done until step().
+    MleSceneLoader *loader = new MleSceneLoader(0);
+    EXPECT_EQ(MleSceneLoader::FETCH, loader->getStage());
+    EXPECT_FALSE(loader->isFinished());
+    EXPECT_EQ(0.0f, loader->getProgress());
+    EXPECT_TRUE(loader->getScene() == NULL);
+
+    EXPECT_TRUE(loader->cancel());
+    EXPECT_EQ(MleSceneLoader::CANCELLED, loader->getStage());
+    EXPECT_TRUE(loader->isFinished());
+    EXPECT_TRUE(loader->getScene() == NULL);
+
+    // A finished load cannot be cancelled again, and stepping it does nothing.
+    EXPECT_FALSE(loader->cancel());
+    EXPECT_TRUE(loader->step(10));
+    EXPECT_EQ(MleSceneLoader::CANCELLED, loader->getStage());
+
+    delete loader;
+}
+
+
+TEST(MleSceneLoaderTest, StepToDone) {
+    // This test is named "StepToDone", and belongs to the "MleSceneLoaderTest"
+    // test case.
+    beginTestLoad();
+
+    MleScene *previous = new MleScene();
+    previous->changeCurrentScene(previous);
+
+    MleSceneLoader *loader = new MleSceneLoader(0);
+
+    // FETCH reads the scene chunk.
+    EXPECT_FALSE(loader->step());
+    EXPECT_EQ(MleSceneLoader::CONSTRUCT, loader->getStage());
+    EXPECT_EQ(1, g_numFetches);
+    EXPECT_FLOAT_EQ(1.0f / 5.0f, loader->getProgress());
+
+    // CONSTRUCT parses one group per step.
+    EXPECT_FALSE(loader->step());
+    EXPECT_EQ(MleSceneLoader::CONSTRUCT, loader->getStage());
+    EXPECT_EQ(2, g_numFetches);
+    EXPECT_FLOAT_EQ(2.0f / 5.0f, loader->getProgress());
+    EXPECT_FALSE(loader->step());
+    EXPECT_EQ(MleSceneLoader::COMMIT, loader->getStage());
+    EXPECT_EQ(3, g_numFetches);
+    EXPECT_FLOAT_EQ(3.0f / 5.0f, loader->getProgress());
+    EXPECT_TRUE(MleScene::getCurrentScene() == previous);
+
+    // COMMIT makes the scene current, then commits each group: its roles,
+    // each of its actors and the group itself, and finally the scene.
+    int steps = 0;
+    float progress = loader->getProgress();
+    while (! loader->step())
+    {
+        EXPECT_EQ(MleSceneLoader::COMMIT, loader->getStage());
+        EXPECT_TRUE(MleScene::getCurrentScene() != previous);
+        EXPECT_TRUE(loader->getScene() == NULL);
+        EXPECT_GE(loader->getProgress(), progress);
+        EXPECT_LE(loader->getProgress(), 1.0f);
+        progress = loader->getProgress();
+        steps++;
+    }
+    EXPECT_EQ(1 + 2 * (1 + 2 + 1), steps);
+
+    EXPECT_EQ(MleSceneLoader::DONE, loader->getStage());
+    EXPECT_TRUE(loader->isFinished());
+    EXPECT_EQ(1.0f, loader->getProgress());
+    EXPECT_FALSE(loader->cancel());
+
+    MleScene *scene = loader->getScene();
+    ASSERT_TRUE(scene != NULL);
+    EXPECT_TRUE(MleScene::getCurrentScene() == scene);
+    ASSERT_EQ(2, scene->getSize());
+    for (int i = 0; i < 2; i++)
+    {
+        MleGroup *group = (*scene)[i];
+        ASSERT_EQ(2, group->getSize());
+        EXPECT_EQ(10 * (i + 1), ((TestActor *) (*group)[0])->id);
+        EXPECT_EQ(10 * (i + 1) + 1, ((TestActor *) (*group)[1])->id);
+    }
+
+    // The scene belongs to the scene management, not the loader.
+    delete loader;
+    EXPECT_TRUE(MleScene::getCurrentScene() == scene);
+
+    endTestLoad();
+}
+
+TEST(MleSceneLoaderTest, CancelDuringConstruct) {
+    // This test is named "CancelDuringConstruct", and belongs to the "MleSceneLoaderTest"
+    // test case.
+    beginTestLoad();
+
+    MleScene *previous = new MleScene();
+    previous->changeCurrentScene(previous);
+
+    // The parsed group and its actors are deleted; the current scene
+    // is left alone.
+    MleSceneLoader *loader = new MleSceneLoader(0);
+    EXPECT_FALSE(loader->step(2));
+    EXPECT_EQ(MleSceneLoader::CONSTRUCT, loader->getStage());
+    EXPECT_TRUE(loader->cancel());
+    EXPECT_EQ(MleSceneLoader::CANCELLED, loader->getStage());
+    EXPECT_EQ(0.0f, loader->getProgress());
+    EXPECT_TRUE(loader->getScene() == NULL);
+    EXPECT_TRUE(MleScene::getCurrentScene() == previous);
+    EXPECT_TRUE(loader->step());
+    delete loader;
+
+    // Deleting an unfinished loader discards the load too.
+    loader = new MleSceneLoader(0);
+    EXPECT_FALSE(loader->step(2));
+    delete loader;
+    EXPECT_TRUE(MleScene::getCurrentScene() == previous);
+
+    // Once the commit has begun the load cannot be cancelled, and
+    // deleting the loader finishes it.
+    loader = new MleSceneLoader(0);
+    EXPECT_FALSE(loader->step(4));
+    EXPECT_EQ(MleSceneLoader::COMMIT, loader->getStage());
+    EXPECT_FALSE(loader->cancel());
+    EXPECT_EQ(MleSceneLoader::COMMIT, loader->getStage());
+    delete loader;
+    ASSERT_TRUE(MleScene::getCurrentScene() != previous);
+    EXPECT_EQ(2, MleScene::getCurrentScene()->getSize());
+
+    endTestLoad();
+}
+
+TEST(MleSceneLoaderTest, DamagedChunk) {
+    // This test is named "DamagedChunk", and belongs to the "MleSceneLoaderTest"
+    // test case.
+    beginTestLoad();
+
+    MleScene *previous = new MleScene();
+    previous->changeCurrentScene(previous);
+
+    // Without its scene chunk the load fails at once.
+    g_damagedChunk = 0;
+    MleSceneLoader *loader = new MleSceneLoader(0);
+    EXPECT_TRUE(loader->step());
+    EXPECT_EQ(MleSceneLoader::FAILED, loader->getStage());
+    EXPECT_TRUE(loader->getScene() == NULL);
+    delete loader;
+    EXPECT_TRUE(mlLoadScene(0) == NULL);
+    EXPECT_TRUE(MleScene::getCurrentScene() == previous);
+
+    // Without a group chunk the loader fails, discarding the group it
+    // had parsed, and mlLoadScene() leaves the group out.
+    g_damagedChunk = 2;
+    loader = new MleSceneLoader(0);
+    EXPECT_TRUE(loader->step(3));
+    EXPECT_EQ(MleSceneLoader::FAILED, loader->getStage());
+    delete loader;
+    EXPECT_TRUE(MleScene::getCurrentScene() == previous);
+    EXPECT_TRUE(mlLoadGroup(2) == NULL);
+
+    MleScene *scene = mlLoadScene(0);
+    ASSERT_TRUE(scene != NULL);
+    EXPECT_TRUE(MleScene::getCurrentScene() == scene);
+    EXPECT_EQ(1, scene->getSize());
+
+    endTestLoad();
+}
+
+TEST(MleSceneLoaderTest, ParallelDecode) {
+    // This test is named "ParallelDecode", and belongs to the "MleSceneLoaderTest"
+    // test case.
+    beginTestLoad();
+
+    // mlLoadScene() decodes both groups on workers, reading each chunk
+    // once, and builds the same scene as the staged loader.
+    mlSetGroupDecodeThreads(4);
+    MleScene *scene = mlLoadScene(0);
+    ASSERT_TRUE(scene != NULL);
+    EXPECT_EQ(3, g_numFetches);
+    ASSERT_EQ(2, scene->getSize());
+    for (int i = 0; i < 2; i++)
+    {
+        MleGroup *group = (*scene)[i];
+        ASSERT_EQ(2, group->getSize());
+        EXPECT_EQ(10 * (i + 1), ((TestActor *) (*group)[0])->id);
+        EXPECT_EQ(10 * (i + 1) + 1, ((TestActor *) (*group)[1])->id);
+    }
+
+    // The templates are kept, so loading again reads only the scene.
+    mlLoadScene(0);
+    EXPECT_EQ(4, g_numFetches);
+    mlSetGroupDecodeThreads(0);
+
+    endTestLoad();
+}
+
+TEST(MleSceneLoaderTest, Schedule) {
+    // This test is named "Schedule", and belongs to the "MleSceneLoaderTest"
+    // test case.
+    beginTestLoad();
+
+    MleSchedulerPhase *phase = g_theTitle->m_theScheduler->insertPhase();
+    MleSceneLoader *loader = new MleSceneLoader(0);
+    loader->schedule(phase, 3);
+
+    // The load is 1 + 2 + 1 + 2 * 4 + 1 units of work, 3 per frame.
+    int frames = 0;
+    while (! loader->isFinished())
+    {
+        g_theTitle->m_theScheduler->go(phase);
+        frames++;
+    }
+    EXPECT_EQ(5, frames);
+    EXPECT_EQ(MleSceneLoader::DONE, loader->getStage());
+    EXPECT_TRUE(loader->getScene() == MleScene::getCurrentScene());
+
+    // The finished loader has taken itself off the scheduler, so the
+    // phase may run after it is deleted.
+    delete loader;
+    g_theTitle->m_theScheduler->go(phase);
+
+    endTestLoad();
+}
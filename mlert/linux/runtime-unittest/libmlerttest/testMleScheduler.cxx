@@ -148,6 +148,36 @@ TEST(MleSchedulerTest, InsertFunc) {
     delete scheduler;
 }
 
+TEST(MleSchedulerTest, ItemPoolStats) {
+    // This test is named "ItemPoolStats", and belongs to the "MleSchedulerTest"
+    // test case.
+
+    const char* tag = "Test function tag";
+    MleSchedulerItem* items[40];
+    MleFixedPoolStats stats;
+
+    MleScheduler* scheduler = new MleScheduler(6, 16);
+    MleSchedulerPhase *p0 = scheduler->insertPhase();
+
+    // Scheduling more functions than the initial pool size grows the pool.
+    for (int i = 0; i < 40; i++)
+        items[i] = scheduler->insertFunc(p0, testFn, (void *)tag, (void *)tag);
+    scheduler->getItemPoolStats(stats);
+    EXPECT_EQ(stats.m_live, 40);
+    EXPECT_EQ(stats.m_peak, 40);
+    EXPECT_EQ(stats.m_numChunks, 2);
+
+    // Removed items go back to the pool.
+    for (int i = 0; i < 10; i++)
+        scheduler->remove(items[i]);
+    scheduler->remove((void *)tag);
+    scheduler->getItemPoolStats(stats);
+    EXPECT_EQ(stats.m_live, 0);
+    EXPECT_EQ(stats.m_peak, 40);
+
+    delete scheduler;
+}
+
 TEST(MleSchedulerTest, Go1) {
     // This test is named "InsertFunc", and belongs to the "Go1"
     // test case.
@@ -0,0 +1,164 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleSlotMap.h"
+#include "mle/MlePtrContainer.h"
+
+using namespace std;
+
+static int g_items[10000];
+
+TEST(MleSlotMapTest, AddRemove) {
+    // This test is named "AddRemove", and belongs to the "MleSlotMapTest"
+    // test case.
+
+    MleSlotMap *map = new MleSlotMap(2);
+    MleSlotHandle handles[10];
+
+    for (int i = 0; i < 10; i++) {
+        handles[i] = map->add(&g_items[i]);
+        EXPECT_NE(handles[i], MLE_SLOTMAP_INVALID_HANDLE);
+        EXPECT_EQ(MleSlotMap::getSlotIndex(handles[i]), i);
+    }
+    EXPECT_EQ(map->getSize(), 10);
+
+    // Removing moves the last item into the hole.
+    EXPECT_TRUE(map->remove(handles[2]));
+    EXPECT_EQ(map->getSize(), 9);
+    EXPECT_EQ((*map)[2], &g_items[9]);
+    EXPECT_EQ(map->getIndex(handles[9]), 2);
+    EXPECT_EQ(map->getHandle(2), handles[9]);
+
+    // Other handles and slots are unaffected.
+    for (int i = 0; i < 10; i++) {
+        if (i == 2) {
+            EXPECT_TRUE(map->get(handles[i]) == NULL);
+            EXPECT_TRUE(map->get(MleSlotMap::getFirstHandle(i)) == NULL);
+        } else {
+            EXPECT_EQ(map->get(handles[i]), &g_items[i]);
+            EXPECT_EQ(map->get(MleSlotMap::getFirstHandle(i)), &g_items[i]);
+        }
+    }
+
+    // A stale handle cannot remove anything.
+    EXPECT_FALSE(map->remove(handles[2]));
+    EXPECT_EQ(map->getSize(), 9);
+
+    map->removeAll();
+    EXPECT_EQ(map->getSize(), 0);
+    EXPECT_FALSE(map->isValid(handles[0]));
+
+    delete map;
+}
+
+TEST(MleSlotMapTest, StaleHandles) {
+    // This test is named "StaleHandles", and belongs to the "MleSlotMapTest"
+    // test case.
+
+    MleSlotMap map(4);
+    MleSlotHandle a = map.add(&g_items[0]);
+    MleSlotHandle b = map.add(&g_items[1]);
+
+    // A reused slot gets a new generation.
+    map.remove(a);
+    MleSlotHandle c = map.add(&g_items[2]);
+    EXPECT_EQ(MleSlotMap::getSlotIndex(c), MleSlotMap::getSlotIndex(a));
+    EXPECT_NE(c, a);
+    EXPECT_TRUE(map.get(a) == NULL);
+    EXPECT_EQ(map.get(c), &g_items[2]);
+    EXPECT_EQ(map.get(b), &g_items[1]);
+
+    // Only the first item in a slot answers to its first handle.
+    EXPECT_EQ(a, MleSlotMap::getFirstHandle(0));
+    EXPECT_TRUE(map.get(MleSlotMap::getFirstHandle(0)) == NULL);
+    EXPECT_EQ(map.get(MleSlotMap::getFirstHandle(1)), &g_items[1]);
+
+    // Handles that were never issued are rejected.
+    EXPECT_FALSE(map.isValid(MLE_SLOTMAP_INVALID_HANDLE));
+    EXPECT_FALSE(map.isValid(1000));
+}
+
+class TestContainer : public MlePtrContainer<int*>
+{
+  public:
+    TestContainer(void) : MlePtrContainer<int*>(4) {}
+    virtual void init(void) {}
+};
+
+TEST(MleSlotMapTest, Container) {
+    // This test is named "Container", and belongs to the "MleSlotMapTest"
+    // test case.
+
+    TestContainer container;
+    MleSlotHandle handles[10000];
+
+    for (int i = 0; i < 10000; i++)
+        handles[i] = container.add(&g_items[i]);
+
+    // Removal by pointer leaves load order lookups intact.
+    for (int i = 0; i < 10000; i += 2)
+        container.remove(&g_items[i]);
+    EXPECT_EQ(container.getSize(), 5000);
+    for (int i = 0; i < 10000; i++) {
+        if (i & 1) {
+            EXPECT_EQ(container.find(i), &g_items[i]);
+            EXPECT_EQ(container[container.find(&g_items[i])], &g_items[i]);
+            EXPECT_EQ(container.getHandle(&g_items[i]), handles[i]);
+        } else {
+            EXPECT_TRUE(container.find(i) == NULL);
+            EXPECT_EQ(container.find(&g_items[i]), -1);
+        }
+    }
+
+    // A new item reuses a freed slot but not its load order.
+    MleSlotHandle reused = container.add(&g_items[0]);
+    EXPECT_EQ(MleSlotMap::getSlotIndex(reused), 0);
+    EXPECT_TRUE(container.find(0) == NULL);
+    container.remove(reused);
+
+    // Clearing and removing by handle.
+    container.clear(&g_items[1]);
+    EXPECT_TRUE(container.get(handles[1]) == NULL);
+    EXPECT_TRUE(container.remove(handles[3]));
+    EXPECT_FALSE(container.remove(handles[3]));
+    container.clear(0);
+    EXPECT_EQ(container.getSize(), 4997);
+}
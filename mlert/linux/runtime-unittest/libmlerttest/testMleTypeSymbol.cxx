@@ -0,0 +1,157 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+
+// Include system header files.
+#include <iostream>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "mle/MleTypeSymbol.h"
+
+using namespace std;
+
+TEST(MleTypeSymbolTest, Intern) {
+    // This test is named "Intern", and belongs to the "MleTypeSymbolTest"
+    // test case.
+
+    int numSymbols = MleTypeSymbol::getNumSymbols();
+
+    MleTypeId root = MleTypeSymbol::intern("TestSymbolRoot", MLE_TYPE_NONE);
+    EXPECT_NE(root, MLE_TYPE_NONE);
+    EXPECT_EQ(MleTypeSymbol::intern("TestSymbolRoot", MLE_TYPE_NONE), root);
+    EXPECT_EQ(MleTypeSymbol::find("TestSymbolRoot"), root);
+    EXPECT_STREQ(MleTypeSymbol::getName(root), "TestSymbolRoot");
+    EXPECT_EQ(MleTypeSymbol::getParent(root), MLE_TYPE_NONE);
+    EXPECT_EQ(MleTypeSymbol::getNumSymbols(), numSymbols + 1);
+
+    // The name is copied, so lookups by other strings must match.
+    char name[32];
+    strcpy(name, "TestSymbolRoot");
+    EXPECT_EQ(MleTypeSymbol::find(name), root);
+
+    EXPECT_EQ(MleTypeSymbol::find("TestSymbolMissing"), MLE_TYPE_NONE);
+    EXPECT_EQ(MleTypeSymbol::find(NULL), MLE_TYPE_NONE);
+}
+
+TEST(MleTypeSymbolTest, Isa) {
+    // This test is named "Isa", and belongs to the "MleTypeSymbolTest"
+    // test case.
+
+    // Build two small hierarchies, interleaving their registration
+    // the way class initialization would.
+    //
+    //   TestIsaA          TestIsaX
+    //     TestIsaB
+    //       TestIsaD
+    //     TestIsaC
+    MleTypeId a = MleTypeSymbol::intern("TestIsaA", MLE_TYPE_NONE);
+    MleTypeId b = MleTypeSymbol::intern("TestIsaB", a);
+    MleTypeId x = MleTypeSymbol::intern("TestIsaX", MLE_TYPE_NONE);
+    MleTypeId c = MleTypeSymbol::intern("TestIsaC", a);
+    MleTypeId d = MleTypeSymbol::intern("TestIsaD", b);
+
+    EXPECT_EQ(MleTypeSymbol::getParent(d), b);
+
+    EXPECT_TRUE(MleTypeSymbol::isa(a, a));
+    EXPECT_TRUE(MleTypeSymbol::isa(b, a));
+    EXPECT_TRUE(MleTypeSymbol::isa(c, a));
+    EXPECT_TRUE(MleTypeSymbol::isa(d, a));
+    EXPECT_TRUE(MleTypeSymbol::isa(d, b));
+    EXPECT_TRUE(MleTypeSymbol::isa(d, d));
+
+    EXPECT_FALSE(MleTypeSymbol::isa(a, b));
+    EXPECT_FALSE(MleTypeSymbol::isa(c, b));
+    EXPECT_FALSE(MleTypeSymbol::isa(d, c));
+    EXPECT_FALSE(MleTypeSymbol::isa(b, d));
+    EXPECT_FALSE(MleTypeSymbol::isa(x, a));
+    EXPECT_FALSE(MleTypeSymbol::isa(d, x));
+
+    EXPECT_FALSE(MleTypeSymbol::isa(MLE_TYPE_NONE, a));
+    EXPECT_FALSE(MleTypeSymbol::isa(a, MLE_TYPE_NONE));
+    EXPECT_FALSE(MleTypeSymbol::isa(MLE_TYPE_NONE, MLE_TYPE_NONE));
+}
+
+TEST(MleTypeSymbolTest, Deep) {
+    // This test is named "Deep", and belongs to the "MleTypeSymbolTest"
+    // test case.
+
+    // Enough symbols to grow the table several times.
+    MleTypeId chain[200];
+    char name[32];
+    MleTypeId parent = MLE_TYPE_NONE;
+    for (int i = 0; i < 200; i++) {
+        sprintf(name, "TestDeep%d", i);
+        chain[i] = MleTypeSymbol::intern(name, parent);
+        parent = chain[i];
+    }
+
+    for (int i = 0; i < 200; i += 7) {
+        sprintf(name, "TestDeep%d", i);
+        EXPECT_EQ(MleTypeSymbol::find(name, chain[0]), chain[i]);
+        EXPECT_TRUE(MleTypeSymbol::isa(chain[199], chain[i]));
+        EXPECT_TRUE(MleTypeSymbol::isa(chain[i], chain[0]));
+        if (i > 0) {
+            EXPECT_FALSE(MleTypeSymbol::isa(chain[i - 1], chain[i]));
+        }
+    }
+}
+
+TEST(MleTypeSymbolTest, Hierarchies) {
+    // This test is named "Hierarchies", and belongs to the "MleTypeSymbolTest"
+    // test case.
+
+    // The same subclass name in two hierarchies, the way an actor and
+    // a role class may share a name.
+    MleTypeId actor = MleTypeSymbol::intern("TestHierActor", MLE_TYPE_NONE);
+    MleTypeId role = MleTypeSymbol::intern("TestHierRole", MLE_TYPE_NONE);
+    MleTypeId actorFoo = MleTypeSymbol::intern("TestHierFoo", actor);
+    MleTypeId roleFoo = MleTypeSymbol::intern("TestHierFoo", role);
+
+    EXPECT_NE(actorFoo, roleFoo);
+    EXPECT_EQ(MleTypeSymbol::getParent(actorFoo), actor);
+    EXPECT_EQ(MleTypeSymbol::getParent(roleFoo), role);
+    EXPECT_TRUE(MleTypeSymbol::isa(roleFoo, role));
+    EXPECT_FALSE(MleTypeSymbol::isa(roleFoo, actor));
+    EXPECT_FALSE(MleTypeSymbol::isa(actorFoo, role));
+
+    // Lookups search one hierarchy, named by any of its classes.
+    EXPECT_EQ(MleTypeSymbol::find("TestHierFoo", actor), actorFoo);
+    EXPECT_EQ(MleTypeSymbol::find("TestHierFoo", roleFoo), roleFoo);
+    EXPECT_EQ(MleTypeSymbol::find("TestHierRole", roleFoo), role);
+    EXPECT_EQ(MleTypeSymbol::find("TestHierRole", actor), MLE_TYPE_NONE);
+    EXPECT_EQ(MleTypeSymbol::find("TestHierFoo"), MLE_TYPE_NONE);
+    EXPECT_EQ(MleTypeSymbol::intern("TestHierFoo", roleFoo), roleFoo);
+}
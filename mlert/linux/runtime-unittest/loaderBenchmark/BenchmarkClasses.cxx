@@ -0,0 +1,134 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <iostream>
+
+// Include loader benchmark header files.
+#include "BenchmarkClasses.h"
+
+using namespace std;
+
+
+MLE_ACTOR_SOURCE(BenchmarkActor,MleActor)
+
+
+BenchmarkActor::BenchmarkActor()
+  : id(0), weight(0.0f), name(NULL)
+{}
+
+
+BenchmarkActor::~BenchmarkActor()
+{
+    if (name != NULL)
+        mlFree(name);
+}
+
+
+void
+BenchmarkActor::getProperty(MleObject *object, const char *name, unsigned char **value)
+{
+    if (strcmp("id",name) == 0)
+    {
+        *((int *)value) = ((BenchmarkActor *)object)->getIdProperty();
+    } else if (strcmp("weight",name) == 0)
+    {
+        *((float *)value) = ((BenchmarkActor *)object)->getWeightProperty();
+    } else if (strcmp("name",name) == 0)
+    {
+        *value = (unsigned char *)((BenchmarkActor *)object)->getNameProperty();
+    } else if (strcmp("samples",name) == 0)
+    {
+        *((MleArray<int> *)value) = *((BenchmarkActor *)object)->getSamplesProperty();
+    } else
+    {
+        cout << "***** ERROR: Unknown BenchmarkActor property: " << name << endl;
+    }
+}
+
+
+void
+BenchmarkActor::setProperty(MleObject *object, const char *name, unsigned char *value)
+{
+    if (strcmp("id",name) == 0)
+    {
+        ((BenchmarkActor *)object)->setIdProperty(*((int *)value));
+    } else if (strcmp("weight",name) == 0)
+    {
+        ((BenchmarkActor *)object)->setWeightProperty(*((float *)value));
+    } else if (strcmp("name",name) == 0)
+    {
+        size_t size = strlen((const char *)value) + 1;
+        ((BenchmarkActor *)object)->setNameProperty((const char *)value,size);
+    } else if (strcmp("samples",name) == 0)
+    {
+        ((BenchmarkActor *)object)->setSamplesProperty(*((MleArray<int> *)value));
+    } else
+    {
+        cout << "***** ERROR: Unknown BenchmarkActor property: " << name << endl;
+    }
+}
+
+
+MLE_ROLE_SOURCE(BenchmarkRole,MleRole)
+
+
+BenchmarkRole::BenchmarkRole(MleActor *actor)
+  : MleRole(actor)
+{}
+
+
+BenchmarkRole::~BenchmarkRole()
+{}
+
+
+MLE_SET_SOURCE(BenchmarkSet,MleSet)
+
+
+BenchmarkSet::BenchmarkSet()
+  : m_numAttached(0), m_numChildren(0)
+{}
+
+
+BenchmarkSet::~BenchmarkSet()
+{}
+
+
+void
+BenchmarkSet::attach(MleRole *parent, MleRole * /* child */)
+{
+    if (parent == NULL)
+        m_numAttached++;
+    else
+        m_numChildren++;
+}
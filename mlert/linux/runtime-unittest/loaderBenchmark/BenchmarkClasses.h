@@ -0,0 +1,104 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __BENCHMARKCLASSES_H_
+#define __BENCHMARKCLASSES_H_
+
+// Include system header files.
+#include <stddef.h>
+#include <string.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlArray.h"
+#include "mle/mlMalloc.h"
+#include "mle/MleActor.h"
+#include "mle/MleRole.h"
+#include "mle/MleSet.h"
+
+// The classes a synthetic playprint is loaded into.  They stand in for
+// a title's mastered classes, with one property of each kind the
+// chunk parser handles and no behavior beyond storing them.
+
+class BenchmarkActor : public MleActor
+{
+    MLE_ACTOR_HEADER(BenchmarkActor);
+
+  public:
+
+    static void getProperty(MleObject *object, const char *name, unsigned char **value); // value is an output parameter.
+    static void setProperty(MleObject *object, const char *name, unsigned char *value); // value is an input parameter.
+
+    MLE_ACTOR_PROPERTY(int, id, getIdProperty, setIdProperty)
+    MLE_ACTOR_PROPERTY(float, weight, getWeightProperty, setWeightProperty)
+    MLE_ACTOR_DYNAMIC_PROPERTY(char *, name, getNameProperty, setNameProperty)
+    MLE_ACTOR_ARRAY_PROPERTY(int, samples, getSamplesProperty, setSamplesProperty)
+
+  public:
+
+    BenchmarkActor();
+
+    virtual ~BenchmarkActor();
+};
+
+
+class BenchmarkRole : public MleRole
+{
+    MLE_ROLE_HEADER(BenchmarkRole);
+
+  public:
+
+    BenchmarkRole(MleActor *actor);
+
+    virtual ~BenchmarkRole();
+};
+
+
+class BenchmarkSet : public MleSet
+{
+    MLE_SET_HEADER(BenchmarkSet);
+
+  public:
+
+    BenchmarkSet();
+
+    virtual ~BenchmarkSet();
+
+    // Count the attachments, so runs can be checked against the
+    // playprint's fan-out.
+    virtual void attach(MleRole *parent, MleRole *child);
+
+    int m_numAttached;          // roles attached to the set itself
+    int m_numChildren;          // roles attached to a parent role
+};
+
+#endif /* __BENCHMARKCLASSES_H_ */
@@ -0,0 +1,325 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <stdio.h>
+#include <string.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+#include "mle/MleOpcode.h"
+#include "mle/MleChunkCodec.h"
+
+// Include loader benchmark header files.
+#include "SyntheticPlayprint.h"
+
+// The benchmark classes' table indices; see benchmarkstubs.cxx.
+#define ID_PROPERTY 0
+#define WEIGHT_PROPERTY 1
+#define NAME_PROPERTY 2
+#define SAMPLES_PROPERTY 3
+
+
+// ChunkWriter appends to a growing chunk in the encodings the chunk
+// parser reads.
+class ChunkWriter
+{
+  public:
+
+    ChunkWriter(void)
+      : m_data(NULL), m_length(0), m_size(0)
+    {}
+
+    ~ChunkWriter(void)
+    { if (m_data) mlFree(m_data); }
+
+    void putBytes(const void *bytes, size_t length)
+    {
+        if (m_length + length > m_size)
+        {
+            m_size = m_size ? 2 * m_size : 256;
+            while (m_length + length > m_size)
+                m_size *= 2;
+            m_data = (unsigned char *) mlRealloc(m_data, m_size);
+        }
+        memcpy(m_data + m_length, bytes, length);
+        m_length += length;
+    }
+
+    void putOpcode(int opcode)
+    {
+        unsigned char byte = (unsigned char) opcode;
+        putBytes(&byte, 1);
+    }
+
+    // As readInt() reads it, in host byte order.
+    void putInt(int value)
+    { putBytes(&value, sizeof(value)); }
+
+    // As readIndex() reads it: 7 bit groups, most significant first,
+    //   ended by the next opcode.
+    void putIndex(int value)
+    {
+        unsigned char bytes[5];
+        int numBytes = 0;
+        do
+        {
+            bytes[numBytes++] = (unsigned char) (value & valueMask);
+            value >>= valueBits;
+        } while (value != 0);
+        while (numBytes > 0)
+            putBytes(&bytes[--numBytes], 1);
+    }
+
+    // Hand the chunk over to the caller, who frees it with mlFree().
+    unsigned char *release(unsigned int *length)
+    {
+        unsigned char *data = m_data;
+        *length = (unsigned int) m_length;
+        m_data = NULL;
+        m_length = m_size = 0;
+        return data;
+    }
+
+  private:
+
+    unsigned char *m_data;
+    size_t m_length;
+    size_t m_size;
+};
+
+
+SyntheticPlayprint::SyntheticPlayprint(const SyntheticPlayprintOptions &options)
+  : m_options(options),
+    m_compressedGroups(NULL),
+    m_compressedGroupLengths(NULL)
+{
+    int numGroups = m_options.m_numGroups;
+    m_groups = new unsigned char *[numGroups];
+    m_groupLengths = new unsigned int[numGroups];
+    if (m_options.m_compress)
+    {
+        m_compressedGroups = new unsigned char *[numGroups];
+        m_compressedGroupLengths = new unsigned int[numGroups];
+    }
+
+    for (int i = 0; i < numGroups; i++)
+        writeGroup(i);
+    writeScene();
+}
+
+
+SyntheticPlayprint::~SyntheticPlayprint(void)
+{
+    for (int i = 0; i < m_options.m_numGroups; i++)
+    {
+        mlFree(m_groups[i]);
+        if (m_compressedGroups)
+            mlFree(m_compressedGroups[i]);
+    }
+    delete [] m_groups;
+    delete [] m_groupLengths;
+    delete [] m_compressedGroups;
+    delete [] m_compressedGroupLengths;
+    mlFree(m_scene);
+}
+
+
+void
+SyntheticPlayprint::writeGroup(int group)
+{
+    ChunkWriter chunk;
+    int numActors = m_options.m_numActors;
+
+    // The group class, then the number of actors.
+    chunk.putInt(0);
+    chunk.putIndex(numActors);
+
+    char *name = NULL;
+    if (m_options.m_propertySize > 0)
+        name = (char *) mlMalloc(m_options.m_propertySize);
+    int *samples = NULL;
+    if (m_options.m_arrayLength > 0)
+        samples = (int *) mlMalloc(m_options.m_arrayLength * sizeof(int));
+
+    for (int i = 0; i < numActors; i++)
+    {
+        chunk.putOpcode(createActorOpcode);
+        chunk.putIndex(0);
+        chunk.putOpcode(setSetOpcode);
+        chunk.putIndex(0);
+        chunk.putOpcode(bindRoleOpcode);
+        chunk.putIndex(0);
+
+        int id = group * numActors + i;
+        chunk.putOpcode(setPropertyOffsetOpcode);
+        chunk.putIndex(ID_PROPERTY);
+        chunk.putOpcode(setPropertyLengthOpcode);
+        chunk.putIndex(sizeof(id));
+        chunk.putOpcode(copyPropertyOpcode);
+        chunk.putBytes(&id, sizeof(id));
+
+        float weight = 1.0f + (float) i / numActors;
+        chunk.putOpcode(setPropertyOffsetOpcode);
+        chunk.putIndex(WEIGHT_PROPERTY);
+        chunk.putOpcode(setPropertyLengthOpcode);
+        chunk.putIndex(sizeof(weight));
+        chunk.putOpcode(copyPropertyOpcode);
+        chunk.putBytes(&weight, sizeof(weight));
+
+        if (name != NULL)
+        {
+            // A string of the requested size, terminator included,
+            //   repeating the actor's name as a mastered title's long
+            //   strings tend to repeat themselves.
+            char actorName[32];
+            int nameLength = snprintf(actorName, sizeof(actorName), "group%d.actor%d ", group, i);
+            for (int j = 0; j < m_options.m_propertySize - 1; j++)
+                name[j] = actorName[j % nameLength];
+            name[m_options.m_propertySize - 1] = '\0';
+
+            chunk.putOpcode(setPropertyOffsetOpcode);
+            chunk.putIndex(NAME_PROPERTY);
+            chunk.putOpcode(copyDynamicPropertyOpcode);
+            chunk.putInt(m_options.m_propertySize);
+            chunk.putBytes(name, m_options.m_propertySize);
+        }
+
+        if (samples != NULL)
+        {
+            for (int j = 0; j < m_options.m_arrayLength; j++)
+                samples[j] = id + j * j;
+
+            chunk.putOpcode(setPropertyOffsetOpcode);
+            chunk.putIndex(SAMPLES_PROPERTY);
+            chunk.putOpcode(setPropertyLengthOpcode);
+            chunk.putIndex(sizeof(int));
+            chunk.putOpcode(copyArrayPropertyOpcode);
+            chunk.putInt(m_options.m_arrayLength);
+            chunk.putBytes(samples, m_options.m_arrayLength * sizeof(int));
+        }
+    }
+
+    // Attach the roles as a tree; its root is left for the set.
+    if (m_options.m_fanOut > 0)
+    {
+        for (int i = 1; i < numActors; i++)
+        {
+            chunk.putOpcode(parentRoleOpcode);
+            chunk.putIndex((i - 1) / m_options.m_fanOut);
+            chunk.putOpcode(childRoleOpcode);
+            chunk.putIndex(i);
+        }
+    }
+
+    chunk.putOpcode(endActorGroupOpcode);
+    m_groups[group] = chunk.release(&m_groupLengths[group]);
+
+    if (m_compressedGroups)
+    {
+        unsigned char *compressed = (unsigned char *) mlMalloc(
+            MleChunkCodec::getCompressedBound(m_groupLengths[group]));
+        m_compressedGroupLengths[group] = (unsigned int) MleChunkCodec::compress(
+            m_groups[group], m_groupLengths[group], compressed);
+        m_compressedGroups[group] = compressed;
+    }
+
+    if (name)
+        mlFree(name);
+    if (samples)
+        mlFree(samples);
+}
+
+
+void
+SyntheticPlayprint::writeScene(void)
+{
+    ChunkWriter chunk;
+
+    // The scene class, then the TOC indices of its groups.
+    chunk.putInt(0);
+    chunk.putInt(m_options.m_numGroups);
+    for (int i = 0; i < m_options.m_numGroups; i++)
+        chunk.putInt(i);
+
+    m_scene = chunk.release(&m_sceneLength);
+}
+
+
+unsigned char *
+SyntheticPlayprint::getGroupChunk(int group, unsigned int *length) const
+{
+    *length = m_groupLengths[group];
+    return m_groups[group];
+}
+
+
+unsigned char *
+SyntheticPlayprint::getCompressedGroupChunk(int group, unsigned int *length) const
+{
+    if (m_compressedGroups == NULL)
+        return NULL;
+    *length = m_compressedGroupLengths[group];
+    return m_compressedGroups[group];
+}
+
+
+unsigned char *
+SyntheticPlayprint::getSceneChunk(unsigned int *length) const
+{
+    *length = m_sceneLength;
+    return m_scene;
+}
+
+
+size_t
+SyntheticPlayprint::getGroupBytes(void) const
+{
+    size_t bytes = 0;
+    for (int i = 0; i < m_options.m_numGroups; i++)
+        bytes += m_groupLengths[i];
+    return bytes;
+}
+
+
+size_t
+SyntheticPlayprint::getCompressedGroupBytes(void) const
+{
+    size_t bytes = 0;
+    if (m_compressedGroups)
+    {
+        for (int i = 0; i < m_options.m_numGroups; i++)
+            bytes += m_compressedGroupLengths[i];
+    }
+    return bytes;
+}
@@ -0,0 +1,110 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef __SYNTHETICPLAYPRINT_H_
+#define __SYNTHETICPLAYPRINT_H_
+
+// Include system header files.
+#include <stddef.h>
+
+/**
+ * The shape of a synthetic playprint.
+ */
+struct SyntheticPlayprintOptions
+{
+    int m_numGroups;            // groups in the scene
+    int m_numActors;            // actors in each group
+    int m_propertySize;         // bytes in each actor's name property
+    int m_arrayLength;          // elements in each actor's samples property
+    int m_fanOut;               // child roles attached to each parent role;
+                                //   0 attaches every role to the set
+    bool m_compress;            // also store each group chunk compressed
+};
+
+
+/**
+ * SyntheticPlayprint generates the chunks a mastered title's playprint
+ * would hold, written against the benchmark's class tables: one group
+ * chunk per group and a scene chunk listing them all.
+ *
+ * Each actor gets a role in set 0, its id and weight, a name of
+ * m_propertySize bytes and m_arrayLength samples.  With a fan-out the
+ * roles of a group form a tree, actor i's role being the child of actor
+ * (i - 1) / m_fanOut's; only the root is attached to the set.
+ *
+ * Group chunk i is at TOC index i, and the scene chunk follows them.
+ */
+class SyntheticPlayprint
+{
+  public:
+
+    SyntheticPlayprint(const SyntheticPlayprintOptions &options);
+
+    ~SyntheticPlayprint(void);
+
+    int getNumGroups(void) const
+    { return m_options.m_numGroups; }
+
+    int getNumActors(void) const
+    { return m_options.m_numGroups * m_options.m_numActors; }
+
+    // Get the raw contents of a group chunk.
+    unsigned char *getGroupChunk(int group, unsigned int *length) const;
+
+    // Get the compressed contents of a group chunk, as stored with
+    // MLE_CHUNK_COMPRESSED, or NULL unless m_compress was set.
+    unsigned char *getCompressedGroupChunk(int group, unsigned int *length) const;
+
+    // Get the contents of the scene chunk.
+    unsigned char *getSceneChunk(unsigned int *length) const;
+
+    // Get the total length of the raw, or compressed, group chunks.
+    size_t getGroupBytes(void) const;
+    size_t getCompressedGroupBytes(void) const;
+
+  private:
+
+    void writeGroup(int group);
+    void writeScene(void);
+
+    SyntheticPlayprintOptions m_options;
+
+    unsigned char **m_groups;
+    unsigned int *m_groupLengths;
+    unsigned char **m_compressedGroups;
+    unsigned int *m_compressedGroupLengths;
+    unsigned char *m_scene;
+    unsigned int m_sceneLength;
+};
+
+#endif /* __SYNTHETICPLAYPRINT_H_ */
@@ -0,0 +1,108 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// This file contains the Magic Lantern Runtime Engine tables that the
+// DigitalPlayprint mastering tools would generate for a title made of
+// the benchmark classes.  SyntheticPlayprint writes its chunks against
+// these indices.
+
+// Include system header files.
+#include <stdlib.h>
+
+// Include Magic Lantern Runtime Engine header files.
+#include "mle/MleTables.h"
+#include "mle/MleGroup.h"
+#include "mle/MleScene.h"
+
+// Include loader benchmark header files.
+#include "BenchmarkClasses.h"
+
+// The constructors defined by the class source macros.
+extern MleActor *_mlCreateBenchmarkActor(void);
+extern MleRole *_mlCreateBenchmarkRole(MleActor *a);
+extern MleSet *_mlCreateBenchmarkSet(void);
+
+static MleGroup *_mlCreateMleGroup(void) { return new MleGroup; }
+static MleScene *_mlCreateMleScene(void) { return new MleScene; }
+
+// Runtime Engine support for Actors.
+MleRTPropertyEntry mlRTActorProperties[] = {
+    { MLE_PROPERTY_ENTRY(BenchmarkActor,id) },          // id property
+    { MLE_PROPERTY_ENTRY(BenchmarkActor,weight) },      // weight property
+    { MLE_PROPERTY_ENTRY(BenchmarkActor,name) },        // name property
+    { MLE_PROPERTY_ENTRY(BenchmarkActor,samples) },     // samples property
+};
+
+int mlRTActorPropertyLength = 4;
+
+MleRTActorClassEntry mlRTActorClass[] = {
+    { _mlCreateBenchmarkActor, 0 },
+};
+int mlRTActorClassLength = 1;
+
+// Runtime Engine support for Roles.
+MleRTRoleClassEntry mlRTRoleClass[] = {
+    { _mlCreateBenchmarkRole },
+};
+int mlRTRoleClassLength = 1;
+
+// Runtime Engine support for Media References.
+MleRTMediaRefEntry mlRTMediaRef[1];
+int mlRTMediaRefLength = 0;
+
+// Runtime Engine support for Sets.  The benchmark creates the set
+// itself, so its chunk is never read.
+MleRTPropertyEntry mlRTSetProperties[1];
+MleRTSetClassEntry mlRTSetClass[] = {
+    { _mlCreateBenchmarkSet, 0 },
+};
+MleRTSetEntry mlRTSet[] = {
+    { _mlCreateBenchmarkSet, NULL },
+};
+int mlRTSetPropertyLength = 0;
+int mlRTSetClassLength = 1;
+int mlRTSetLength = 1;
+int MleRTSetChunk[1];
+
+// Runtime Engine support for Scenes.
+MleRTSceneClassEntry mlRTSceneClass[] = {
+    { _mlCreateMleScene },
+};
+int mlRTSceneClassLength = 1;
+int MleDppBootScene = 0;
+
+// Runtime Engine support for Groups.
+MleRTGroupClassEntry mlRTGroupClass[] = {
+    { _mlCreateMleGroup },
+};
+int mlRTGroupClassLength = 1;
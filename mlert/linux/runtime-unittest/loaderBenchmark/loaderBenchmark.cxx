@@ -0,0 +1,320 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+// Include Magic Lantern header files.
+#include "mle/mlMalloc.h"
+#include "mle/MleTables.h"
+#include "mle/MleDirector.h"
+#include "mle/MleLoad.h"
+#include "mle/MleGroup.h"
+#include "mle/MleScene.h"
+#include "mle/MleChunkCodec.h"
+
+// Include loader benchmark header files.
+#include "BenchmarkClasses.h"
+#include "SyntheticPlayprint.h"
+
+// The loader benchmark times each stage of loading a synthetic
+// playprint's groups and scene, reporting actors and chunk bytes
+// handled per second and heap allocations per actor:
+//
+//   first load    mlLoadGroup() of each group with no group templates,
+//                 decoding its chunk and then building the group
+//   mlLoadGroup   mlLoadGroup() of each group again, building it from
+//                 the template the first load left
+//   cold scene    mlLoadScene() of the scene chunk with no group
+//                 templates, decoding the groups on worker threads
+//   mlLoadScene   mlLoadScene() of the scene chunk, building a scene of
+//                 every group and replacing the previous scene
+//   decompress    decode the compressed group chunks (with -c)
+//
+// The loader reads the chunks from memory, through
+// mlSetPlayprintChunkSource(), rather than from a playprint file, whose
+// format belongs to the DPP library, so the numbers are the loader's
+// alone.  Runs with the same options can be compared to catch
+// regressions.
+
+
+// Allocations are counted by wrapping the C library allocator, which
+//   mlMalloc() and operator new both reach.
+static long g_numAllocations = 0;
+
+#if defined(__GLIBC__)
+#define COUNT_ALLOCATIONS 1
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *p, size_t size);
+
+extern "C" void *malloc(size_t size)
+{
+    g_numAllocations++;
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    g_numAllocations++;
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *p, size_t size)
+{
+    g_numAllocations++;
+    return __libc_realloc(p, size);
+}
+#endif /* __GLIBC__ */
+
+
+static double
+_now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+
+// The measurements of one stage.
+struct Stage
+{
+    const char *m_name;
+    double m_start;
+    long m_startAllocations;
+};
+
+
+static void
+_beginStage(Stage *stage, const char *name)
+{
+    stage->m_name = name;
+    stage->m_startAllocations = g_numAllocations;
+    stage->m_start = _now();
+}
+
+
+static void
+_endStage(Stage *stage, int iterations, long numActors, size_t numBytes)
+{
+    double seconds = _now() - stage->m_start;
+    long allocations = g_numAllocations - stage->m_startAllocations;
+    double actors = (double) numActors * iterations;
+
+    printf("%-14s %14.0f %12.1f", stage->m_name,
+        actors / seconds, numBytes * (double) iterations / seconds / 1e6);
+#if defined(COUNT_ALLOCATIONS)
+    printf(" %14.2f\n", allocations / actors);
+#else
+    (void) allocations;
+    printf(" %14s\n", "n/a");
+#endif
+}
+
+
+// The playprint the loader reads its chunks from.
+static SyntheticPlayprint *g_playprint = NULL;
+
+
+// The chunk source of the loader: group chunk i is at TOC index i,
+//   and the scene chunk follows them.
+static unsigned char *
+_getChunk(const int indexToPpTOC, unsigned int *length)
+{
+    if (indexToPpTOC < g_playprint->getNumGroups())
+        return g_playprint->getGroupChunk(indexToPpTOC, length);
+    return g_playprint->getSceneChunk(length);
+}
+
+
+// The title the loader runs in; it has no playprint file.
+static MleDirector g_benchmarkTitle;
+
+
+static void
+_usage(const char *program)
+{
+    fprintf(stderr,
+        "usage: %s [-g groups] [-a actors] [-p bytes] [-n elements] [-f fan-out]\n"
+        "          [-i iterations] [-t threads] [-c]\n"
+        "  -g  groups in the scene (default 16)\n"
+        "  -a  actors in each group (default 256)\n"
+        "  -p  bytes in each actor's dynamic property (default 64)\n"
+        "  -n  elements in each actor's array property (default 16)\n"
+        "  -f  roles attached to each parent role, 0 for none (default 4)\n"
+        "  -i  iterations of each stage (default 20)\n"
+        "  -t  threads decoding a cold scene's groups (default one per processor)\n"
+        "  -c  also time decompressing the group chunks\n",
+        program);
+}
+
+
+int
+main(int argc, char **argv)
+{
+    SyntheticPlayprintOptions options;
+    options.m_numGroups = 16;
+    options.m_numActors = 256;
+    options.m_propertySize = 64;
+    options.m_arrayLength = 16;
+    options.m_fanOut = 4;
+    options.m_compress = false;
+    int iterations = 20;
+    int numThreads = 0;
+
+    int option;
+    while ((option = getopt(argc, argv, "g:a:p:n:f:i:t:c")) != -1)
+    {
+        switch (option)
+        {
+          case 'g': options.m_numGroups = atoi(optarg); break;
+          case 'a': options.m_numActors = atoi(optarg); break;
+          case 'p': options.m_propertySize = atoi(optarg); break;
+          case 'n': options.m_arrayLength = atoi(optarg); break;
+          case 'f': options.m_fanOut = atoi(optarg); break;
+          case 'i': iterations = atoi(optarg); break;
+          case 't': numThreads = atoi(optarg); break;
+          case 'c': options.m_compress = true; break;
+          default:
+            _usage(argv[0]);
+            return 1;
+        }
+    }
+    if ((options.m_numGroups < 1) || (options.m_numActors < 1) ||
+        (options.m_propertySize < 0) || (options.m_arrayLength < 0) ||
+        (options.m_fanOut < 0) || (iterations < 1) || (numThreads < 0))
+    {
+        _usage(argv[0]);
+        return 1;
+    }
+
+    SyntheticPlayprint playprint(options);
+    int numGroups = playprint.getNumGroups();
+    long numActors = playprint.getNumActors();
+    size_t numBytes = playprint.getGroupBytes();
+
+    printf("%d groups of %d actors, %d-byte name property, %d samples, fan-out %d\n",
+        numGroups, options.m_numActors, options.m_propertySize,
+        options.m_arrayLength, options.m_fanOut);
+    printf("group chunks: %lu bytes", (unsigned long) numBytes);
+    if (options.m_compress)
+        printf(", %lu compressed", (unsigned long) playprint.getCompressedGroupBytes());
+    printf("\n\n");
+
+    g_playprint = &playprint;
+    g_theTitle = &g_benchmarkTitle;
+    mlSetPlayprintChunkSource(_getChunk);
+    mlSetGroupDecodeThreads(numThreads);
+
+    // The set every role is bound to; mlLoadSet() finds it created.
+    mlRTSet[0].ptr = (*mlRTSet[0].constructor)();
+    mlRTSet[0].ptr->init();
+    BenchmarkSet *set = (BenchmarkSet *) mlRTSet[0].ptr;
+
+    printf("%-14s %14s %12s %14s\n", "stage", "actors/sec", "MB/sec", "allocs/actor");
+
+    Stage stage;
+    unsigned int length;
+    int i, j;
+
+    _beginStage(&stage, "first load");
+    for (i = 0; i < iterations; i++)
+    {
+        mlFlushGroupTemplates();
+        for (j = 0; j < numGroups; j++)
+            delete mlLoadGroup(j);
+    }
+    _endStage(&stage, iterations, numActors, numBytes);
+
+    // Check the run attached every role once.
+    int numRoles = iterations * numActors;
+    int numRoots = options.m_fanOut ? iterations * numGroups : numRoles;
+    if ((set->m_numAttached != numRoots) || (set->m_numChildren != numRoles - numRoots))
+    {
+        fprintf(stderr, "mlLoadGroup attached %d roles to the set and %d to roles\n",
+            set->m_numAttached, set->m_numChildren);
+        return 1;
+    }
+
+    _beginStage(&stage, "mlLoadGroup");
+    for (i = 0; i < iterations; i++)
+    {
+        for (j = 0; j < numGroups; j++)
+            delete mlLoadGroup(j);
+    }
+    _endStage(&stage, iterations, numActors, numBytes);
+
+    _beginStage(&stage, "cold scene");
+    for (i = 0; i < iterations; i++)
+    {
+        mlFlushGroupTemplates();
+        mlLoadScene(numGroups);
+    }
+    _endStage(&stage, iterations, numActors, numBytes);
+
+    _beginStage(&stage, "mlLoadScene");
+    for (i = 0; i < iterations; i++)
+        mlLoadScene(numGroups);
+    _endStage(&stage, iterations, numActors, numBytes);
+    MleScene::deleteCurrentScene();
+
+    if (options.m_compress)
+    {
+        unsigned char *buffer = (unsigned char *) mlMalloc(numBytes);
+        size_t numCompressedBytes = playprint.getCompressedGroupBytes();
+        _beginStage(&stage, "decompress");
+        for (i = 0; i < iterations; i++)
+        {
+            for (j = 0; j < numGroups; j++)
+            {
+                unsigned char *chunk = playprint.getCompressedGroupChunk(j, &length);
+                if (! MleChunkCodec::decompress(chunk, length, buffer))
+                {
+                    fprintf(stderr, "group chunk %d did not decompress\n", j);
+                    return 1;
+                }
+            }
+        }
+        _endStage(&stage, iterations, numActors, numCompressedBytes);
+        mlFree(buffer);
+    }
+
+    mlSetPlayprintChunkSource(NULL);
+
+    return 0;
+}
@@ -39,6 +39,7 @@ SOURCES += \
     $$PWD/../../common/src/foundation/3dchar.cxx \
     $$PWD/../../common/src/foundation/MleActorClass.cxx \
     $$PWD/../../common/src/foundation/MleActor.cxx \
+    $$PWD/../../common/src/foundation/MleArena.cxx \
     $$PWD/../../common/src/foundation/MleDirector.cxx \
     $$PWD/../../common/src/foundation/MleDso.cxx \
     $$PWD/../../common/src/foundation/MleEvent.cxx \
@@ -51,9 +52,12 @@ SOURCES += \
     $$PWD/../../common/src/foundation/MleMonitor.cxx \
     $$PWD/../../common/src/foundation/MleNotifier.cxx \
     $$PWD/../../common/src/foundation/MleObject.cxx \
+    $$PWD/../../common/src/foundation/MleProperty.cxx \
+    $$PWD/../../common/src/foundation/MlePairingPq.cxx \
     $$PWD/../../common/src/foundation/MlePq.cxx \
     $$PWD/../../common/src/foundation/MlePtrArray.cxx \
     $$PWD/../../common/src/foundation/MlePtrDict.cxx \
+    $$PWD/../../common/src/foundation/MleFlatPtrDict.cxx \
     $$PWD/../../common/src/foundation/MleRoleClass.cxx \
     $$PWD/../../common/src/foundation/MleRole.cxx \
     $$PWD/../../common/src/foundation/MleSceneClass.cxx \
@@ -61,6 +65,8 @@ SOURCES += \
     $$PWD/../../common/src/foundation/MleScheduler.cxx \
     $$PWD/../../common/src/foundation/MleSetClass.cxx \
     $$PWD/../../common/src/foundation/MleSet.cxx \
+    $$PWD/../../common/src/foundation/MleSlotMap.cxx \
+    $$PWD/../../common/src/foundation/MleTypeSymbol.cxx \
     $$PWD/../../common/src/foundation/MleStageClass.cxx \
     $$PWD/../../common/src/foundation/MleStage.cxx
 
@@ -73,9 +79,11 @@ HEADERS += \
     $$PWD/../../common/src/foundation/mle/MleActorClass.h \
     $$PWD/../../common/src/foundation/mle/MleActorGC.h \
     $$PWD/../../common/src/foundation/mle/MleActor.h \
+    $$PWD/../../common/src/foundation/mle/MleArena.h \
     $$PWD/../../common/src/foundation/mle/MleDirector.h \
     $$PWD/../../common/src/foundation/mle/MleDso.h \
     $$PWD/../../common/src/foundation/mle/MleEventDispatcher.h \
+    $$PWD/../../common/src/foundation/mle/MleFixedPool.h \
     $$PWD/../../common/src/foundation/mle/MleEvent.h \
     $$PWD/../../common/src/foundation/mle/MleGroupClass.h \
     $$PWD/../../common/src/foundation/mle/MleGroup.h \
@@ -86,6 +94,7 @@ HEADERS += \
     $$PWD/../../common/src/foundation/mle/MleMonitor.h \
     $$PWD/../../common/src/foundation/mle/MleNotifier.h \
     $$PWD/../../common/src/foundation/mle/MleObject.h \
+    $$PWD/../../common/src/foundation/mle/MlePairingPq.h \
     $$PWD/../../common/src/foundation/mle/MleOpcode.h \
     $$PWD/../../common/src/foundation/mle/MlePlatformData.h \
     $$PWD/../../common/src/foundation/mle/MlePq.h \
@@ -94,6 +103,7 @@ HEADERS += \
     $$PWD/../../common/src/foundation/mle/MlePtrArray.h \
     $$PWD/../../common/src/foundation/mle/MlePtrContainer.h \
     $$PWD/../../common/src/foundation/mle/MlePtrDict.h \
+    $$PWD/../../common/src/foundation/mle/MleFlatPtrDict.h \
     $$PWD/../../common/src/foundation/mle/MleRoleClass.h \
     $$PWD/../../common/src/foundation/mle/MleRole.h \
     $$PWD/../../common/src/foundation/mle/MleRuntime.h \
@@ -102,6 +112,8 @@ HEADERS += \
     $$PWD/../../common/src/foundation/mle/MleScheduler.h \
     $$PWD/../../common/src/foundation/mle/MleSetClass.h \
     $$PWD/../../common/src/foundation/mle/MleSet.h \
+    $$PWD/../../common/src/foundation/mle/MleSlotMap.h \
+    $$PWD/../../common/src/foundation/mle/MleTypeSymbol.h \
     $$PWD/../../common/src/foundation/mle/MleStageClass.h \
     $$PWD/../../common/src/foundation/mle/MleStageFuncs.h \
     $$PWD/../../common/src/foundation/mle/MleStage.h \
@@ -39,7 +39,13 @@ SOURCES += \
     $$PWD/../../common/src/foundation/3danim.cxx \
     $$PWD/../../common/src/foundation/3dchar.cxx \
     $$PWD/../../common/src/foundation/MleActor.cxx \
+    $$PWD/../../common/src/foundation/MleArena.cxx \
     $$PWD/../../common/src/foundation/MleActorGC.cxx \
+    $$PWD/../../common/src/foundation/MleChunkTrace.cxx \
+    $$PWD/../../common/src/foundation/MleChunkMap.cxx \
+    $$PWD/../../common/src/foundation/MleChunkCodec.cxx \
+    $$PWD/../../common/src/foundation/MleGroupTemplate.cxx \
+    $$PWD/../../common/src/foundation/MleSceneLoader.cxx \
     $$PWD/../../common/src/foundation/MleDirector.cxx \
     $$PWD/../../common/src/foundation/MleDso.cxx \
     $$PWD/../../common/src/foundation/MleEvent.cxx \
@@ -50,13 +56,18 @@ SOURCES += \
     $$PWD/../../common/src/foundation/MleMonitor.cxx \
     $$PWD/../../common/src/foundation/MleNotifier.cxx \
     $$PWD/../../common/src/foundation/MleObject.cxx \
+    $$PWD/../../common/src/foundation/MleProperty.cxx \
+    $$PWD/../../common/src/foundation/MlePairingPq.cxx \
     $$PWD/../../common/src/foundation/MlePq.cxx \
     $$PWD/../../common/src/foundation/MlePtrArray.cxx \
     $$PWD/../../common/src/foundation/MlePtrDict.cxx \
+    $$PWD/../../common/src/foundation/MleFlatPtrDict.cxx \
     $$PWD/../../common/src/foundation/MleRole.cxx \
     $$PWD/../../common/src/foundation/MleScene.cxx \
     $$PWD/../../common/src/foundation/MleScheduler.cxx \
     $$PWD/../../common/src/foundation/MleSet.cxx \
+    $$PWD/../../common/src/foundation/MleSlotMap.cxx \
+    $$PWD/../../common/src/foundation/MleTypeSymbol.cxx \
     $$PWD/../../common/src/foundation/MleStage.cxx
 
 SOURCES += \
@@ -66,10 +77,17 @@ HEADERS += \
     $$PWD/../../common/src/foundation/mle/3danim.h \
     $$PWD/../../common/src/foundation/mle/3dchar.h \
     $$PWD/../../common/src/foundation/mle/MleActorGC.h \
+    $$PWD/../../common/src/foundation/mle/MleChunkTrace.h \
+    $$PWD/../../common/src/foundation/mle/MleChunkMap.h \
+    $$PWD/../../common/src/foundation/mle/MleChunkCodec.h \
+    $$PWD/../../common/src/foundation/mle/MleGroupTemplate.h \
+    $$PWD/../../common/src/foundation/mle/MleSceneLoader.h \
     $$PWD/../../common/src/foundation/mle/MleActor.h \
+    $$PWD/../../common/src/foundation/mle/MleArena.h \
     $$PWD/../../common/src/foundation/mle/MleDirector.h \
     $$PWD/../../common/src/foundation/mle/MleDso.h \
     $$PWD/../../common/src/foundation/mle/MleEventDispatcher.h \
+    $$PWD/../../common/src/foundation/mle/MleFixedPool.h \
     $$PWD/../../common/src/foundation/mle/MleEvent.h \
     $$PWD/../../common/src/foundation/mle/MleGroup.h \
     $$PWD/../../common/src/foundation/mle/MleLoad.h \
@@ -78,6 +96,7 @@ HEADERS += \
     $$PWD/../../common/src/foundation/mle/MleMonitor.h \
     $$PWD/../../common/src/foundation/mle/MleNotifier.h \
     $$PWD/../../common/src/foundation/mle/MleObject.h \
+    $$PWD/../../common/src/foundation/mle/MlePairingPq.h \
     $$PWD/../../common/src/foundation/mle/MleOpcode.h \
     $$PWD/../../common/src/foundation/mle/MlePlatformData.h \
     $$PWD/../../common/src/foundation/mle/MlePq.h \
@@ -86,11 +105,14 @@ HEADERS += \
     $$PWD/../../common/src/foundation/mle/MlePtrArray.h \
     $$PWD/../../common/src/foundation/mle/MlePtrContainer.h \
     $$PWD/../../common/src/foundation/mle/MlePtrDict.h \
+    $$PWD/../../common/src/foundation/mle/MleFlatPtrDict.h \
     $$PWD/../../common/src/foundation/mle/MleRole.h \
     $$PWD/../../common/src/foundation/mle/MleRuntime.h \
     $$PWD/../../common/src/foundation/mle/MleScene.h \
     $$PWD/../../common/src/foundation/mle/MleScheduler.h \
     $$PWD/../../common/src/foundation/mle/MleSet.h \
+    $$PWD/../../common/src/foundation/mle/MleSlotMap.h \
+    $$PWD/../../common/src/foundation/mle/MleTypeSymbol.h \
     $$PWD/../../common/src/foundation/mle/MleStageFuncs.h \
     $$PWD/../../common/src/foundation/mle/MleStage.h \
     $$PWD/../../common/src/foundation/mle/MleTables.h